@@ -27,8 +27,13 @@
 
 #include "utility.hpp"
 
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <rocalution/rocalution.hpp>
+#include <sstream>
+#include <string>
 
 using namespace rocalution;
 
@@ -49,6 +54,18 @@ void testing_backend_init_order(void)
     // Set OpenMP threshold size
     ASSERT_DEATH(set_omp_threshold_rocalution(threshold), ".*Assertion.*");
 
+    // Set OpenMP triangular solve algorithm
+    ASSERT_DEATH(set_omp_trisolve_rocalution(TriSolveAuto), ".*Assertion.*");
+
+    // Enable the host thread team
+    ASSERT_DEATH(set_omp_thread_team_rocalution(true), ".*Assertion.*");
+
+    // Enable NUMA first-touch placement
+    ASSERT_DEATH(set_omp_first_touch_rocalution(true), ".*Assertion.*");
+
+    // Calibrate OpenMP thresholds
+    ASSERT_DEATH(calibrate_omp_threshold_rocalution(), ".*Assertion.*");
+
     // Initialize rocalution platform
     set_device_rocalution(device);
     init_rocalution();
@@ -98,4 +115,356 @@ void testing_backend(Arguments argus)
     stop_rocalution();
 }
 
+// Number of entries of an OpenMP threshold calibration file
+static int testing_backend_calibration_entries(const std::string& filename)
+{
+    std::ifstream file(filename.c_str());
+    std::string   line;
+
+    int nentries = 0;
+
+    while(std::getline(file, line))
+    {
+        if(line.empty() == false && line[0] != '#')
+        {
+            ++nentries;
+        }
+    }
+
+    return nentries;
+}
+
+void testing_backend_calibration(void)
+{
+    std::string filename = "rocalution_omp_calibration.txt";
+
+    std::remove(filename.c_str());
+
+    // Initialize rocalution platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Calibrate for two threads and store the thresholds
+    set_omp_threads_rocalution(2);
+    calibrate_omp_threshold_rocalution(filename);
+
+    // The file should contain a single entry for two threads with four thresholds
+    int nentries = 0;
+
+    {
+        std::ifstream file(filename.c_str());
+        std::string   line;
+
+        ASSERT_TRUE(file.is_open());
+
+        while(std::getline(file, line))
+        {
+            if(line.empty() == true || line[0] == '#')
+            {
+                continue;
+            }
+
+            std::istringstream entry(line);
+
+            int nthreads;
+            int threshold[4];
+
+            entry >> nthreads >> threshold[0] >> threshold[1] >> threshold[2] >> threshold[3];
+
+            ASSERT_FALSE(entry.fail());
+            ASSERT_EQ(nthreads, 2);
+
+            for(int k = 0; k < 4; ++k)
+            {
+                ASSERT_GT(threshold[k], 0);
+            }
+
+            ++nentries;
+        }
+    }
+
+    ASSERT_EQ(nentries, 1);
+
+    // Loading the thresholds again should not add another entry
+    calibrate_omp_threshold_rocalution(filename);
+
+    ASSERT_EQ(testing_backend_calibration_entries(filename), 1);
+
+    // Changing the number of threads measures the thresholds for three threads and adds
+    // them to the file
+    set_omp_threads_rocalution(3);
+
+    for(int k = 0; k < 4; ++k)
+    {
+        ASSERT_GT(_get_backend_descriptor()->OpenMP_kernel_threshold[k], 0);
+    }
+
+    ASSERT_EQ(testing_backend_calibration_entries(filename), 2);
+
+    // Going back to two threads loads the stored thresholds
+    set_omp_threads_rocalution(2);
+
+    for(int k = 0; k < 4; ++k)
+    {
+        ASSERT_GT(_get_backend_descriptor()->OpenMP_kernel_threshold[k], 0);
+    }
+
+    ASSERT_EQ(testing_backend_calibration_entries(filename), 2);
+
+    // Operations should work with calibrated thresholds
+    LocalVector<double> x;
+    LocalVector<double> y;
+
+    x.Allocate("x", 1000);
+    y.Allocate("y", 1000);
+
+    x.Ones();
+    y.Ones();
+
+    y.AddScale(x, 2.0);
+
+    ASSERT_EQ(x.Dot(y), 3000.0);
+
+    x.Clear();
+    y.Clear();
+
+    // Reset to the global threshold
+    set_omp_threshold_rocalution(10000);
+
+    for(int k = 0; k < 4; ++k)
+    {
+        ASSERT_EQ(_get_backend_descriptor()->OpenMP_kernel_threshold[k], -1);
+    }
+
+    // Without calibration, changing the number of threads keeps the global threshold
+    set_omp_threads_rocalution(3);
+
+    ASSERT_EQ(_get_backend_descriptor()->OpenMP_kernel_threshold[OpenMPKernelSpMV], -1);
+
+    // Stop rocalution platform
+    stop_rocalution();
+
+    std::remove(filename.c_str());
+}
+
+static int host_allocator_nalloc = 0;
+static int host_allocator_nfree  = 0;
+
+static void* testing_host_alloc(size_t size, size_t alignment)
+{
+    ++host_allocator_nalloc;
+
+    // Over-allocate and store the original pointer in front of the aligned buffer
+    char* base = static_cast<char*>(malloc(size + alignment + sizeof(void*)));
+
+    if(base == NULL)
+    {
+        return NULL;
+    }
+
+    size_t addr = reinterpret_cast<size_t>(base) + sizeof(void*) + alignment - 1;
+    void*  ptr  = reinterpret_cast<void*>(addr - addr % alignment);
+
+    static_cast<void**>(ptr)[-1] = base;
+
+    return ptr;
+}
+
+static void testing_host_free(void* ptr)
+{
+    ++host_allocator_nfree;
+
+    free(static_cast<void**>(ptr)[-1]);
+}
+
+void testing_backend_host_allocator(void)
+{
+    // Initialize rocalution platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Default allocator returns aligned buffers
+    double* buffer = NULL;
+
+    allocate_host(1000, &buffer);
+    ASSERT_EQ(reinterpret_cast<size_t>(buffer) % 64, 0);
+
+    // Install custom hooks, the buffer from the default allocator must still be freed
+    // correctly
+    set_host_allocator_rocalution(testing_host_alloc, testing_host_free);
+
+    {
+        LocalVector<double> x;
+        LocalVector<int>    y;
+
+        x.Allocate("x", 1000);
+        y.Allocate("y", 17);
+
+        x.Ones();
+        y.Ones();
+
+        ASSERT_EQ(x.Asum(), 1000.0);
+        ASSERT_EQ(y.Asum(), 17);
+
+        ASSERT_EQ(host_allocator_nalloc, 2);
+        ASSERT_EQ(host_allocator_nfree, 0);
+    }
+
+    ASSERT_EQ(host_allocator_nfree, 2);
+
+    free_host(&buffer);
+
+    // Buffers from the custom allocator must be freed correctly after restoring the
+    // default allocator
+    allocate_host(1000, &buffer);
+    ASSERT_EQ(reinterpret_cast<size_t>(buffer) % 64, 0);
+
+    set_host_allocator_rocalution(NULL, NULL);
+
+    free_host(&buffer);
+
+    ASSERT_EQ(host_allocator_nalloc, 3);
+    ASSERT_EQ(host_allocator_nfree, 3);
+
+    // Huge pages for large buffers
+    set_host_huge_pages_rocalution(true, 1024 * 1024);
+
+    allocate_host(1 << 20, &buffer);
+    ASSERT_EQ(reinterpret_cast<size_t>(buffer) % (2 * 1024 * 1024), 0);
+
+    set_to_zero_host(1 << 20, buffer);
+    free_host(&buffer);
+
+    set_host_huge_pages_rocalution(false);
+
+    // Buffers allocated externally with new[] are still supported
+    buffer = new double[100];
+    free_host(&buffer);
+
+    // Stop rocalution platform
+    stop_rocalution();
+}
+
+void testing_backend_host_memory_pool(void)
+{
+    // Initialize rocalution platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    set_host_memory_pool_rocalution(true);
+
+    HostMemoryPoolStats start = get_host_memory_pool_stats_rocalution();
+
+    // Repeatedly allocate and free the same vectors
+    for(int i = 0; i < 3; ++i)
+    {
+        LocalVector<double> x;
+        LocalVector<double> y;
+
+        x.Allocate("x", 1000);
+        y.Allocate("y", 999);
+
+        x.Ones();
+        y.Ones();
+
+        ASSERT_EQ(x.Asum(), 1000.0);
+        ASSERT_EQ(y.Asum(), 999.0);
+    }
+
+    HostMemoryPoolStats stats = get_host_memory_pool_stats_rocalution();
+
+    // All allocations but the first two are served from the pool
+    ASSERT_EQ(stats.requests - start.requests, 6);
+    ASSERT_EQ(stats.hits - start.hits, 4);
+    ASSERT_GE(stats.peak_size, 2 * 999 * sizeof(double));
+    ASSERT_EQ(stats.cached_size, stats.size);
+
+    info_host_memory_pool_rocalution();
+
+    // Disabling the pool releases all cached buffers
+    set_host_memory_pool_rocalution(false);
+
+    stats = get_host_memory_pool_stats_rocalution();
+
+    ASSERT_EQ(stats.cached_size, 0);
+    ASSERT_EQ(stats.size, 0);
+
+    // Stop rocalution platform
+    stop_rocalution();
+}
+
+void testing_backend_memory_usage(void)
+{
+    // Initialize rocalution platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    size_t usage = get_host_memory_usage_rocalution();
+
+    reset_host_memory_peak_rocalution();
+    ASSERT_EQ(get_host_memory_peak_rocalution(), usage);
+
+    // 2D Laplacian, passed by SetDataPtr and thus not accounted
+    int*    csr_ptr = NULL;
+    int*    csr_col = NULL;
+    double* csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(32, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<double> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    ASSERT_EQ(A.GetMemoryUsage(), (nrow + 1) * sizeof(int) + nnz * (sizeof(int) + sizeof(double)));
+    ASSERT_EQ(get_host_memory_usage_rocalution(), usage);
+
+    LocalVector<double> x;
+    x.Allocate("x", nrow);
+
+    ASSERT_EQ(x.GetMemoryUsage(), nrow * sizeof(double));
+    ASSERT_EQ(get_host_memory_usage_rocalution(), usage + x.GetMemoryUsage());
+
+    // Conversion allocates the new format
+    A.ConvertToCOO();
+
+    ASSERT_EQ(A.GetMemoryUsage(), nnz * (2 * sizeof(int) + sizeof(double)));
+    ASSERT_EQ(get_host_memory_usage_rocalution(),
+              usage + x.GetMemoryUsage() + A.GetMemoryUsage());
+
+    A.ConvertToCSR();
+
+    // Multigrid hierarchy
+    size_t usage_amg = get_host_memory_usage_rocalution();
+
+    SAAMG<LocalMatrix<double>, LocalVector<double>, double> amg;
+
+    amg.SetOperator(A);
+    amg.SetCoarsestLevel(50);
+    amg.Verbose(0);
+    amg.Build();
+
+    ASSERT_GT(amg.GetNumLevels(), 1);
+    ASSERT_EQ(amg.GetMemoryUsage(), get_host_memory_usage_rocalution() - usage_amg);
+
+    amg.PrintMemoryUsage();
+    amg.Clear();
+
+    ASSERT_EQ(get_host_memory_usage_rocalution(), usage_amg);
+
+    size_t peak = get_host_memory_peak_rocalution();
+    ASSERT_GE(peak, usage_amg);
+
+    A.Clear();
+    x.Clear();
+
+    ASSERT_EQ(get_host_memory_usage_rocalution(), usage);
+    ASSERT_EQ(get_host_memory_peak_rocalution(), peak);
+
+    reset_host_memory_peak_rocalution();
+    ASSERT_EQ(get_host_memory_peak_rocalution(), usage);
+
+    // Stop rocalution platform
+    stop_rocalution();
+}
+
 #endif // TESTING_BACKEND_HPP
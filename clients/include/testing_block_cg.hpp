@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_BLOCK_CG_HPP
+#define TESTING_BLOCK_CG_HPP
+
+#include "utility.hpp"
+
+#include <rocalution/rocalution.hpp>
+
+using namespace rocalution;
+
+static bool check_residual(float res)
+{
+    return (res < 1e-3f);
+}
+
+static bool check_residual(double res)
+{
+    return (res < 1e-6);
+}
+
+template <typename T>
+bool testing_block_cg(Arguments argus)
+{
+    int          ndim     = argus.size;
+    int          nvectors = argus.nvectors;
+    std::string  precond  = argus.precond;
+    unsigned int format   = argus.format;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Enforce multiple threads
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    // rocALUTION structures
+    LocalMatrix<T>      A;
+    LocalMultiVector<T> X;
+    LocalMultiVector<T> B;
+    LocalVector<T>      x;
+    LocalVector<T>      b;
+    LocalVector<T>      e;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    X.MoveToAccelerator();
+    B.MoveToAccelerator();
+    x.MoveToAccelerator();
+    b.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate X, B, x, b and e
+    X.Allocate("X", A.GetN(), nvectors);
+    B.Allocate("B", A.GetM(), nvectors);
+    x.Allocate("x", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    // b_j = A * e_j, with random e_j and random initial guess x_j
+    for(int j = 0; j < nvectors; ++j)
+    {
+        e.SetRandomUniform(1234ULL + j, -1.0, 1.0);
+        A.Apply(e, &b);
+        B.CopyFromVector(j, b);
+
+        x.SetRandomUniform(12345ULL + j, -4.0, 6.0);
+        X.CopyFromVector(j, x);
+    }
+
+    // Solver
+    BlockCG<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    // Preconditioner
+    Preconditioner<LocalMatrix<T>, LocalVector<T>, T>* p;
+
+    if(precond == "None")
+        p = NULL;
+    else if(precond == "Jacobi")
+        p = new Jacobi<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "IC")
+        p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+    else
+        return false;
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+
+    // Set preconditioner
+    if(p != NULL)
+    {
+        ls.SetPreconditioner(*p);
+    }
+
+    ls.Init(1e-8, 0.0, 1e+8, 10000);
+    ls.Build();
+
+    // Matrix format
+    A.ConvertTo(format, format == BCSR ? 3 : 1);
+
+    // A single right-hand side is solved through the vector interface
+    if(nvectors == 1)
+    {
+        B.CopyToVector(0, &b);
+        X.CopyToVector(0, &x);
+
+        ls.Solve(b, &x);
+
+        X.CopyFromVector(0, x);
+    }
+    else
+    {
+        ls.Solve(B, &X);
+    }
+
+    // Verify solution
+    bool success = true;
+
+    for(int j = 0; j < nvectors; ++j)
+    {
+        e.SetRandomUniform(1234ULL + j, -1.0, 1.0);
+        X.CopyToVector(j, &x);
+
+        x.ScaleAdd(-1.0, e);
+        T nrm2 = x.Norm();
+
+        success &= check_residual(nrm2);
+    }
+
+    // Clean up
+    ls.Clear();
+    if(p != NULL)
+    {
+        delete p;
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+#endif // TESTING_BLOCK_CG_HPP
@@ -128,6 +128,20 @@ bool testing_cg(Arguments argus)
         p = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "IC")
         p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ICJacobi")
+    {
+        IC<LocalMatrix<T>, LocalVector<T>, T>* ic = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+        ic->SetJacobiSweeps(3);
+
+        p = ic;
+    }
+    else if(precond == "ICFixedPoint")
+    {
+        IC<LocalMatrix<T>, LocalVector<T>, T>* ic = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+        ic->SetFactorizationSweeps(3);
+
+        p = ic;
+    }
     else if(precond == "MCGS")
         p = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "MCSGS")
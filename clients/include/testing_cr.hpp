@@ -124,6 +124,13 @@ bool testing_cr(Arguments argus)
         p = new SGS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "ILU")
         p = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ILUJacobi")
+    {
+        ILU<LocalMatrix<T>, LocalVector<T>, T>* ilu = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+        ilu->SetJacobiSweeps(3);
+
+        p = ilu;
+    }
     else if(precond == "ILUT")
         p = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "IC")
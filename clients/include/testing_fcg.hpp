@@ -126,6 +126,14 @@ bool testing_fcg(Arguments argus)
         p = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "ILUT")
         p = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ILUTPartition")
+    {
+        ILUT<LocalMatrix<T>, LocalVector<T>, T>* ilut
+            = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
+        ilut->SetPartitions(4);
+
+        p = ilut;
+    }
     else if(precond == "IC")
         p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "MCGS")
@@ -139,6 +139,7 @@ bool testing_fgmres(Arguments argus)
 
     ls.Init(1e-6, 0.0, 1e+8, 10000);
     ls.SetBasisSize(basis);
+    ls.SetOrthogonalization(argus.orthogonal);
 
     ls.Build();
 
@@ -147,6 +147,7 @@ bool testing_gmres(Arguments argus, bool expectConvergence = true)
 
     ls.Init(1e-6, 0.0, 1e+8, 10000);
     ls.SetBasisSize(basis);
+    ls.SetOrthogonalization(argus.orthogonal);
 
     ls.Build();
 
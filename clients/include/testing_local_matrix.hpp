@@ -398,6 +398,8 @@ bool testing_local_matrix_conversions(Arguments argus)
     success &= A.Check();
     A.ConvertToHYB();
     success &= A.Check();
+    A.ConvertToSELL();
+    success &= A.Check();
     A.ConvertToDENSE();
     success &= A.Check();
     A.ConvertToMCSR();
@@ -418,6 +420,8 @@ bool testing_local_matrix_conversions(Arguments argus)
     success &= A.Check();
     A.ConvertToHYB();
     success &= A.Check();
+    A.ConvertToSELL();
+    success &= A.Check();
     A.ConvertToDENSE();
     success &= A.Check();
     A.ConvertToMCSR();
@@ -490,4 +494,631 @@ bool testing_local_matrix_allocations(Arguments argus)
     return true;
 }
 
+template <typename T>
+static bool check_relative_error(const LocalVector<T>& x, const LocalVector<T>& x_ref)
+{
+    LocalVector<T> diff;
+    diff.CloneFrom(x);
+    diff.ScaleAdd(static_cast<T>(-1), x_ref);
+
+    return std::abs(diff.Norm()) <= 1e-4 * std::abs(x_ref.Norm());
+}
+
+template <typename T>
+static bool check_relative_error(T val, T val_ref)
+{
+    return std::abs(val - val_ref) <= 1e-4 * std::max(std::abs(val_ref), static_cast<T>(1));
+}
+
+template <typename T>
+bool testing_local_matrix_triangular_solves(Arguments argus)
+{
+    int size = argus.size;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Enforce multiple threads such that the analysed solves run in parallel
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+    set_omp_trisolve_rocalution(argus.omp_trisolve);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_3d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    LocalVector<T> b;
+    LocalVector<T> x;
+    LocalVector<T> x_ref;
+
+    b.Allocate("b", nrow);
+    x.Allocate("x", nrow);
+    x_ref.Allocate("x_ref", nrow);
+
+    b.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+    bool success = true;
+
+    // L and U solves, the reference is computed without analysis
+    A.LSolve(b, &x_ref);
+    A.LAnalyse(false);
+    A.LSolve(b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    A.USolve(b, &x_ref);
+    A.UAnalyse(false);
+    A.USolve(b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    A.LAnalyseClear();
+    A.UAnalyseClear();
+
+    // ILU(0)
+    LocalMatrix<T> LU;
+    LU.CloneFrom(A);
+    LU.ILU0Factorize();
+
+    LU.LUSolve(b, &x_ref);
+    LU.LUAnalyse();
+    LU.LUSolve(b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    // Jacobi sweeps are exact once their number reaches the number of levels (3 * size - 2)
+    int sweeps = 3 * size;
+
+    LU.ItLUSolve(sweeps, b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    LU.ItLUAnalyse();
+    LU.ItLUSolve(sweeps, b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    // Clearing the Jacobi sweep analysis must keep the level schedules of LUAnalyse
+    LU.ItLUAnalyseClear();
+
+    size_t analysed = LU.GetMemoryUsage();
+
+    LU.ItLLAnalyse();
+    LU.ItLLAnalyseClear();
+    success &= (LU.GetMemoryUsage() == analysed);
+
+    LU.LUSolve(b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    // Fixed-point ILU(0), converges to the exact factors
+    LocalMatrix<T> LU_it;
+    LU_it.CloneFrom(A);
+    LU_it.ItILU0Factorize(sweeps);
+    LU_it.LUSolve(b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    // IC(0)
+    LocalMatrix<T> LL;
+    LocalVector<T> inv_diag;
+    A.ExtractL(&LL, true);
+    LL.ICFactorize(&inv_diag);
+
+    LL.LLSolve(b, &x_ref);
+    LL.LLAnalyse();
+    LL.LLSolve(b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    LL.LLSolve(b, inv_diag, &x);
+    success &= check_relative_error(x, x_ref);
+
+    LL.ItLLSolve(sweeps, b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    LL.ItLLAnalyse();
+    LL.ItLLSolve(sweeps, b, inv_diag, &x);
+    success &= check_relative_error(x, x_ref);
+
+    LL.LLAnalyseClear();
+    LL.ItLLSolve(sweeps, b, &x);
+    success &= check_relative_error(x, x_ref);
+
+    // Fixed-point IC(0), converges to the exact factor
+    LocalMatrix<T> LL_it;
+    LocalVector<T> inv_diag_it;
+    A.ExtractL(&LL_it, true);
+    LL_it.ItICFactorize(sweeps, &inv_diag_it);
+    LL_it.LLSolve(b, inv_diag_it, &x);
+    success &= check_relative_error(x, x_ref);
+
+    // Block ILU(0) of BCSR matrices, fixed size kernels for block dimensions 2 to 8, generic
+    // kernel otherwise. The reference is the ILU(0) of the CSR matrix with the same block
+    // pattern (including the explicit zeros inside the blocks).
+    for(int blockdim = 2; blockdim <= 9; ++blockdim)
+    {
+        int* bcsr_ptr = NULL;
+        int* bcsr_col = NULL;
+        T*   bcsr_val = NULL;
+
+        int nrowb = gen_2d_laplacian(4 * blockdim, &bcsr_ptr, &bcsr_col, &bcsr_val);
+        int nnzb  = bcsr_ptr[nrowb];
+
+        LocalMatrix<T> B;
+        B.SetDataPtrCSR(&bcsr_ptr, &bcsr_col, &bcsr_val, "B", nnzb, nrowb, nrowb);
+        B.ConvertToBCSR(blockdim);
+
+        LocalMatrix<T> B_ref;
+        B_ref.CloneFrom(B);
+        B_ref.ConvertToCSR();
+        B_ref.ILU0Factorize();
+        B_ref.LUAnalyse();
+
+        LocalVector<T> rhs;
+        LocalVector<T> sol;
+        LocalVector<T> sol_ref;
+
+        rhs.Allocate("rhs", nrowb);
+        sol.Allocate("sol", nrowb);
+        sol_ref.Allocate("sol_ref", nrowb);
+
+        rhs.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+        B_ref.LUSolve(rhs, &sol_ref);
+
+        // The analysis of the unfactorized matrix must not be used after the factorization
+        B.LUAnalyse();
+        B.ILU0Factorize();
+        B.LUSolve(rhs, &sol);
+        success &= check_relative_error(sol, sol_ref);
+
+        B.LUAnalyse();
+        B.LUSolve(rhs, &sol);
+        success &= check_relative_error(sol, sol_ref);
+        success &= (B.GetFormat() == BCSR);
+    }
+
+    // Restore the default triangular solve algorithm
+    set_omp_trisolve_rocalution(TriSolveAuto);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_spmv(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Enforce multiple threads such that the SpMV is split into several parts
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+        ncol = nrow;
+    }
+    else if(matrix_type == "PermutedIdentity")
+    {
+        nrow = gen_permuted_identity(size, &csr_ptr, &csr_col, &csr_val);
+        ncol = nrow;
+    }
+    else if(matrix_type == "Random")
+    {
+        nrow = gen_random(100 * size, 50 * size, 6, &csr_ptr, &csr_col, &csr_val);
+        ncol = 50 * size;
+    }
+    else
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> y_ref;
+
+    x.Allocate("x", ncol);
+    y.Allocate("y", nrow);
+    y_ref.Allocate("y_ref", nrow);
+
+    x.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+    // Reference computed by the row-parallel SpMV of a single threaded matrix
+    set_omp_threads_rocalution(1);
+
+    LocalMatrix<T> A_ref;
+    A_ref.AllocateCSR("A_ref", nnz, nrow, ncol);
+    A_ref.CopyFrom(A);
+
+    bool success = true;
+
+    A_ref.Apply(x, &y_ref);
+
+    // Second product reuses the cached partition
+    for(int i = 0; i < 2; ++i)
+    {
+        A.Apply(x, &y);
+        success &= check_relative_error(y, y_ref);
+    }
+
+    y.CopyFrom(y_ref);
+    A.ApplyAdd(x, static_cast<T>(-2), &y);
+    A_ref.ApplyAdd(x, static_cast<T>(-2), &y_ref);
+    success &= check_relative_error(y, y_ref);
+
+    // SELL
+    A.ConvertToSELL();
+    A_ref.Apply(x, &y_ref);
+    A.Apply(x, &y);
+    success &= check_relative_error(y, y_ref);
+
+    y.CopyFrom(y_ref);
+    A.ApplyAdd(x, static_cast<T>(-2), &y);
+    A_ref.ApplyAdd(x, static_cast<T>(-2), &y_ref);
+    success &= check_relative_error(y, y_ref);
+
+    // BCSR, fixed size kernels for block dimensions 2 to 8, generic kernel otherwise
+    if(nrow == ncol)
+    {
+        LocalVector<T> d;
+        LocalVector<T> d_ref;
+
+        A_ref.ExtractDiagonal(&d_ref);
+
+        for(int blockdim = 2; blockdim <= 9; ++blockdim)
+        {
+            if(nrow % blockdim != 0)
+            {
+                continue;
+            }
+
+            A.ConvertToCSR();
+            A.ConvertToBCSR(blockdim);
+            A_ref.Apply(x, &y_ref);
+            A.Apply(x, &y);
+            success &= check_relative_error(y, y_ref);
+
+            y.CopyFrom(y_ref);
+            A.ApplyAdd(x, static_cast<T>(-2), &y);
+            A_ref.ApplyAdd(x, static_cast<T>(-2), &y_ref);
+            success &= check_relative_error(y, y_ref);
+
+            A.ExtractDiagonal(&d);
+            success &= check_relative_error(d, d_ref);
+        }
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_spmm(Arguments argus)
+{
+    int         size        = argus.size;
+    int         nvectors    = argus.nvectors;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Enforce multiple threads
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+        ncol = nrow;
+    }
+    else if(matrix_type == "PermutedIdentity")
+    {
+        nrow = gen_permuted_identity(size, &csr_ptr, &csr_col, &csr_val);
+        ncol = nrow;
+    }
+    else if(matrix_type == "Random")
+    {
+        nrow = gen_random(100 * size, 50 * size, 6, &csr_ptr, &csr_col, &csr_val);
+        ncol = 50 * size;
+    }
+    else
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    LocalMultiVector<T> X;
+    LocalMultiVector<T> Y;
+
+    X.Allocate("X", ncol, nvectors);
+    Y.Allocate("Y", nrow, nvectors);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> y_ref;
+
+    x.Allocate("x", ncol);
+    y_ref.Allocate("y_ref", nrow);
+
+    for(int j = 0; j < nvectors; ++j)
+    {
+        x.SetRandomUniform(12345ULL + j, -1.0, 1.0);
+        X.CopyFromVector(j, x);
+    }
+
+    bool success = true;
+
+    // Each vector has to match the SpMV, in CSR and through the CSR fallback
+    for(int format = 0; format < 2; ++format)
+    {
+        if(format == 1)
+        {
+            A.ConvertToCOO();
+        }
+
+        A.Apply(X, &Y);
+
+        for(int j = 0; j < nvectors; ++j)
+        {
+            X.CopyToVector(j, &x);
+            A.Apply(x, &y_ref);
+            Y.CopyToVector(j, &y);
+
+            success &= check_relative_error(y, y_ref);
+        }
+
+        A.ApplyAdd(X, static_cast<T>(-2), &Y);
+
+        for(int j = 0; j < nvectors; ++j)
+        {
+            X.CopyToVector(j, &x);
+            A.Apply(x, &y_ref);
+            y_ref.Scale(static_cast<T>(-1));
+            Y.CopyToVector(j, &y);
+
+            success &= check_relative_error(y, y_ref);
+        }
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_powers(Arguments argus)
+{
+    int         size        = argus.size;
+    int         k           = argus.sstep;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Enforce multiple threads
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else if(matrix_type == "PermutedIdentity")
+    {
+        nrow = gen_permuted_identity(size, &csr_ptr, &csr_col, &csr_val);
+    }
+    else
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    LocalVector<T> x;
+    LocalVector<T> y_ref;
+
+    x.Allocate("x", nrow);
+    y_ref.Allocate("y_ref", nrow);
+
+    x.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+    std::vector<LocalVector<T>>  y(k);
+    std::vector<LocalVector<T>*> y_ptr(k);
+
+    for(int l = 0; l < k; ++l)
+    {
+        y[l].Allocate("y", nrow);
+        y_ptr[l] = &y[l];
+    }
+
+    std::vector<T> shift(k);
+
+    for(int l = 0; l < k; ++l)
+    {
+        shift[l] = static_cast<T>(0.5 * l);
+    }
+
+    bool success = true;
+
+    // Each power has to match consecutive SpMVs, in CSR and through the fallback
+    for(int format = 0; format < 2; ++format)
+    {
+        if(format == 1)
+        {
+            A.ConvertToCOO();
+        }
+
+        for(int shifted = 0; shifted < 2; ++shifted)
+        {
+            A.MatrixPowers(x, k, (shifted == 1) ? &shift[0] : NULL, &y_ptr[0]);
+
+            for(int l = 0; l < k; ++l)
+            {
+                const LocalVector<T>& prev = (l == 0) ? x : y[l - 1];
+
+                A.Apply(prev, &y_ref);
+
+                if(shifted == 1)
+                {
+                    y_ref.AddScale(prev, -shift[l]);
+                }
+
+                success &= check_relative_error(y[l], y_ref);
+            }
+        }
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_fused(Arguments argus)
+{
+    int         size        = argus.size;
+    std::string matrix_type = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Enforce multiple threads
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = 0;
+    int ncol = 0;
+    if(matrix_type == "Laplacian2D")
+    {
+        nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+        ncol = nrow;
+    }
+    else if(matrix_type == "PermutedIdentity")
+    {
+        nrow = gen_permuted_identity(size, &csr_ptr, &csr_col, &csr_val);
+        ncol = nrow;
+    }
+    else if(matrix_type == "Random")
+    {
+        nrow = gen_random(100 * size, 50 * size, 6, &csr_ptr, &csr_col, &csr_val);
+        ncol = 50 * size;
+    }
+    else
+    {
+        return false;
+    }
+
+    int nnz = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, ncol);
+
+    LocalVector<T> in;
+    LocalVector<T> x;
+    LocalVector<T> b;
+    LocalVector<T> y;
+    LocalVector<T> y_ref;
+
+    in.Allocate("in", ncol);
+    x.Allocate("x", nrow);
+    b.Allocate("b", nrow);
+    y.Allocate("y", nrow);
+    y_ref.Allocate("y_ref", nrow);
+
+    in.SetRandomUniform(12345ULL, -1.0, 1.0);
+    x.SetRandomUniform(67890ULL, -1.0, 1.0);
+    b.SetRandomUniform(13579ULL, -1.0, 1.0);
+
+    bool success = true;
+
+    // The fused operations have to match the separate ones, in CSR and through the fallback
+    for(int format = 0; format < 2; ++format)
+    {
+        if(format == 1)
+        {
+            A.ConvertToCOO();
+        }
+
+        A.Apply(in, &y_ref);
+
+        T dot_ref = x.Dot(y_ref);
+        T dot     = A.ApplyDot(in, x, &y);
+
+        success &= check_relative_error(y, y_ref);
+        success &= check_relative_error(dot, dot_ref);
+
+        dot_ref = x.DotNonConj(y_ref);
+        dot     = A.ApplyDotNonConj(in, x, &y);
+
+        success &= check_relative_error(y, y_ref);
+        success &= check_relative_error(dot, dot_ref);
+
+        y_ref.ScaleAdd(static_cast<T>(-1), b);
+
+        T nrm_ref = y_ref.Norm();
+        T nrm     = A.ResidualNorm(b, in, &y);
+
+        success &= check_relative_error(y, y_ref);
+        success &= check_relative_error(nrm, nrm_ref);
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_LOCAL_MATRIX_HPP
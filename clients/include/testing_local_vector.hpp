@@ -44,6 +44,11 @@ void testing_local_vector_bad_args(void)
     // LocalVector object
     LocalVector<T> vec;
 
+    // AllocateUninitialized
+    {
+        ASSERT_DEATH(vec.AllocateUninitialized("", -1), ".*Assertion.*size >= 0*");
+    }
+
     // SetDataPtr
     {
         T* null_ptr = nullptr;
@@ -120,8 +125,285 @@ void testing_local_vector_bad_args(void)
         free_host(&vint);
     }
 
+    // LinearCombination
+    {
+        T                      alpha  = static_cast<T>(1);
+        const LocalVector<T>*  x      = &vec;
+        T*                     null_T = nullptr;
+        const LocalVector<T>** null_x = nullptr;
+        ASSERT_DEATH(vec.LinearCombination(1, null_T, &x),
+                     ".*Assertion.*alpha != (NULL|__null)*");
+        ASSERT_DEATH(vec.LinearCombination(1, &alpha, null_x), ".*Assertion.*x != (NULL|__null)*");
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
+template <typename T>
+bool testing_local_vector_expression(Arguments argus)
+{
+    int size = argus.size;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Enforce multiple threads
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> z;
+    LocalVector<T> w;
+    LocalVector<T> ref;
+    LocalVector<T> diff;
+
+    x.Allocate("x", size);
+    y.Allocate("y", size);
+    z.Allocate("z", size);
+    w.Allocate("w", size);
+    ref.Allocate("ref", size);
+    diff.Allocate("diff", size);
+
+    y.SetRandomUniform(12345ULL, -1.0, 1.0);
+    z.SetRandomUniform(67890ULL, -1.0, 1.0);
+    w.SetRandomUniform(13579ULL, -1.0, 1.0);
+
+    T a = static_cast<T>(2);
+    T b = static_cast<T>(-0.5);
+    T c = static_cast<T>(3);
+
+    bool success = true;
+
+    // x = a * y + b * z - c * w
+    x = a * y + b * z - c * w;
+
+    ref.CopyFrom(y);
+    ref.ScaleAdd2(a, z, b, w, -c);
+
+    diff.CopyFrom(x);
+    diff.ScaleAdd(static_cast<T>(-1), ref);
+    success &= std::abs(diff.Norm()) <= 1e-5 * std::abs(ref.Norm());
+
+    // x = 2 * (x - y) + z * c, x appears on the right hand side
+    x = static_cast<T>(2) * (x - y) + z * c;
+
+    ref.AddScale(y, static_cast<T>(-1));
+    ref.ScaleAdd2(static_cast<T>(2), z, c, z, static_cast<T>(0));
+
+    diff.CopyFrom(x);
+    diff.ScaleAdd(static_cast<T>(-1), ref);
+    success &= std::abs(diff.Norm()) <= 1e-5 * std::abs(ref.Norm());
+
+    // x += y - a * w
+    x += y - a * w;
+
+    ref.ScaleAdd2(static_cast<T>(1), y, static_cast<T>(1), w, -a);
+
+    diff.CopyFrom(x);
+    diff.ScaleAdd(static_cast<T>(-1), ref);
+    success &= std::abs(diff.Norm()) <= 1e-5 * std::abs(ref.Norm());
+
+    // x -= -z
+    x -= -z;
+
+    ref.AddScale(z, static_cast<T>(1));
+
+    diff.CopyFrom(x);
+    diff.ScaleAdd(static_cast<T>(-1), ref);
+    success &= std::abs(diff.Norm()) <= 1e-5 * std::abs(ref.Norm());
+
     // Stop rocALUTION
     stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_vector_thread_team(Arguments argus)
+{
+    int size = argus.size;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    set_omp_threads_rocalution(4);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    // Reference results using OpenMP
+    LocalMatrix<T> A_ref;
+    LocalVector<T> x_ref;
+    LocalVector<T> y_ref;
+
+    A_ref.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+    x_ref.Allocate("x", nrow);
+    y_ref.Allocate("y", nrow);
+
+    x_ref.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+    A_ref.Apply(x_ref, &y_ref);
+    y_ref.ScaleAddScale(static_cast<T>(2), x_ref, static_cast<T>(-0.5));
+    A_ref.ApplyAdd(y_ref, static_cast<T>(0.25), &x_ref);
+
+    T dot_ref  = x_ref.Dot(y_ref);
+    T norm_ref = y_ref.Norm();
+
+    // Objects created after enabling the team use it
+    set_omp_thread_team_rocalution(true, 64);
+
+    LocalMatrix<T> A;
+    LocalVector<T> x;
+    LocalVector<T> y;
+
+    A.CloneFrom(A_ref);
+    x.Allocate("x", nrow);
+    y.Allocate("y", nrow);
+
+    x.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+    A.Apply(x, &y);
+    y.ScaleAddScale(static_cast<T>(2), x, static_cast<T>(-0.5));
+    A.ApplyAdd(y, static_cast<T>(0.25), &x);
+
+    T dot  = x.Dot(y);
+    T norm = y.Norm();
+
+    bool success = true;
+
+    success &= std::abs(dot - dot_ref) <= 1e-4 * std::max(std::abs(dot_ref), static_cast<T>(1));
+    success &= std::abs(norm - norm_ref) <= 1e-4 * std::abs(norm_ref);
+
+    x.ScaleAdd(static_cast<T>(-1), x_ref);
+    success &= std::abs(x.Norm()) <= 1e-4 * std::abs(x_ref.Norm());
+
+    // Objects created before and after changing the number of threads can be mixed
+    set_omp_threads_rocalution(2);
+
+    LocalVector<T> v;
+
+    v.CloneFrom(y);
+
+    T dot_v = v.Dot(y_ref);
+
+    dot = y.Dot(y_ref);
+
+    success &= std::abs(dot_v - dot) <= 1e-4 * std::max(std::abs(dot), static_cast<T>(1));
+
+    set_omp_threads_rocalution(4);
+
+    // Objects created after enabling first-touch placement are initialized in parallel
+    set_omp_first_touch_rocalution(true);
+
+    LocalMatrix<T> B;
+    LocalVector<T> z;
+    LocalVector<T> w;
+
+    B.CloneFrom(A_ref);
+    z.Allocate("z", nrow);
+    w.Allocate("w", nrow);
+
+    success &= (z.Norm() == static_cast<T>(0));
+
+    z.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+    B.Apply(z, &w);
+    w.ScaleAddScale(static_cast<T>(2), z, static_cast<T>(-0.5));
+    B.ApplyAdd(w, static_cast<T>(0.25), &z);
+
+    dot  = z.Dot(w);
+    norm = w.Norm();
+
+    success &= std::abs(dot - dot_ref) <= 1e-4 * std::max(std::abs(dot_ref), static_cast<T>(1));
+    success &= std::abs(norm - norm_ref) <= 1e-4 * std::abs(norm_ref);
+
+    set_omp_first_touch_rocalution(false);
+    set_omp_thread_team_rocalution(false);
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_vector_allocate_uninitialized(Arguments argus)
+{
+    int size = argus.size;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Enforce multiple threads
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(size, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    LocalVector<T> x;
+    LocalVector<T> y_ref;
+
+    x.Allocate("x", nrow);
+    y_ref.Allocate("y_ref", nrow);
+
+    x.SetRandomUniform(12345ULL, -1.0, 1.0);
+    A.Apply(x, &y_ref);
+
+    bool success = true;
+
+    // Fill and free a vector, such that a following allocation likely reuses its memory
+    {
+        LocalVector<T> tmp;
+
+        tmp.Allocate("tmp", nrow);
+        tmp.Ones();
+    }
+
+    // Allocate has to zero the vector
+    LocalVector<T> z;
+
+    z.Allocate("z", nrow);
+    success &= (z.Norm() == static_cast<T>(0));
+
+    // Copy into an uninitialized vector
+    LocalVector<T> u;
+
+    u.AllocateUninitialized("u", nrow);
+    u.CopyFrom(x);
+    u.ScaleAdd(static_cast<T>(-1), x);
+    success &= (u.Norm() == static_cast<T>(0));
+
+    // Matrix-vector product into an uninitialized vector
+    LocalVector<T> y;
+
+    y.AllocateUninitialized("y", nrow);
+    A.Apply(x, &y);
+    y.ScaleAdd(static_cast<T>(-1), y_ref);
+    success &= (y.Norm() == static_cast<T>(0));
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
 }
 
 #endif // TESTING_LOCAL_VECTOR_HPP
@@ -251,7 +251,7 @@ int gen_random(int m, int n, int max_nnz_per_row, int** rowptr, int** col, T** v
 
         for(int j = row_start; j < row_end; j++)
         {
-            (*col)[j] = random_generator<int>(0, n);
+            (*col)[j] = random_generator<int>(0, n - 1);
             (*val)[j] = random_generator<T>();
         }
     }
@@ -299,6 +299,7 @@ public:
     int omp_nthreads  = 8;
     int omp_affinity  = true;
     int omp_threshold = 50000;
+    int omp_trisolve  = 0;
 
     // Accelerator variables
     int dev     = 0;
@@ -309,6 +310,7 @@ public:
     int index      = 50;
     int chunk_size = 20;
     int blockdim   = 4;
+    int nvectors   = 1;
 
     // Computation variables
     double alpha = 1.0;
@@ -328,6 +330,8 @@ public:
     int ordering       = 1;
     int cycle          = 0;
     int rebuildnumeric = 0;
+    int orthogonal     = 0;
+    int sstep          = 4;
 
     unsigned int format;
 
@@ -339,6 +343,7 @@ public:
         this->omp_nthreads  = rhs.omp_nthreads;
         this->omp_affinity  = rhs.omp_affinity;
         this->omp_threshold = rhs.omp_threshold;
+        this->omp_trisolve  = rhs.omp_trisolve;
 
         this->dev     = rhs.dev;
         this->use_acc = rhs.use_acc;
@@ -363,6 +368,8 @@ public:
         this->ordering       = rhs.ordering;
         this->cycle          = rhs.cycle;
         this->rebuildnumeric = rhs.rebuildnumeric;
+        this->orthogonal     = rhs.orthogonal;
+        this->sstep          = rhs.sstep;
 
         this->coarsening_strategy = rhs.coarsening_strategy;
 
@@ -63,6 +63,26 @@ TEST(backend_init_order, backend)
     testing_backend_init_order();
 }
 
+TEST(backend_calibration, backend)
+{
+    testing_backend_calibration();
+}
+
+TEST(backend_host_allocator, backend)
+{
+    testing_backend_host_allocator();
+}
+
+TEST(backend_host_memory_pool, backend)
+{
+    testing_backend_host_memory_pool();
+}
+
+TEST(backend_memory_usage, backend)
+{
+    testing_backend_memory_usage();
+}
+
 TEST_P(parameterized_backend, backend)
 {
     Arguments arg = setup_backend_arguments(GetParam());
@@ -28,9 +28,10 @@
 
 typedef std::tuple<int, std::string, unsigned int> cg_tuple;
 
-int          cg_size[]    = {7, 63};
-std::string  cg_precond[] = {"None", "FSAI", "SPAI", "TNS", "Jacobi", "IC", "MCSGS"};
-unsigned int cg_format[]  = {1, 3, 4, 6};
+int         cg_size[] = {7, 63};
+std::string cg_precond[]
+    = {"None", "FSAI", "SPAI", "TNS", "Jacobi", "IC", "ICJacobi", "ICFixedPoint", "MCSGS"};
+unsigned int cg_format[] = {1, 3, 4, 6, 8};
 
 class parameterized_cg : public testing::TestWithParam<cg_tuple>
 {
@@ -28,9 +28,10 @@
 
 typedef std::tuple<int, std::string, unsigned int> cr_tuple;
 
-int          cr_size[]    = {7, 63};
-std::string  cr_precond[] = {"None", "Chebyshev", "FSAI", "Jacobi", "SGS", "ILU", "IC", "MCSGS"};
-unsigned int cr_format[]  = {2, 4, 7};
+int         cr_size[] = {7, 63};
+std::string cr_precond[]
+    = {"None", "Chebyshev", "FSAI", "Jacobi", "SGS", "ILU", "ILUJacobi", "IC", "MCSGS"};
+unsigned int cr_format[] = {2, 4, 7};
 
 class parameterized_cr : public testing::TestWithParam<cr_tuple>
 {
@@ -29,7 +29,7 @@
 typedef std::tuple<int, std::string, unsigned int> fcg_tuple;
 
 int          fcg_size[]    = {7, 63};
-std::string  fcg_precond[] = {"None", "Chebyshev", "SPAI", "TNS", "ILUT", "MCSGS"};
+std::string  fcg_precond[] = {"None", "Chebyshev", "SPAI", "TNS", "ILUT", "ILUTPartition", "MCSGS"};
 unsigned int fcg_format[]  = {2, 5, 6, 7};
 
 class parameterized_fcg : public testing::TestWithParam<fcg_tuple>
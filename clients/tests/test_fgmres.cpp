@@ -28,10 +28,11 @@
 
 typedef std::tuple<int, int, std::string, unsigned int> fgmres_tuple;
 
-int          fgmres_size[]    = {7, 63};
-int          fgmres_basis[]   = {20, 60};
-std::string  fgmres_precond[] = {"None", "SPAI", "TNS", "Jacobi", "GS", "ILUT", "MCGS"};
-unsigned int fgmres_format[]  = {1, 4, 5, 7};
+int          fgmres_size[]         = {7, 63};
+int          fgmres_basis[]        = {20, 60};
+std::string  fgmres_precond[]      = {"None", "SPAI", "TNS", "Jacobi", "GS", "ILUT", "MCGS"};
+std::string  fgmres_cgs2_precond[] = {"None", "Jacobi", "ILUT"};
+unsigned int fgmres_format[]       = {1, 4, 5, 7};
 
 class parameterized_fgmres : public testing::TestWithParam<fgmres_tuple>
 {
@@ -41,6 +42,14 @@ protected:
     virtual void SetUp() {}
     virtual void TearDown() {}
 };
+class parameterized_fgmres_cgs2 : public testing::TestWithParam<fgmres_tuple>
+{
+protected:
+    parameterized_fgmres_cgs2() {}
+    virtual ~parameterized_fgmres_cgs2() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
 
 Arguments setup_fgmres_arguments(fgmres_tuple tup)
 {
@@ -64,9 +73,30 @@ TEST_P(parameterized_fgmres, fgmres_double)
     ASSERT_EQ(testing_fgmres<double>(arg), true);
 }
 
+TEST_P(parameterized_fgmres_cgs2, fgmres_float)
+{
+    Arguments arg  = setup_fgmres_arguments(GetParam());
+    arg.orthogonal = CGS2;
+    ASSERT_EQ(testing_fgmres<float>(arg), true);
+}
+
+TEST_P(parameterized_fgmres_cgs2, fgmres_double)
+{
+    Arguments arg  = setup_fgmres_arguments(GetParam());
+    arg.orthogonal = CGS2;
+    ASSERT_EQ(testing_fgmres<double>(arg), true);
+}
+
 INSTANTIATE_TEST_CASE_P(fgmres,
                         parameterized_fgmres,
                         testing::Combine(testing::ValuesIn(fgmres_size),
                                          testing::ValuesIn(fgmres_basis),
                                          testing::ValuesIn(fgmres_precond),
                                          testing::ValuesIn(fgmres_format)));
+
+INSTANTIATE_TEST_CASE_P(fgmres_cgs2,
+                        parameterized_fgmres_cgs2,
+                        testing::Combine(testing::ValuesIn(fgmres_size),
+                                         testing::ValuesIn(fgmres_basis),
+                                         testing::ValuesIn(fgmres_cgs2_precond),
+                                         testing::ValuesIn(fgmres_format)));
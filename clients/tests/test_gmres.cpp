@@ -32,9 +32,10 @@ int          gmres_size[]               = {7, 63};
 int          gmres_basis[]              = {20, 60};
 std::string  gmres_matrix[]             = {"laplacian"};
 std::string  gmres_bad_precond_matrix[] = {"permuted_identity"};
-std::string  gmres_precond[]     = {"None", "Chebyshev", "GS", "ILU", "ILUT", "MCGS", "MCILU"};
-std::string  gmres_bad_precond[] = {"MCGS"};
-unsigned int gmres_format[]      = {1, 2, 5, 6};
+std::string  gmres_precond[]      = {"None", "Chebyshev", "GS", "ILU", "ILUT", "MCGS", "MCILU"};
+std::string  gmres_bad_precond[]  = {"MCGS"};
+std::string  gmres_cgs2_precond[] = {"None", "ILU", "MCGS"};
+unsigned int gmres_format[]       = {1, 2, 5, 6};
 
 class parameterized_gmres : public testing::TestWithParam<gmres_tuple>
 {
@@ -44,6 +45,14 @@ protected:
     virtual void SetUp() {}
     virtual void TearDown() {}
 };
+class parameterized_gmres_cgs2 : public testing::TestWithParam<gmres_tuple>
+{
+protected:
+    parameterized_gmres_cgs2() {}
+    virtual ~parameterized_gmres_cgs2() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
 
 class parameterized_gmres_bad_precond : public testing::TestWithParam<gmres_tuple>
 {
@@ -77,6 +86,20 @@ TEST_P(parameterized_gmres, gmres_double)
     ASSERT_EQ(testing_gmres<double>(arg), true);
 }
 
+TEST_P(parameterized_gmres_cgs2, gmres_float)
+{
+    Arguments arg  = setup_gmres_arguments(GetParam());
+    arg.orthogonal = CGS2;
+    ASSERT_EQ(testing_gmres<float>(arg), true);
+}
+
+TEST_P(parameterized_gmres_cgs2, gmres_double)
+{
+    Arguments arg  = setup_gmres_arguments(GetParam());
+    arg.orthogonal = CGS2;
+    ASSERT_EQ(testing_gmres<double>(arg), true);
+}
+
 TEST_P(parameterized_gmres_bad_precond, gmres_float)
 {
     Arguments arg = setup_gmres_arguments(GetParam());
@@ -98,3 +121,11 @@ INSTANTIATE_TEST_CASE_P(gmres_bad_precond,
                                          testing::ValuesIn(gmres_bad_precond_matrix),
                                          testing::ValuesIn(gmres_bad_precond),
                                          testing::ValuesIn(gmres_format)));
+
+INSTANTIATE_TEST_CASE_P(gmres_cgs2,
+                        parameterized_gmres_cgs2,
+                        testing::Combine(testing::ValuesIn(gmres_size),
+                                         testing::ValuesIn(gmres_basis),
+                                         testing::ValuesIn(gmres_matrix),
+                                         testing::ValuesIn(gmres_cgs2_precond),
+                                         testing::ValuesIn(gmres_format)));
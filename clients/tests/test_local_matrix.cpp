@@ -28,6 +28,11 @@
 
 typedef std::tuple<int, int, std::string> local_matrix_conversions_tuple;
 typedef std::tuple<int, int>              local_matrix_allocations_tuple;
+typedef std::tuple<int, int>              local_matrix_triangular_solves_tuple;
+typedef std::tuple<int, std::string>      local_matrix_spmv_tuple;
+typedef std::tuple<int, int, std::string> local_matrix_spmm_tuple;
+typedef std::tuple<int, int, std::string> local_matrix_powers_tuple;
+typedef std::tuple<int, std::string>      local_matrix_fused_tuple;
 
 int         local_matrix_conversions_size[]     = {10, 17, 21};
 int         local_matrix_conversions_blockdim[] = {4, 7, 11};
@@ -36,6 +41,20 @@ std::string local_matrix_type[]                 = {"Laplacian2D", "PermutedIdent
 int local_matrix_allocations_size[]     = {100, 1475, 2524};
 int local_matrix_allocations_blockdim[] = {4, 7, 11};
 
+int local_matrix_triangular_solves_size[] = {7, 21};
+int local_matrix_triangular_solves_alg[]  = {0, 1, 2, 3};
+
+int local_matrix_spmv_size[] = {10, 63};
+
+int local_matrix_spmm_size[]     = {10, 63};
+int local_matrix_spmm_nvectors[] = {1, 4, 13};
+
+int         local_matrix_powers_size[] = {10, 63, 200};
+int         local_matrix_powers_k[]    = {1, 4, 7};
+std::string local_matrix_powers_type[] = {"Laplacian2D", "PermutedIdentity"};
+
+int local_matrix_fused_size[] = {10, 63, 200};
+
 class parameterized_local_matrix_conversions
     : public testing::TestWithParam<local_matrix_conversions_tuple>
 {
@@ -73,6 +92,94 @@ Arguments setup_local_matrix_allocations_arguments(local_matrix_allocations_tupl
     return arg;
 }
 
+class parameterized_local_matrix_triangular_solves
+    : public testing::TestWithParam<local_matrix_triangular_solves_tuple>
+{
+protected:
+    parameterized_local_matrix_triangular_solves() {}
+    virtual ~parameterized_local_matrix_triangular_solves() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_triangular_solves_arguments(local_matrix_triangular_solves_tuple tup)
+{
+    Arguments arg;
+    arg.size         = std::get<0>(tup);
+    arg.omp_trisolve = std::get<1>(tup);
+    return arg;
+}
+
+class parameterized_local_matrix_spmv : public testing::TestWithParam<local_matrix_spmv_tuple>
+{
+protected:
+    parameterized_local_matrix_spmv() {}
+    virtual ~parameterized_local_matrix_spmv() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_spmv_arguments(local_matrix_spmv_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
+class parameterized_local_matrix_spmm : public testing::TestWithParam<local_matrix_spmm_tuple>
+{
+protected:
+    parameterized_local_matrix_spmm() {}
+    virtual ~parameterized_local_matrix_spmm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_spmm_arguments(local_matrix_spmm_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.nvectors    = std::get<1>(tup);
+    arg.matrix_type = std::get<2>(tup);
+    return arg;
+}
+
+class parameterized_local_matrix_powers : public testing::TestWithParam<local_matrix_powers_tuple>
+{
+protected:
+    parameterized_local_matrix_powers() {}
+    virtual ~parameterized_local_matrix_powers() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_powers_arguments(local_matrix_powers_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.sstep       = std::get<1>(tup);
+    arg.matrix_type = std::get<2>(tup);
+    return arg;
+}
+
+class parameterized_local_matrix_fused : public testing::TestWithParam<local_matrix_fused_tuple>
+{
+protected:
+    parameterized_local_matrix_fused() {}
+    virtual ~parameterized_local_matrix_fused() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_matrix_fused_arguments(local_matrix_fused_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    return arg;
+}
+
 TEST(local_matrix_bad_args, local_matrix)
 {
     testing_local_matrix_bad_args<float>();
@@ -112,3 +219,90 @@ INSTANTIATE_TEST_CASE_P(local_matrix_allocations,
                         parameterized_local_matrix_allocations,
                         testing::Combine(testing::ValuesIn(local_matrix_allocations_size),
                                          testing::ValuesIn(local_matrix_allocations_blockdim)));
+
+TEST_P(parameterized_local_matrix_triangular_solves, local_matrix_triangular_solves_float)
+{
+    Arguments arg = setup_local_matrix_triangular_solves_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_triangular_solves<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_triangular_solves, local_matrix_triangular_solves_double)
+{
+    Arguments arg = setup_local_matrix_triangular_solves_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_triangular_solves<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_triangular_solves,
+                        parameterized_local_matrix_triangular_solves,
+                        testing::Combine(testing::ValuesIn(local_matrix_triangular_solves_size),
+                                         testing::ValuesIn(local_matrix_triangular_solves_alg)));
+
+TEST_P(parameterized_local_matrix_spmv, local_matrix_spmv_float)
+{
+    Arguments arg = setup_local_matrix_spmv_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_spmv<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_spmv, local_matrix_spmv_double)
+{
+    Arguments arg = setup_local_matrix_spmv_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_spmv<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_spmv,
+                        parameterized_local_matrix_spmv,
+                        testing::Combine(testing::ValuesIn(local_matrix_spmv_size),
+                                         testing::ValuesIn(local_matrix_type)));
+
+TEST_P(parameterized_local_matrix_spmm, local_matrix_spmm_float)
+{
+    Arguments arg = setup_local_matrix_spmm_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_spmm<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_spmm, local_matrix_spmm_double)
+{
+    Arguments arg = setup_local_matrix_spmm_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_spmm<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_spmm,
+                        parameterized_local_matrix_spmm,
+                        testing::Combine(testing::ValuesIn(local_matrix_spmm_size),
+                                         testing::ValuesIn(local_matrix_spmm_nvectors),
+                                         testing::ValuesIn(local_matrix_type)));
+
+TEST_P(parameterized_local_matrix_powers, local_matrix_powers_float)
+{
+    Arguments arg = setup_local_matrix_powers_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_powers<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_powers, local_matrix_powers_double)
+{
+    Arguments arg = setup_local_matrix_powers_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_powers<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_powers,
+                        parameterized_local_matrix_powers,
+                        testing::Combine(testing::ValuesIn(local_matrix_powers_size),
+                                         testing::ValuesIn(local_matrix_powers_k),
+                                         testing::ValuesIn(local_matrix_powers_type)));
+
+TEST_P(parameterized_local_matrix_fused, local_matrix_fused_float)
+{
+    Arguments arg = setup_local_matrix_fused_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_fused<float>(arg), true);
+}
+
+TEST_P(parameterized_local_matrix_fused, local_matrix_fused_double)
+{
+    Arguments arg = setup_local_matrix_fused_arguments(GetParam());
+    ASSERT_EQ(testing_local_matrix_fused<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_matrix_fused,
+                        parameterized_local_matrix_fused,
+                        testing::Combine(testing::ValuesIn(local_matrix_fused_size),
+                                         testing::ValuesIn(local_matrix_type)));
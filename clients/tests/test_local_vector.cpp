@@ -58,10 +58,125 @@ Arguments setup_backend_arguments(backend_tuple tup)
     return arg;
 }
 */
+typedef std::tuple<int> local_vector_expression_tuple;
+
+int local_vector_expression_size[] = {1, 100, 12345};
+
+typedef std::tuple<int> local_vector_thread_team_tuple;
+
+int local_vector_thread_team_size[] = {5, 40, 200};
+
+typedef std::tuple<int> local_vector_allocate_uninitialized_tuple;
+
+int local_vector_allocate_uninitialized_size[] = {1, 10, 100};
+
+class parameterized_local_vector_expression
+    : public testing::TestWithParam<local_vector_expression_tuple>
+{
+protected:
+    parameterized_local_vector_expression() {}
+    virtual ~parameterized_local_vector_expression() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_local_vector_thread_team
+    : public testing::TestWithParam<local_vector_thread_team_tuple>
+{
+protected:
+    parameterized_local_vector_thread_team() {}
+    virtual ~parameterized_local_vector_thread_team() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_local_vector_allocate_uninitialized
+    : public testing::TestWithParam<local_vector_allocate_uninitialized_tuple>
+{
+protected:
+    parameterized_local_vector_allocate_uninitialized() {}
+    virtual ~parameterized_local_vector_allocate_uninitialized() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_vector_expression_arguments(local_vector_expression_tuple tup)
+{
+    Arguments arg;
+    arg.size = std::get<0>(tup);
+    return arg;
+}
+
+Arguments setup_local_vector_thread_team_arguments(local_vector_thread_team_tuple tup)
+{
+    Arguments arg;
+    arg.size = std::get<0>(tup);
+    return arg;
+}
+
+Arguments setup_local_vector_allocate_uninitialized_arguments(
+    local_vector_allocate_uninitialized_tuple tup)
+{
+    Arguments arg;
+    arg.size = std::get<0>(tup);
+    return arg;
+}
+
 TEST(local_vector_bad_args, local_vector)
 {
     testing_local_vector_bad_args<float>();
 }
+
+TEST_P(parameterized_local_vector_expression, local_vector_expression_float)
+{
+    Arguments arg = setup_local_vector_expression_arguments(GetParam());
+    ASSERT_EQ(testing_local_vector_expression<float>(arg), true);
+}
+
+TEST_P(parameterized_local_vector_expression, local_vector_expression_double)
+{
+    Arguments arg = setup_local_vector_expression_arguments(GetParam());
+    ASSERT_EQ(testing_local_vector_expression<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_vector_expression,
+                        parameterized_local_vector_expression,
+                        testing::Combine(testing::ValuesIn(local_vector_expression_size)));
+
+TEST_P(parameterized_local_vector_thread_team, local_vector_thread_team_float)
+{
+    Arguments arg = setup_local_vector_thread_team_arguments(GetParam());
+    ASSERT_EQ(testing_local_vector_thread_team<float>(arg), true);
+}
+
+TEST_P(parameterized_local_vector_thread_team, local_vector_thread_team_double)
+{
+    Arguments arg = setup_local_vector_thread_team_arguments(GetParam());
+    ASSERT_EQ(testing_local_vector_thread_team<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_vector_thread_team,
+                        parameterized_local_vector_thread_team,
+                        testing::Combine(testing::ValuesIn(local_vector_thread_team_size)));
+
+TEST_P(parameterized_local_vector_allocate_uninitialized,
+       local_vector_allocate_uninitialized_float)
+{
+    Arguments arg = setup_local_vector_allocate_uninitialized_arguments(GetParam());
+    ASSERT_EQ(testing_local_vector_allocate_uninitialized<float>(arg), true);
+}
+
+TEST_P(parameterized_local_vector_allocate_uninitialized,
+       local_vector_allocate_uninitialized_double)
+{
+    Arguments arg = setup_local_vector_allocate_uninitialized_arguments(GetParam());
+    ASSERT_EQ(testing_local_vector_allocate_uninitialized<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    local_vector_allocate_uninitialized,
+    parameterized_local_vector_allocate_uninitialized,
+    testing::Combine(testing::ValuesIn(local_vector_allocate_uninitialized_size)));
 /*
 TEST_P(parameterized_backend, backend)
 {
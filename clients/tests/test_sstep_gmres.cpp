@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_sstep_gmres.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+
+typedef std::tuple<int, int, int, std::string, unsigned int> sstep_gmres_tuple;
+
+int          sstep_gmres_size[]    = {7, 63};
+int          sstep_gmres_basis[]   = {20, 60};
+int          sstep_gmres_sstep[]   = {3, 5};
+std::string  sstep_gmres_precond[] = {"None", "Jacobi", "ILU", "MCGS"};
+unsigned int sstep_gmres_format[]  = {1, 2, 6};
+
+class parameterized_sstep_gmres : public testing::TestWithParam<sstep_gmres_tuple>
+{
+protected:
+    parameterized_sstep_gmres() {}
+    virtual ~parameterized_sstep_gmres() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_sstep_gmres_arguments(sstep_gmres_tuple tup)
+{
+    Arguments arg;
+    arg.size    = std::get<0>(tup);
+    arg.index   = std::get<1>(tup);
+    arg.sstep   = std::get<2>(tup);
+    arg.matrix  = "laplacian";
+    arg.precond = std::get<3>(tup);
+    arg.format  = std::get<4>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_sstep_gmres, sstep_gmres_float)
+{
+    Arguments arg = setup_sstep_gmres_arguments(GetParam());
+    ASSERT_EQ(testing_sstep_gmres<float>(arg), true);
+}
+
+TEST_P(parameterized_sstep_gmres, sstep_gmres_double)
+{
+    Arguments arg = setup_sstep_gmres_arguments(GetParam());
+    ASSERT_EQ(testing_sstep_gmres<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(sstep_gmres,
+                        parameterized_sstep_gmres,
+                        testing::Combine(testing::ValuesIn(sstep_gmres_size),
+                                         testing::ValuesIn(sstep_gmres_basis),
+                                         testing::ValuesIn(sstep_gmres_sstep),
+                                         testing::ValuesIn(sstep_gmres_precond),
+                                         testing::ValuesIn(sstep_gmres_format)));
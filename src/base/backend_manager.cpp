@@ -22,12 +22,14 @@
  * ************************************************************************ */
 
 #include "backend_manager.hpp"
+#include "../utils/allocate_free.hpp"
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "base_matrix.hpp"
 #include "base_rocalution.hpp"
 #include "base_vector.hpp"
 #include "host/host_affinity.hpp"
+#include "host/host_calibration.hpp"
 #include "host/host_matrix_bcsr.hpp"
 #include "host/host_matrix_coo.hpp"
 #include "host/host_matrix_csr.hpp"
@@ -36,6 +38,8 @@
 #include "host/host_matrix_ell.hpp"
 #include "host/host_matrix_hyb.hpp"
 #include "host/host_matrix_mcsr.hpp"
+#include "host/host_matrix_sell.hpp"
+#include "host/host_thread_team.hpp"
 #include "host/host_vector.hpp"
 #include "rocalution/version.hpp"
 
@@ -76,6 +80,13 @@ namespace rocalution
         0, // pre-init OpenMP threads
         true, // host affinity (active)
         10000, // threshold size
+        {-1, -1, -1, -1}, // threshold size per kernel class (not calibrated)
+        false, // threshold calibration (inactive)
+        "", // threshold calibration file
+        TriSolveAuto, // triangular solve algorithm
+        false, // host thread team
+        4096, // host thread team chunk size
+        false, // host NUMA first-touch placement
         // HIP section
         NULL, // *HIP_blas_handle
         NULL, // *HIP_sparse_handle
@@ -103,6 +114,18 @@ namespace rocalution
     /// Backend names
     const std::string _rocalution_backend_name[2] = {"None", "HIP"};
 
+    // Discard the calibrated OpenMP thresholds of the kernel classes
+    static void _rocalution_reset_omp_kernel_thresholds(void)
+    {
+        for(int k = 0; k < 4; ++k)
+        {
+            _get_backend_descriptor()->OpenMP_kernel_threshold[k] = -1;
+        }
+
+        _get_backend_descriptor()->OpenMP_calibrated = false;
+        _get_backend_descriptor()->OpenMP_calibration_file.clear();
+    }
+
     int init_rocalution(int rank, int dev_per_node)
     {
         // please note your MPI communicator
@@ -193,6 +216,21 @@ namespace rocalution
 
         _get_backend_descriptor()->init = true;
 
+        _rocalution_reset_omp_kernel_thresholds();
+
+        if(_get_backend_descriptor()->OpenMP_team == true)
+        {
+            _set_host_thread_team(_get_backend_descriptor()->OpenMP_threads);
+        }
+
+        // Load or measure the OpenMP thresholds of the kernel classes
+        const char* calibration_file = getenv("ROCALUTION_OMP_CALIBRATION");
+
+        if(calibration_file != NULL)
+        {
+            calibrate_omp_threshold_rocalution(calibration_file);
+        }
+
         log_debug(0, "init_rocalution()", "* end");
 
         return 0;
@@ -209,6 +247,10 @@ namespace rocalution
 
         _rocalution_delete_all_obj();
 
+        _free_host_thread_team();
+
+        _release_host_memory_pool();
+
 #ifdef SUPPORT_HIP
         if(_get_backend_descriptor()->disable_accelerator == false)
         {
@@ -246,12 +288,27 @@ namespace rocalution
 
         omp_set_num_threads(nthreads);
 
+        if(_get_backend_descriptor()->OpenMP_team == true)
+        {
+            _set_host_thread_team(nthreads);
+        }
+
 #if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__)
 
         rocalution_set_omp_affinity(_get_backend_descriptor()->OpenMP_affinity);
 
 #endif // linux
 
+        // The calibrated thresholds are only valid for the previous number of threads, load
+        // or measure them for the new number of threads
+        if(_get_backend_descriptor()->OpenMP_calibrated == true)
+        {
+            std::string calibration_file = _get_backend_descriptor()->OpenMP_calibration_file;
+
+            _rocalution_reset_omp_kernel_thresholds();
+            calibrate_omp_threshold_rocalution(calibration_file);
+        }
+
 #else // !omp
         LOG_INFO("No OpenMP support");
         _get_backend_descriptor()->OpenMP_threads = 1;
@@ -319,6 +376,32 @@ namespace rocalution
 
 #ifdef _OPENMP
         LOG_INFO("OpenMP threads: " << backend_descriptor.OpenMP_threads);
+
+        if(backend_descriptor.OpenMP_team == true)
+        {
+            LOG_INFO("Host thread team: on, chunk size "
+                     << backend_descriptor.OpenMP_team_chunk);
+        }
+
+        if(backend_descriptor.OpenMP_first_touch == true)
+        {
+            LOG_INFO("Host NUMA first-touch placement: on");
+        }
+
+        if(backend_descriptor.OpenMP_kernel_threshold[OpenMPKernelBLAS1] >= 0)
+        {
+            LOG_INFO("OpenMP thresholds (calibrated): BLAS1 "
+                     << backend_descriptor.OpenMP_kernel_threshold[OpenMPKernelBLAS1]
+                     << ", reduction "
+                     << backend_descriptor.OpenMP_kernel_threshold[OpenMPKernelReduction]
+                     << ", SpMV " << backend_descriptor.OpenMP_kernel_threshold[OpenMPKernelSpMV]
+                     << ", conversion "
+                     << backend_descriptor.OpenMP_kernel_threshold[OpenMPKernelConversion]);
+        }
+        else
+        {
+            LOG_INFO("OpenMP threshold: " << backend_descriptor.OpenMP_threshold);
+        }
 #else
         LOG_INFO("No OpenMP support");
 #endif
@@ -384,6 +467,75 @@ namespace rocalution
         assert(_get_backend_descriptor()->init == true);
 
         _get_backend_descriptor()->OpenMP_threshold = threshold;
+
+        // The global threshold overrides the calibrated ones
+        _rocalution_reset_omp_kernel_thresholds();
+    }
+
+    void calibrate_omp_threshold_rocalution(const std::string& filename)
+    {
+        log_debug(0, "calibrate_omp_threshold_rocalution()", filename);
+
+        assert(_get_backend_descriptor()->init == true);
+
+        int  nthreads  = _get_backend_descriptor()->OpenMP_threads;
+        int* threshold = _get_backend_descriptor()->OpenMP_kernel_threshold;
+
+        // Keep the calibration for subsequent changes of the number of threads
+        _get_backend_descriptor()->OpenMP_calibrated       = true;
+        _get_backend_descriptor()->OpenMP_calibration_file = filename;
+
+        // Nothing to calibrate for a single thread
+        if(nthreads < 2)
+        {
+            LOG_VERBOSE_INFO(
+                2, "*** warning: OpenMP threshold calibration requires at least two threads");
+            return;
+        }
+
+        if(filename.empty() == false
+           && rocalution_read_omp_thresholds(filename, nthreads, threshold) == true)
+        {
+            LOG_VERBOSE_INFO(2, "OpenMP thresholds loaded from " << filename);
+            return;
+        }
+
+        rocalution_calibrate_omp_thresholds(nthreads, threshold);
+
+        if(filename.empty() == false)
+        {
+            rocalution_write_omp_thresholds(filename, nthreads, threshold);
+        }
+    }
+
+    void set_omp_trisolve_rocalution(unsigned int alg)
+    {
+        assert(_get_backend_descriptor()->init == true);
+        assert(alg <= TriSolveSyncFree);
+
+        _get_backend_descriptor()->OpenMP_trisolve = alg;
+    }
+
+    void set_omp_thread_team_rocalution(bool team, int chunk)
+    {
+        log_debug(0, "set_omp_thread_team_rocalution()", team, chunk);
+
+        assert(_get_backend_descriptor()->init == true);
+        assert(chunk > 0);
+
+        _get_backend_descriptor()->OpenMP_team       = team;
+        _get_backend_descriptor()->OpenMP_team_chunk = chunk;
+
+        _set_host_thread_team((team == true) ? _get_backend_descriptor()->OpenMP_threads : 0);
+    }
+
+    void set_omp_first_touch_rocalution(bool first_touch)
+    {
+        log_debug(0, "set_omp_first_touch_rocalution()", first_touch);
+
+        assert(_get_backend_descriptor()->init == true);
+
+        _get_backend_descriptor()->OpenMP_first_touch = first_touch;
     }
 
     bool _rocalution_available_accelerator(void)
@@ -498,6 +650,9 @@ namespace rocalution
         case HYB:
             return new HostMatrixHYB<ValueType>(backend_descriptor);
             break;
+        case SELL:
+            return new HostMatrixSELL<ValueType>(backend_descriptor);
+            break;
         case DENSE:
             return new HostMatrixDENSE<ValueType>(backend_descriptor);
             break;
@@ -523,22 +678,33 @@ namespace rocalution
     }
 
     void _set_omp_backend_threads(const struct Rocalution_Backend_Descriptor& backend_descriptor,
-                                  int                                         size)
+                                  int                                         size,
+                                  int                                         kernel)
     {
-        // if the threshold is disabled or if the size is not in the threshold limit
-        if((backend_descriptor.OpenMP_threshold > 0)
-           && (size <= backend_descriptor.OpenMP_threshold) && (size >= 0))
-        {
 #ifdef _OPENMP
-            omp_set_num_threads(1);
+        omp_set_num_threads(_get_omp_backend_threads(backend_descriptor, size, kernel));
 #endif
+    }
+
+    int _get_omp_backend_threads(const struct Rocalution_Backend_Descriptor& backend_descriptor,
+                                 int                                         size,
+                                 int                                         kernel)
+    {
+        int threshold = backend_descriptor.OpenMP_threshold;
+
+        // calibrated threshold of the kernel class
+        if(kernel >= 0 && backend_descriptor.OpenMP_kernel_threshold[kernel] >= 0)
+        {
+            threshold = backend_descriptor.OpenMP_kernel_threshold[kernel];
         }
-        else
+
+        // if the threshold is disabled or if the size is not in the threshold limit
+        if((threshold > 0) && (size <= threshold) && (size >= 0))
         {
-#ifdef _OPENMP
-            omp_set_num_threads(backend_descriptor.OpenMP_threads);
-#endif
+            return 1;
         }
+
+        return backend_descriptor.OpenMP_threads;
     }
 
     size_t _rocalution_add_obj(class RocalutionObj* ptr)
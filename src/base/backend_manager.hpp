@@ -64,6 +64,20 @@ namespace rocalution
         bool OpenMP_affinity;
         // Host threshold size
         int OpenMP_threshold;
+        // Host threshold size per kernel class (-1 - use OpenMP_threshold)
+        int OpenMP_kernel_threshold[4];
+        // Host threshold sizes are calibrated (true-yes/false-no)
+        bool OpenMP_calibrated;
+        // Host threshold calibration file (empty - not stored)
+        std::string OpenMP_calibration_file;
+        // Host triangular solve algorithm
+        int OpenMP_trisolve;
+        // Host persistent thread team (true-yes/false-no)
+        bool OpenMP_team;
+        // Minimum number of elements per thread of the host thread team
+        int OpenMP_team_chunk;
+        // Host NUMA first-touch placement (true-yes/false-no)
+        bool OpenMP_first_touch;
 
         // HIP section
         // handles
@@ -103,6 +117,46 @@ namespace rocalution
         HIP  = 1
     };
 
+    /** \ingroup backend_module
+  * \brief Triangular solve algorithms of the OpenMP host backend
+  * \details
+  * - TriSolveAuto - level scheduling for wide levels, sync-free for narrow levels and
+  *   sequential substitution for (nearly) sequential dependencies
+  * - TriSolveSerial - sequential substitution
+  * - TriSolveLevelSchedule - rows of each level are processed in parallel, with a barrier
+  *   between consecutive levels
+  * - TriSolveSyncFree - each row waits for the completion of its dependencies, without
+  *   any global synchronization
+  */
+    enum _omp_trisolve_alg
+    {
+        TriSolveAuto          = 0,
+        TriSolveSerial        = 1,
+        TriSolveLevelSchedule = 2,
+        TriSolveSyncFree      = 3
+    };
+
+    /** \ingroup backend_module
+  * \brief Kernel classes of the OpenMP host backend
+  * \details
+  * The kernel classes differ in their cost per element and thus have different OpenMP
+  * threshold sizes, see calibrate_omp_threshold_rocalution().
+  * - OpenMPKernelBLAS1 - element-wise vector operations (e.g. AXPY, scaling), the size is
+  *   the vector length
+  * - OpenMPKernelReduction - vector reductions (e.g. dot products, norms), the size is the
+  *   vector length
+  * - OpenMPKernelSpMV - sparse matrix-vector products, the size is the number of rows
+  * - OpenMPKernelConversion - matrix format conversions, the size is the number of
+  *   non-zero entries
+  */
+    enum _omp_kernel_class
+    {
+        OpenMPKernelBLAS1      = 0,
+        OpenMPKernelReduction  = 1,
+        OpenMPKernelSpMV       = 2,
+        OpenMPKernelConversion = 3
+    };
+
     /** \ingroup backend_module
   * \brief Initialize rocALUTION platform
   * \details
@@ -120,6 +174,10 @@ namespace rocalution
   * - set_omp_threads_rocalution() sets the number of OpenMP threads. This function has
   *   to be called after init_rocalution().
   *
+  * If the environment variable \p ROCALUTION_OMP_CALIBRATION is set to a file name,
+  * init_rocalution() loads (or measures and stores) the OpenMP threshold sizes of each
+  * kernel class, see calibrate_omp_threshold_rocalution().
+  *
   * @param[in]
   * rank            specifies MPI rank when multi-node environment
   * @param[in]
@@ -217,7 +275,8 @@ namespace rocalution
   * rocALUTION. The default threshold is set to 10000, which means that all matrices
   * under (and equal) this size will use only one thread (disregarding the number of
   * OpenMP threads set in the system). The threshold can be modified with
-  * \p set_omp_threshold_rocalution.
+  * \p set_omp_threshold_rocalution. This also discards the threshold sizes of the
+  * individual kernel classes, that have been set by calibrate_omp_threshold_rocalution().
   *
   * @param[in]
   * threshold   OpenMP threshold size
@@ -225,6 +284,99 @@ namespace rocalution
     ROCALUTION_EXPORT
     void set_omp_threshold_rocalution(int threshold);
 
+    /** \ingroup backend_module
+  * \brief Calibrate the OpenMP threshold sizes of the kernel classes
+  * \details
+  * A single threshold size does not fit all host kernels, since e.g. a sparse
+  * matrix-vector product performs much more work per row than an AXPY per element.
+  * \p calibrate_omp_threshold_rocalution measures the run time of a representative
+  * kernel of each class (see \ref _omp_kernel_class) with one thread and with the
+  * current number of OpenMP threads for increasing sizes. The largest size, for which
+  * the single thread is faster, becomes the threshold size of the kernel class. If
+  * multiple threads are slower for all measured sizes, the threshold is set to the
+  * largest measured size.
+  *
+  * If \p filename is given and the file contains thresholds for the current number of
+  * OpenMP threads, these are loaded instead of measured. Otherwise, the measured
+  * thresholds are added to the file, such that subsequent runs on the same machine can
+  * skip the calibration. Similar to the number of threads, the thresholds only apply to
+  * objects created after calling \p calibrate_omp_threshold_rocalution. When the number
+  * of OpenMP threads is changed with set_omp_threads_rocalution() afterwards, the
+  * thresholds for the new number of threads are loaded from \p filename or measured
+  * again. Setting a global threshold with set_omp_threshold_rocalution() ends the
+  * calibration.
+  *
+  * @param[in]
+  * filename    file to load the thresholds from and store the thresholds to (optional)
+  */
+    ROCALUTION_EXPORT
+    void calibrate_omp_threshold_rocalution(const std::string& filename = "");
+
+    /** \ingroup backend_module
+  * \brief Set OpenMP triangular solve algorithm
+  * \details
+  * The triangular solves of the host backend (e.g. used by ILU, IC, GS and SGS
+  * preconditioners) are analysed once in the LAnalyse(), UAnalyse(), LUAnalyse() and
+  * LLAnalyse() functions. Based on the dependency levels of the analysed matrix, the
+  * solve phase either runs level scheduled (barrier after each level), sync-free (each
+  * row waits for its dependencies only) or sequential. By default (\p TriSolveAuto),
+  * the algorithm is chosen depending on the average number of rows per level. Similar
+  * to the number of threads, the algorithm only applies to objects created after calling
+  * \p set_omp_trisolve_rocalution.
+  *
+  * @param[in]
+  * alg     triangular solve algorithm, see \ref _omp_trisolve_alg
+  */
+    ROCALUTION_EXPORT
+    void set_omp_trisolve_rocalution(unsigned int alg);
+
+    /** \ingroup backend_module
+  * \brief Enable/disable the persistent host thread team
+  * \details
+  * By default, each host kernel opens its own OpenMP parallel region, and vectors below
+  * the OpenMP threshold size are processed by a single thread. When the thread team is
+  * enabled, the vector operations and the CSR matrix-vector product of the host backend
+  * run on a persistent team of worker threads instead. Idle workers spin for a short
+  * while before they park, such that the sequence of small kernels in a Krylov iteration
+  * does not pay the OpenMP fork/join overhead for every call. Instead of the OpenMP
+  * threshold, the number of active threads is chosen such that each thread processes at
+  * least \p chunk elements. Similar to the number of threads, the setting only applies
+  * to objects created after calling \p set_omp_thread_team_rocalution. The team is
+  * created by this function with the current number of OpenMP threads, and re-created by
+  * \ref set_omp_threads_rocalution. Objects that were created with a larger number of
+  * threads than the team provides fall back to OpenMP parallel regions.
+  *
+  * @param[in]
+  * team    boolean to turn on/off the thread team
+  * @param[in]
+  * chunk   minimum number of elements per thread
+  */
+    ROCALUTION_EXPORT
+    void set_omp_thread_team_rocalution(bool team, int chunk = 4096);
+
+    /** \ingroup backend_module
+  * \brief Enable/disable NUMA first-touch placement of host buffers
+  * \details
+  * The operating system places a page of memory on the NUMA node of the thread that
+  * writes it first. By default, host vectors and matrices are zero-initialized by a
+  * single thread, such that all their pages end up on one NUMA node and memory bound
+  * kernels (e.g. the sparse matrix-vector product) are limited by the bandwidth of this
+  * node. With \p set_omp_first_touch_rocalution, host vectors are initialized in
+  * parallel with the same static partition as the vector operations, and CSR matrices
+  * that are copied (e.g. by CopyFrom() or CloneFrom()) are written by the merge path
+  * partition of the matrix-vector product. Thus, each thread streams memory that is local
+  * to its NUMA node. CSR matrices that are the target of a format conversion (e.g. from
+  * COO after reading a file) are not placed. This requires the threads to be pinned to
+  * the cores, see set_omp_affinity_rocalution(). Similar to the number of threads, the
+  * setting only applies to objects created after calling
+  * \p set_omp_first_touch_rocalution.
+  *
+  * @param[in]
+  * first_touch boolean to turn on/off the parallel first-touch initialization
+  */
+    ROCALUTION_EXPORT
+    void set_omp_first_touch_rocalution(bool first_touch);
+
     /** \ingroup backend_module
   * \brief Print info about rocALUTION
   * \details
@@ -261,14 +413,21 @@ namespace rocalution
     bool _rocalution_available_accelerator(void);
 
     // Return backend descriptor
+    ROCALUTION_EXPORT
     struct Rocalution_Backend_Descriptor* _get_backend_descriptor(void);
 
     // Set backend descriptor
     void _set_backend_descriptor(const struct Rocalution_Backend_Descriptor& backend_descriptor);
 
-    // Set the OMP threads based on the size threshold
+    // Set the OMP threads based on the size threshold (of the kernel class, if kernel >= 0)
     void _set_omp_backend_threads(const struct Rocalution_Backend_Descriptor& backend_descriptor,
-                                  int                                         size);
+                                  int                                         size,
+                                  int                                         kernel = -1);
+
+    // Return the number of OMP threads based on the size threshold of the kernel class
+    int _get_omp_backend_threads(const struct Rocalution_Backend_Descriptor& backend_descriptor,
+                                 int                                         size,
+                                 int                                         kernel);
 
     // Build (and return) a vector on the selected in the descriptor accelerator
     template <typename ValueType>
@@ -27,6 +27,7 @@
 #include "backend_manager.hpp"
 #include "base_vector.hpp"
 
+#include <algorithm>
 #include <complex>
 
 namespace rocalution
@@ -88,6 +89,43 @@ namespace rocalution
         return 1;
     }
 
+    template <typename ValueType>
+    size_t BaseMatrix<ValueType>::GetMemoryUsage(void) const
+    {
+        if(this->nnz_ == 0)
+        {
+            return 0;
+        }
+
+        size_t nrow = this->nrow_;
+        size_t ncol = this->ncol_;
+        size_t nnz  = this->nnz_;
+
+        // Size of the format arrays, backends with additional data override this
+        switch(this->GetMatFormat())
+        {
+        case DENSE:
+            return nnz * sizeof(ValueType);
+        case CSR:
+        case MCSR:
+            return (nrow + 1) * sizeof(int) + nnz * (sizeof(int) + sizeof(ValueType));
+        case BCSR:
+        {
+            size_t blockdim = this->GetMatBlockDimension();
+            size_t nrowb    = (nrow + blockdim - 1) / blockdim;
+            size_t nnzb     = nnz / (blockdim * blockdim);
+
+            return (nrowb + 1 + nnzb) * sizeof(int) + nnz * sizeof(ValueType);
+        }
+        case COO:
+            return nnz * (2 * sizeof(int) + sizeof(ValueType));
+        case DIA:
+            return nnz / std::max(nrow, ncol) * sizeof(int) + nnz * sizeof(ValueType);
+        default:
+            return nnz * (sizeof(int) + sizeof(ValueType));
+        }
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::Check(void) const
     {
@@ -340,12 +378,24 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ItILU0Factorize(int max_iter)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::ICFactorize(BaseVector<ValueType>* inv_diag)
     {
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ItICFactorize(int max_iter, BaseVector<ValueType>* inv_diag)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::Permute(const BaseVector<int>& permutation)
     {
@@ -396,6 +446,59 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ApplyMultiVector(const BaseVector<ValueType>& in,
+                                                 int                          num_vectors,
+                                                 BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ApplyAddMultiVector(const BaseVector<ValueType>& in,
+                                                    int                          num_vectors,
+                                                    ValueType                    scalar,
+                                                    BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ApplyDot(const BaseVector<ValueType>& in,
+                                         const BaseVector<ValueType>& x,
+                                         bool                         conj,
+                                         BaseVector<ValueType>*       out,
+                                         ValueType*                   dot) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ResidualNorm(const BaseVector<ValueType>& rhs,
+                                             const BaseVector<ValueType>& in,
+                                             BaseVector<ValueType>*       out,
+                                             ValueType*                   norm) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::MatrixPowers(const BaseVector<ValueType>& in,
+                                             int                          k,
+                                             const ValueType*             shift,
+                                             BaseVector<ValueType>**      out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::PartitionPermutation(int              num_parts,
+                                                     int&             size,
+                                                     BaseVector<int>* permutation) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::SymbolicPower(int p)
     {
@@ -559,6 +662,53 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    void BaseMatrix<ValueType>::ItLUAnalyse(void)
+    {
+        // Analysis is optional, ItLUSolve falls back to the host
+    }
+
+    template <typename ValueType>
+    void BaseMatrix<ValueType>::ItLUAnalyseClear(void)
+    {
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ItLUSolve(int                          max_iter,
+                                          const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    void BaseMatrix<ValueType>::ItLLAnalyse(void)
+    {
+        // Analysis is optional, ItLLSolve falls back to the host
+    }
+
+    template <typename ValueType>
+    void BaseMatrix<ValueType>::ItLLAnalyseClear(void)
+    {
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ItLLSolve(int                          max_iter,
+                                          const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ItLLSolve(int                          max_iter,
+                                          const BaseVector<ValueType>& in,
+                                          const BaseVector<ValueType>& inv_diag,
+                                          BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::NumericMatMatMult(const BaseMatrix<ValueType>& A,
                                                   const BaseMatrix<ValueType>& B)
@@ -48,6 +48,8 @@ namespace rocalution
     template <typename ValueType>
     class HostMatrixHYB;
     template <typename ValueType>
+    class HostMatrixSELL;
+    template <typename ValueType>
     class HostMatrixDENSE;
     template <typename ValueType>
     class HostMatrixMCSR;
@@ -91,6 +93,8 @@ namespace rocalution
         virtual unsigned int GetMatFormat(void) const = 0;
         /// Return the block dimension of the matrix
         virtual int GetMatBlockDimension(void) const;
+        /// Return the number of bytes allocated by the matrix
+        virtual size_t GetMemoryUsage(void) const;
         /// Copy the backend descriptor information
         virtual void set_backend(const Rocalution_Backend_Descriptor& local_backend);
         /// Set matrix value block dimension
@@ -229,6 +233,12 @@ namespace rocalution
         /// the return size is the size of the first block
         virtual bool ZeroBlockPermutation(int& size, BaseVector<int>* permutation) const;
 
+        /// Return a permutation that splits the matrix into num_parts parts of consecutive
+        /// rows, where all rows coupling to other parts are mapped to the last block;
+        /// the return size is the size of the first block
+        virtual bool
+            PartitionPermutation(int num_parts, int& size, BaseVector<int>* permutation) const;
+
         /// Convert the matrix from another matrix (with different structure)
         virtual bool ConvertFrom(const BaseMatrix<ValueType>& mat) = 0;
 
@@ -312,6 +322,8 @@ namespace rocalution
 
         /// Perform ILU(0) factorization
         virtual bool ILU0Factorize(void);
+        /// Perform ILU(0) factorization by fixed-point sweeps over all non-zero entries
+        virtual bool ItILU0Factorize(int max_iter);
         /// Perform LU factorization
         virtual bool LUFactorize(void);
         /// Perform ILU(t,m) factorization based on threshold and maximum
@@ -325,6 +337,8 @@ namespace rocalution
 
         /// Perform IC(0) factorization
         virtual bool ICFactorize(BaseVector<ValueType>* inv_diag);
+        /// Perform IC(0) factorization by fixed-point sweeps over all non-zero entries
+        virtual bool ItICFactorize(int max_iter, BaseVector<ValueType>* inv_diag);
 
         /// Analyse the structure (level-scheduling)
         virtual void LUAnalyse(void);
@@ -365,6 +379,28 @@ namespace rocalution
         /// graph traversing is performed in parallel
         virtual bool USolve(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
 
+        /// Prepare the approximate LU solve by Jacobi sweeps (see ItLUSolve)
+        virtual void ItLUAnalyse(void);
+        /// Delete the analysed data (see ItLUAnalyse)
+        virtual void ItLUAnalyseClear(void);
+        /// Approximate LU out = in by max_iter Jacobi sweeps over each triangular factor
+        virtual bool ItLUSolve(int                          max_iter,
+                               const BaseVector<ValueType>& in,
+                               BaseVector<ValueType>*       out) const;
+
+        /// Prepare the approximate LL^T solve by Jacobi sweeps (see ItLLSolve)
+        virtual void ItLLAnalyse(void);
+        /// Delete the analysed data (see ItLLAnalyse)
+        virtual void ItLLAnalyseClear(void);
+        /// Approximate LL^T out = in by max_iter Jacobi sweeps over each triangular factor
+        virtual bool ItLLSolve(int                          max_iter,
+                               const BaseVector<ValueType>& in,
+                               BaseVector<ValueType>*       out) const;
+        virtual bool ItLLSolve(int                          max_iter,
+                               const BaseVector<ValueType>& in,
+                               const BaseVector<ValueType>& inv_diag,
+                               BaseVector<ValueType>*       out) const;
+
         /// Compute Householder vector
         virtual bool Householder(int idx, ValueType& beta, BaseVector<ValueType>* vec) const;
         /// QR Decomposition
@@ -385,6 +421,36 @@ namespace rocalution
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const = 0;
 
+        /// Apply the matrix to num_vectors interleaved vectors, out = this*in;
+        virtual bool ApplyMultiVector(const BaseVector<ValueType>& in,
+                                      int                          num_vectors,
+                                      BaseVector<ValueType>*       out) const;
+        /// Apply and add the matrix to num_vectors interleaved vectors,
+        /// out = out + scalar*this*in;
+        virtual bool ApplyAddMultiVector(const BaseVector<ValueType>& in,
+                                         int                          num_vectors,
+                                         ValueType                    scalar,
+                                         BaseVector<ValueType>*       out) const;
+        /// Apply the matrix to vector and compute a dot product in the same pass,
+        /// out = this*in; dot = x^H*out (conj == true) or dot = x^T*out (conj == false)
+        virtual bool ApplyDot(const BaseVector<ValueType>& in,
+                              const BaseVector<ValueType>& x,
+                              bool                         conj,
+                              BaseVector<ValueType>*       out,
+                              ValueType*                   dot) const;
+        /// Compute the residual and its L2 norm in the same pass, out = rhs - this*in;
+        /// norm = ||out||_2
+        virtual bool ResidualNorm(const BaseVector<ValueType>& rhs,
+                                  const BaseVector<ValueType>& in,
+                                  BaseVector<ValueType>*       out,
+                                  ValueType*                   norm) const;
+        /// Compute the shifted matrix powers, out[0] = (this - shift[0]*I)*in and
+        /// out[l] = (this - shift[l]*I)*out[l-1]; shift can be NULL
+        virtual bool MatrixPowers(const BaseVector<ValueType>& in,
+                                  int                          k,
+                                  const ValueType*             shift,
+                                  BaseVector<ValueType>**      out) const;
+
         /// Delete all entries abs(a_ij) <= drop_off;
         /// the diagonal elements are never deleted
         virtual bool Compress(double drop_off);
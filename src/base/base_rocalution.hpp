@@ -143,6 +143,21 @@ namespace rocalution
       */
         virtual void Info(void) const = 0;
 
+        /** \brief Return the memory usage of the object in bytes
+      * \details
+      * \p GetMemoryUsage returns the number of bytes, that are allocated by the object on
+      * its current backend. This includes the data of the matrix format (or the vector
+      * values) as well as additional data of the object, e.g. the analysis data of
+      * triangular solves.
+      *
+      * \par Example
+      * \code{.cpp}
+      * std::cout << "Matrix: " << mat.GetMemoryUsage() << " bytes" << std::endl;
+      * std::cout << "Vector: " << vec.GetMemoryUsage() << " bytes" << std::endl;
+      * \endcode
+      */
+        virtual size_t GetMemoryUsage(void) const = 0;
+
         /** \brief Clear (free all data) the object */
         virtual void Clear(void) = 0;
 
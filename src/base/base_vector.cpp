@@ -54,6 +54,13 @@ namespace rocalution
         return this->size_;
     }
 
+    template <typename ValueType>
+    size_t BaseVector<ValueType>::GetMemoryUsage(void) const
+    {
+        return static_cast<size_t>(this->size_) * sizeof(ValueType)
+               + static_cast<size_t>(this->index_size_) * sizeof(int);
+    }
+
     template <typename ValueType>
     void BaseVector<ValueType>::set_backend(const Rocalution_Backend_Descriptor& local_backend)
     {
@@ -121,6 +128,85 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseVector<ValueType>::CopyFromInterleaved(const BaseVector<ValueType>& src,
+                                                    int                          num_vectors,
+                                                    int                          index)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::CopyToInterleaved(BaseVector<ValueType>* dst,
+                                                  int                    num_vectors,
+                                                  int                    index) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::BlockDot(const BaseVector<ValueType>& x,
+                                         int                          num_vectors,
+                                         ValueType*                   result) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::BlockAddScale(const BaseVector<ValueType>& x,
+                                              int                          num_vectors,
+                                              const ValueType*             scale)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::BlockScaleAdd(const ValueType*             scale,
+                                              const BaseVector<ValueType>& x,
+                                              int                          num_vectors)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::BlockScale(const ValueType* scale, int num_vectors)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::FusedDot(int                                 num,
+                                         const BaseVector<ValueType>* const* x,
+                                         const BaseVector<ValueType>* const* y,
+                                         ValueType*                          result) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::MultiDot(int                                 num,
+                                         const BaseVector<ValueType>* const* x,
+                                         ValueType*                          result) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::MultiAXPY(int                                 num,
+                                          const ValueType*                    alpha,
+                                          const BaseVector<ValueType>* const* x)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseVector<ValueType>::LinearCombination(int                                 num,
+                                                  const ValueType*                    alpha,
+                                                  const BaseVector<ValueType>* const* x)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     void BaseVector<ValueType>::CopyFromAsync(const BaseVector<ValueType>& vec)
     {
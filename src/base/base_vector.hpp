@@ -52,6 +52,8 @@ namespace rocalution
 
         /// Returns the size of the vector
         int GetSize(void) const;
+        /// Returns the number of bytes allocated by the vector
+        virtual size_t GetMemoryUsage(void) const;
 
         /// Copy the backend descriptor information
         void set_backend(const Rocalution_Backend_Descriptor& local_backend);
@@ -61,6 +63,8 @@ namespace rocalution
 
         /// Allocate a local vector with name and size
         virtual void Allocate(int n) = 0;
+        /// Allocate a local vector with size, without initializing its values
+        virtual void AllocateUninitialized(int n) = 0;
 
         /// Initialize a vector with externally allocated data
         virtual void SetDataPtr(ValueType** ptr, int size) = 0;
@@ -118,6 +122,50 @@ namespace rocalution
         virtual bool Prolongation(const BaseVector<ValueType>& vec_coarse,
                                   const BaseVector<int>&       map);
 
+        /// Copy vector index of an interleaved multi-vector src with num_vectors vectors,
+        /// i.e. this[i] = src[i * num_vectors + index]
+        virtual bool
+            CopyFromInterleaved(const BaseVector<ValueType>& src, int num_vectors, int index);
+        /// Copy into vector index of an interleaved multi-vector dst with num_vectors vectors,
+        /// i.e. dst[i * num_vectors + index] = this[i]
+        virtual bool
+            CopyToInterleaved(BaseVector<ValueType>* dst, int num_vectors, int index) const;
+        /// Compute the num_vectors x num_vectors (column-major) block dot product of two
+        /// interleaved multi-vectors, i.e. result[i + j * num_vectors] = this_i^H x_j
+        virtual bool
+            BlockDot(const BaseVector<ValueType>& x, int num_vectors, ValueType* result) const;
+        /// Perform interleaved multi-vector update of type this = this + x*scale, where scale
+        /// is a num_vectors x num_vectors (column-major) matrix
+        virtual bool
+            BlockAddScale(const BaseVector<ValueType>& x, int num_vectors, const ValueType* scale);
+        /// Perform interleaved multi-vector update of type this = this*scale + x, where scale
+        /// is a num_vectors x num_vectors (column-major) matrix
+        virtual bool
+            BlockScaleAdd(const ValueType* scale, const BaseVector<ValueType>& x, int num_vectors);
+        /// Perform interleaved multi-vector update of type this = this*scale, where scale is
+        /// a num_vectors x num_vectors (column-major) matrix
+        virtual bool BlockScale(const ValueType* scale, int num_vectors);
+        /// Compute num dot products in a single pass, i.e. result[i] = x_i^H y_i, where
+        /// all vectors have the size of this vector
+        virtual bool FusedDot(int                                 num,
+                              const BaseVector<ValueType>* const* x,
+                              const BaseVector<ValueType>* const* y,
+                              ValueType*                          result) const;
+        /// Compute the dot products of num vectors with this vector in a single pass, i.e.
+        /// result[i] = x_i^H this
+        virtual bool MultiDot(int                                 num,
+                              const BaseVector<ValueType>* const* x,
+                              ValueType*                          result) const;
+        /// Perform vector update of type this = this + sum(alpha_i * x_i) in a single pass
+        virtual bool MultiAXPY(int                                 num,
+                               const ValueType*                    alpha,
+                               const BaseVector<ValueType>* const* x);
+        /// Perform vector update of type this = sum(alpha_i * x_i) in a single pass, where
+        /// this vector may itself be one of the x_i
+        virtual bool LinearCombination(int                                 num,
+                                       const ValueType*                    alpha,
+                                       const BaseVector<ValueType>* const* x);
+
         /// Perform vector update of type this = this + alpha*x
         virtual void AddScale(const BaseVector<ValueType>& x, ValueType alpha) = 0;
         /// Perform vector update of type this = alpha*this + x
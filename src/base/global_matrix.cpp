@@ -1011,6 +1011,26 @@ namespace rocalution
                  << " current=" << current_backend_name);
     }
 
+    template <typename ValueType>
+    size_t GlobalMatrix<ValueType>::GetMemoryUsage(void) const
+    {
+        size_t bytes = this->matrix_interior_.GetMemoryUsage()
+                       + this->matrix_ghost_.GetMemoryUsage() + this->halo_.GetMemoryUsage();
+
+        // Host buffers of the ghost value exchange
+        if(this->recv_boundary_ != NULL)
+        {
+            bytes += this->pm_->GetNumReceivers() * sizeof(ValueType);
+        }
+
+        if(this->send_boundary_ != NULL)
+        {
+            bytes += this->pm_->GetNumSenders() * sizeof(ValueType);
+        }
+
+        return bytes;
+    }
+
     template <typename ValueType>
     bool GlobalMatrix<ValueType>::Check(void) const
     {
@@ -82,7 +82,8 @@ namespace rocalution
         virtual void MoveToAccelerator(void);
         virtual void MoveToHost(void);
 
-        virtual void Info(void) const;
+        virtual void   Info(void) const;
+        virtual size_t GetMemoryUsage(void) const;
 
         /** \brief Perform a sanity check of the matrix
       * \details
@@ -37,6 +37,7 @@
 #include <limits>
 #include <math.h>
 #include <sstream>
+#include <vector>
 
 namespace rocalution
 {
@@ -54,6 +55,8 @@ namespace rocalution
         this->pm_ = NULL;
 
         this->object_name_ = "";
+
+        this->reduce_event_ = NULL;
     }
 
     template <typename ValueType>
@@ -66,6 +69,8 @@ namespace rocalution
         this->object_name_ = "";
 
         this->pm_ = &pm;
+
+        this->reduce_event_ = NULL;
     }
 
     template <typename ValueType>
@@ -74,6 +79,14 @@ namespace rocalution
         log_debug(this, "GlobalVector::~GlobalVector()");
 
         this->Clear();
+
+#ifdef SUPPORT_MULTINODE
+        if(this->reduce_event_ != NULL)
+        {
+            communication_sync(this->reduce_event_);
+            delete this->reduce_event_;
+        }
+#endif
     }
 
     template <typename ValueType>
@@ -146,6 +159,15 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::Allocate()", name, size);
 
+        this->AllocateUninitialized(name, size);
+        this->vector_interior_.Zeros();
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::AllocateUninitialized(std::string name, IndexType2 size)
+    {
+        log_debug(this, "GlobalVector::AllocateUninitialized()", name, size);
+
         assert(this->pm_ != NULL);
         assert(this->pm_->global_nrow_ == size || this->pm_->global_ncol_ == size);
         assert(size <= std::numeric_limits<IndexType2>::max());
@@ -169,7 +191,7 @@ namespace rocalution
 
         assert(local_size != -1);
 
-        this->vector_interior_.Allocate(interior_name, local_size);
+        this->vector_interior_.AllocateUninitialized(interior_name, local_size);
         this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
                                              this->pm_->boundary_index_);
     }
@@ -346,6 +368,12 @@ namespace rocalution
                  << " current=" << current_backend_name);
     }
 
+    template <typename ValueType>
+    size_t GlobalVector<ValueType>::GetMemoryUsage(void) const
+    {
+        return this->vector_interior_.GetMemoryUsage();
+    }
+
     template <typename ValueType>
     bool GlobalVector<ValueType>::Check(void) const
     {
@@ -595,6 +623,150 @@ namespace rocalution
         return global;
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::FusedDot(int                                   num,
+                                           const GlobalVector<ValueType>* const* x,
+                                           const GlobalVector<ValueType>* const* y,
+                                           ValueType*                            result) const
+    {
+        log_debug(this, "GlobalVector::FusedDot()", num, x, y, result);
+
+        assert(num > 0);
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(result != NULL);
+
+        std::vector<const LocalVector<ValueType>*> interior_x(num);
+        std::vector<const LocalVector<ValueType>*> interior_y(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            interior_x[j] = &x[j]->vector_interior_;
+            interior_y[j] = &y[j]->vector_interior_;
+        }
+
+        std::vector<ValueType> local(num);
+
+        this->vector_interior_.FusedDot(num, &interior_x[0], &interior_y[0], &local[0]);
+
+        // All dot products are reduced at once
+#ifdef SUPPORT_MULTINODE
+        communication_sync_allreduce_sum(&local[0], result, num, this->pm_->comm_);
+#else
+        for(int j = 0; j < num; ++j)
+        {
+            result[j] = local[j];
+        }
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::FusedDotAsync(int                                   num,
+                                                const GlobalVector<ValueType>* const* x,
+                                                const GlobalVector<ValueType>* const* y,
+                                                ValueType*                            result) const
+    {
+        log_debug(this, "GlobalVector::FusedDotAsync()", num, x, y, result);
+
+        assert(num > 0);
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(result != NULL);
+
+        std::vector<const LocalVector<ValueType>*> interior_x(num);
+        std::vector<const LocalVector<ValueType>*> interior_y(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            interior_x[j] = &x[j]->vector_interior_;
+            interior_y[j] = &y[j]->vector_interior_;
+        }
+
+        // The local results are reduced in place
+        this->vector_interior_.FusedDot(num, &interior_x[0], &interior_y[0], result);
+
+#ifdef SUPPORT_MULTINODE
+        if(this->reduce_event_ == NULL)
+        {
+            this->reduce_event_ = new MRequest;
+        }
+        else
+        {
+            // Complete a previous reduction that has not been waited for
+            communication_sync(this->reduce_event_);
+        }
+
+        communication_async_allreduce_sum(result, num, this->reduce_event_, this->pm_->comm_);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::FusedDotSync(void) const
+    {
+        log_debug(this, "GlobalVector::FusedDotSync()");
+
+#ifdef SUPPORT_MULTINODE
+        if(this->reduce_event_ != NULL)
+        {
+            communication_sync(this->reduce_event_);
+        }
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::MultiDot(int                                   num,
+                                           const GlobalVector<ValueType>* const* x,
+                                           ValueType*                            result) const
+    {
+        log_debug(this, "GlobalVector::MultiDot()", num, x, result);
+
+        assert(num > 0);
+        assert(x != NULL);
+        assert(result != NULL);
+
+        std::vector<const LocalVector<ValueType>*> interior_x(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            interior_x[j] = &x[j]->vector_interior_;
+        }
+
+        std::vector<ValueType> local(num);
+
+        this->vector_interior_.MultiDot(num, &interior_x[0], &local[0]);
+
+        // All dot products are reduced at once
+#ifdef SUPPORT_MULTINODE
+        communication_sync_allreduce_sum(&local[0], result, num, this->pm_->comm_);
+#else
+        for(int j = 0; j < num; ++j)
+        {
+            result[j] = local[j];
+        }
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::MultiAXPY(int                                   num,
+                                            const ValueType*                      alpha,
+                                            const GlobalVector<ValueType>* const* x)
+    {
+        log_debug(this, "GlobalVector::MultiAXPY()", num, alpha, x);
+
+        assert(num > 0);
+        assert(alpha != NULL);
+        assert(x != NULL);
+
+        std::vector<const LocalVector<ValueType>*> interior_x(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            interior_x[j] = &x[j]->vector_interior_;
+        }
+
+        this->vector_interior_.MultiAXPY(num, alpha, &interior_x[0]);
+    }
+
     template <typename ValueType>
     ValueType GlobalVector<ValueType>::Norm(void) const
     {
@@ -61,8 +61,9 @@ namespace rocalution
         virtual void MoveToAccelerator(void);
         virtual void MoveToHost(void);
 
-        virtual void Info(void) const;
-        virtual bool Check(void) const;
+        virtual void   Info(void) const;
+        virtual size_t GetMemoryUsage(void) const;
+        virtual bool   Check(void) const;
 
         virtual IndexType2 GetSize(void) const;
         virtual int        GetLocalSize(void) const;
@@ -79,6 +80,8 @@ namespace rocalution
 
         /** \brief Allocate a global vector with name and size */
         virtual void Allocate(std::string name, IndexType2 size);
+        /** \brief Allocate a global vector with name and size, without initialization */
+        virtual void AllocateUninitialized(std::string name, IndexType2 size);
         virtual void Clear(void);
 
         /** \brief Set the parallel manager of a global vector */
@@ -127,6 +130,21 @@ namespace rocalution
         virtual void      Scale(ValueType alpha);
         virtual ValueType Dot(const GlobalVector<ValueType>& x) const;
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
+        virtual void      FusedDot(int                                   num,
+                                   const GlobalVector<ValueType>* const* x,
+                                   const GlobalVector<ValueType>* const* y,
+                                   ValueType*                            result) const;
+        virtual void      FusedDotAsync(int                                   num,
+                                        const GlobalVector<ValueType>* const* x,
+                                        const GlobalVector<ValueType>* const* y,
+                                        ValueType*                            result) const;
+        virtual void      FusedDotSync(void) const;
+        virtual void      MultiDot(int                                   num,
+                                   const GlobalVector<ValueType>* const* x,
+                                   ValueType*                            result) const;
+        virtual void      MultiAXPY(int                                   num,
+                                    const ValueType*                      alpha,
+                                    const GlobalVector<ValueType>* const* x);
         virtual ValueType Norm(void) const;
         virtual ValueType Reduce(void) const;
         virtual ValueType Asum(void) const;
@@ -150,6 +168,9 @@ namespace rocalution
     private:
         LocalVector<ValueType> vector_interior_;
 
+        // Request of the non-blocking reduction of FusedDotAsync()
+        mutable MRequest* reduce_event_;
+
         friend class LocalMatrix<ValueType>;
         friend class GlobalMatrix<ValueType>;
 
@@ -59,6 +59,8 @@ namespace rocalution
             return this->mat_.blockdim;
         }
 
+        virtual size_t GetMemoryUsage(void) const;
+
         virtual void Clear(void);
         virtual void AllocateBCSR(int nnzb, int nrowb, int ncolb, int blockdim);
         virtual void SetDataPtrBCSR(int**       row_offset,
@@ -139,6 +139,25 @@ namespace rocalution
         LOG_INFO("HIPAcceleratorMatrixCSR<ValueType>");
     }
 
+    template <typename ValueType>
+    size_t HIPAcceleratorMatrixCSR<ValueType>::GetMemoryUsage(void) const
+    {
+        size_t bytes = BaseMatrix<ValueType>::GetMemoryUsage();
+
+        // rocSPARSE analysis buffer and temporary vector
+        if(this->mat_buffer_ != NULL)
+        {
+            bytes += this->mat_buffer_size_;
+        }
+
+        if(this->tmp_vec_ != NULL)
+        {
+            bytes += this->tmp_vec_->GetMemoryUsage();
+        }
+
+        return bytes;
+    }
+
     template <typename ValueType>
     void HIPAcceleratorMatrixCSR<ValueType>::AllocateCSR(int nnz, int nrow, int ncol)
     {
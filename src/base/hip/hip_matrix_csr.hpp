@@ -47,6 +47,8 @@ namespace rocalution
             return CSR;
         }
 
+        virtual size_t GetMemoryUsage(void) const;
+
         virtual void Clear(void);
         virtual bool Zeros(void);
 
@@ -124,6 +124,13 @@ namespace rocalution
         LOG_INFO("HIPAcceleratorMatrixHYB<ValueType>");
     }
 
+    template <typename ValueType>
+    size_t HIPAcceleratorMatrixHYB<ValueType>::GetMemoryUsage(void) const
+    {
+        return static_cast<size_t>(this->ell_nnz_) * (sizeof(int) + sizeof(ValueType))
+               + static_cast<size_t>(this->coo_nnz_) * (2 * sizeof(int) + sizeof(ValueType));
+    }
+
     template <typename ValueType>
     void HIPAcceleratorMatrixHYB<ValueType>::AllocateHYB(
         int ell_nnz, int coo_nnz, int ell_max_row, int nrow, int ncol)
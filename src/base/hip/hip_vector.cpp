@@ -85,8 +85,29 @@ namespace rocalution
         LOG_INFO("HIPAcceleratorVector<ValueType>");
     }
 
+    template <typename ValueType>
+    size_t HIPAcceleratorVector<ValueType>::GetMemoryUsage(void) const
+    {
+        // Boundary values are gathered into index_buffer_
+        return BaseVector<ValueType>::GetMemoryUsage()
+               + static_cast<size_t>(this->index_size_) * sizeof(ValueType);
+    }
+
     template <typename ValueType>
     void HIPAcceleratorVector<ValueType>::Allocate(int n)
+    {
+        this->AllocateUninitialized(n);
+
+        if(n > 0)
+        {
+            set_to_zero_hip(this->local_backend_.HIP_block_size, n, this->vec_);
+        }
+
+        CHECK_HIP_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void HIPAcceleratorVector<ValueType>::AllocateUninitialized(int n)
     {
         assert(n >= 0);
 
@@ -98,7 +119,6 @@ namespace rocalution
         if(n > 0)
         {
             allocate_hip(n, &this->vec_);
-            set_to_zero_hip(this->local_backend_.HIP_block_size, n, this->vec_);
 
             this->size_ = n;
         }
@@ -157,7 +177,7 @@ namespace rocalution
             if(this->size_ == 0)
             {
                 // Allocate local structure
-                this->Allocate(cast_vec->size_);
+                this->AllocateUninitialized(cast_vec->size_);
 
                 // Check for boundary
                 assert(this->index_size_ == 0);
@@ -209,7 +229,7 @@ namespace rocalution
             if(cast_vec->size_ == 0)
             {
                 // Allocate local vector
-                cast_vec->Allocate(this->size_);
+                cast_vec->AllocateUninitialized(this->size_);
 
                 // Check for boundary
                 assert(cast_vec->index_size_ == 0);
@@ -260,7 +280,7 @@ namespace rocalution
             if(this->size_ == 0)
             {
                 // Allocate local vector
-                this->Allocate(cast_vec->size_);
+                this->AllocateUninitialized(cast_vec->size_);
 
                 // Check for boundary
                 assert(this->index_size_ == 0);
@@ -312,7 +332,7 @@ namespace rocalution
             if(cast_vec->size_ == 0)
             {
                 // Allocate local vector
-                cast_vec->Allocate(this->size_);
+                cast_vec->AllocateUninitialized(this->size_);
 
                 // Check for boundary
                 assert(cast_vec->index_size_ == 0);
@@ -365,7 +385,7 @@ namespace rocalution
             if(this->size_ == 0)
             {
                 // Allocate local vector
-                this->Allocate(hip_cast_vec->size_);
+                this->AllocateUninitialized(hip_cast_vec->size_);
 
                 // Check for boundary
                 assert(this->index_size_ == 0);
@@ -430,7 +450,7 @@ namespace rocalution
             if(this->size_ == 0)
             {
                 // Allocate local vector
-                this->Allocate(hip_cast_vec->size_);
+                this->AllocateUninitialized(hip_cast_vec->size_);
 
                 // Check for boundary
                 assert(this->index_size_ == 0);
@@ -528,7 +548,7 @@ namespace rocalution
             if(hip_cast_vec->size_ == 0)
             {
                 // Allocate local vector
-                hip_cast_vec->Allocate(this->size_);
+                hip_cast_vec->AllocateUninitialized(this->size_);
 
                 // Check for boundary
                 assert(hip_cast_vec->index_size_ == 0);
@@ -593,7 +613,7 @@ namespace rocalution
             if(hip_cast_vec->size_ == 0)
             {
                 // Allocate local vector
-                hip_cast_vec->Allocate(this->size_);
+                hip_cast_vec->AllocateUninitialized(this->size_);
 
                 // Check for boundary
                 assert(hip_cast_vec->index_size_ == 0);
@@ -663,7 +683,7 @@ namespace rocalution
         {
             if(this->size_ == 0)
             {
-                this->Allocate(hip_cast_vec->size_);
+                this->AllocateUninitialized(hip_cast_vec->size_);
             }
 
             assert(hip_cast_vec->size_ == this->size_);
@@ -708,7 +728,7 @@ namespace rocalution
         {
             if(this->size_ == 0)
             {
-                this->Allocate(hip_cast_vec->size_);
+                this->AllocateUninitialized(hip_cast_vec->size_);
             }
 
             assert(hip_cast_vec->size_ == this->size_);
@@ -1281,7 +1301,7 @@ namespace rocalution
             assert(this->size_ == cast_perm->size_);
 
             HIPAcceleratorVector<ValueType> vec_tmp(this->local_backend_);
-            vec_tmp.Allocate(this->size_);
+            vec_tmp.AllocateUninitialized(this->size_);
             vec_tmp.CopyFrom(*this);
 
             int  size = this->size_;
@@ -1314,7 +1334,7 @@ namespace rocalution
             assert(this->size_ == cast_perm->size_);
 
             HIPAcceleratorVector<ValueType> vec_tmp(this->local_backend_);
-            vec_tmp.Allocate(this->size_);
+            vec_tmp.AllocateUninitialized(this->size_);
             vec_tmp.CopyFrom(*this);
 
             int  size = this->size_;
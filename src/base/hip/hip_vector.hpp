@@ -45,9 +45,11 @@ namespace rocalution
         explicit HIPAcceleratorVector(const Rocalution_Backend_Descriptor& local_backend);
         virtual ~HIPAcceleratorVector();
 
-        virtual void Info(void) const;
+        virtual void   Info(void) const;
+        virtual size_t GetMemoryUsage(void) const;
 
         virtual void Allocate(int n);
+        virtual void AllocateUninitialized(int n);
         virtual void SetDataPtr(ValueType** ptr, int size);
         virtual void LeaveDataPtr(ValueType** ptr);
         virtual void Clear(void);
@@ -0,0 +1,376 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2020 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_calibration.hpp"
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/time_functions.hpp"
+#include "../backend_manager.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    // Calibrated sizes are 2^HOST_CALIBRATION_MIN_LOG2, ..., 2^HOST_CALIBRATION_MAX_LOG2
+    static const int HOST_CALIBRATION_MIN_LOG2 = 8;
+    static const int HOST_CALIBRATION_MAX_LOG2 = 20;
+
+    // Minimum duration of a single measurement (in microseconds)
+    static const double HOST_CALIBRATION_TIME = 1000.0;
+
+    // Number of measurements per size, the fastest one is taken
+    static const int HOST_CALIBRATION_TRIALS = 3;
+
+    // Number of kernel classes
+    static const int HOST_CALIBRATION_KERNELS = 4;
+
+    // Buffers of the representative kernels, the matrix is a periodic tridiagonal matrix
+    // in CSR format
+    struct host_calibration_data
+    {
+        double* x;
+        double* y;
+        int*    row_offset;
+        int*    col;
+        double* val;
+        int*    row;
+
+        // Keeps the reductions from being optimized away
+        double sink;
+    };
+
+    static void host_calibration_kernel(int                    kernel,
+                                        int                    nthreads,
+                                        int                    size,
+                                        host_calibration_data& d)
+    {
+        double* x          = d.x;
+        double* y          = d.y;
+        int*    row_offset = d.row_offset;
+        int*    col        = d.col;
+        double* val        = d.val;
+        int*    row        = d.row;
+
+        switch(kernel)
+        {
+        case OpenMPKernelBLAS1:
+        {
+            // AXPY
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads)
+#endif
+            for(int i = 0; i < size; ++i)
+            {
+                y[i] += 0.5 * x[i];
+            }
+
+            break;
+        }
+        case OpenMPKernelReduction:
+        {
+            // Dot product
+            double sum = 0.0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : sum) num_threads(nthreads)
+#endif
+            for(int i = 0; i < size; ++i)
+            {
+                sum += x[i] * y[i];
+            }
+
+            d.sink += sum;
+
+            break;
+        }
+        case OpenMPKernelSpMV:
+        {
+            // CSR matrix-vector product with size rows
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads)
+#endif
+            for(int i = 0; i < size; ++i)
+            {
+                double sum = 0.0;
+
+                for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+                {
+                    sum += val[j] * x[col[j]];
+                }
+
+                y[i] = sum;
+            }
+
+            break;
+        }
+        case OpenMPKernelConversion:
+        {
+            // CSR to COO row index expansion with size non-zero entries
+            int nrow = size / 3;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads)
+#endif
+            for(int i = 0; i < nrow; ++i)
+            {
+                for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+                {
+                    row[j] = i;
+                }
+            }
+
+            break;
+        }
+        }
+    }
+
+    // Time (in microseconds) of a single kernel call
+    static double host_calibration_time(int                    kernel,
+                                        int                    nthreads,
+                                        int                    size,
+                                        host_calibration_data& d)
+    {
+        double best = 0.0;
+
+        for(int trial = 0; trial < HOST_CALIBRATION_TRIALS; ++trial)
+        {
+            int    calls   = 0;
+            double elapsed = 0.0;
+            double start   = rocalution_time();
+
+            do
+            {
+                host_calibration_kernel(kernel, nthreads, size, d);
+
+                ++calls;
+                elapsed = rocalution_time() - start;
+            } while(elapsed < HOST_CALIBRATION_TIME);
+
+            double t = elapsed / calls;
+
+            if(trial == 0 || t < best)
+            {
+                best = t;
+            }
+        }
+
+        return best;
+    }
+
+    void rocalution_calibrate_omp_thresholds(int nthreads, int* threshold)
+    {
+        log_debug(0, "rocalution_calibrate_omp_thresholds()", nthreads, threshold);
+
+        assert(nthreads > 0);
+        assert(threshold != NULL);
+
+        int max_size = 1 << HOST_CALIBRATION_MAX_LOG2;
+        int max_nnz  = 3 * max_size;
+
+        host_calibration_data d;
+
+        d.x          = NULL;
+        d.y          = NULL;
+        d.row_offset = NULL;
+        d.col        = NULL;
+        d.val        = NULL;
+        d.row        = NULL;
+        d.sink       = 0.0;
+
+        allocate_host(max_size, &d.x);
+        allocate_host(max_size, &d.y);
+        allocate_host(max_size + 1, &d.row_offset);
+        allocate_host(max_nnz, &d.col);
+        allocate_host(max_nnz, &d.val);
+        allocate_host(max_nnz, &d.row);
+
+        for(int i = 0; i < max_size; ++i)
+        {
+            d.x[i] = 1.0;
+            d.y[i] = 0.0;
+
+            d.row_offset[i] = 3 * i;
+
+            d.col[3 * i]     = (i + max_size - 1) % max_size;
+            d.col[3 * i + 1] = i;
+            d.col[3 * i + 2] = (i + 1) % max_size;
+
+            d.val[3 * i]     = -1.0;
+            d.val[3 * i + 1] = 2.0;
+            d.val[3 * i + 2] = -1.0;
+        }
+
+        d.row_offset[max_size] = max_nnz;
+
+        set_to_zero_host(max_nnz, d.row);
+
+        for(int k = 0; k < HOST_CALIBRATION_KERNELS; ++k)
+        {
+            // The crossover point is searched from the largest size downwards, sizes
+            // below the smallest calibrated size always run on a single thread
+            threshold[k] = max_size;
+
+            for(int e = HOST_CALIBRATION_MAX_LOG2; e >= HOST_CALIBRATION_MIN_LOG2; --e)
+            {
+                int size = 1 << e;
+
+                double t_single = host_calibration_time(k, 1, size, d);
+                double t_multi  = host_calibration_time(k, nthreads, size, d);
+
+                if(t_single <= t_multi)
+                {
+                    threshold[k] = size;
+                    break;
+                }
+
+                threshold[k] = size / 2;
+            }
+        }
+
+        LOG_VERBOSE_INFO(2,
+                         "OpenMP thresholds (" << nthreads << " threads): BLAS1 " << threshold[0]
+                                               << ", reduction " << threshold[1] << ", SpMV "
+                                               << threshold[2] << ", conversion "
+                                               << threshold[3]);
+
+        free_host(&d.x);
+        free_host(&d.y);
+        free_host(&d.row_offset);
+        free_host(&d.col);
+        free_host(&d.val);
+        free_host(&d.row);
+    }
+
+    bool rocalution_read_omp_thresholds(const std::string& filename, int nthreads, int* threshold)
+    {
+        log_debug(0, "rocalution_read_omp_thresholds()", filename, nthreads, threshold);
+
+        std::ifstream file(filename.c_str());
+
+        if(file.is_open() == false)
+        {
+            return false;
+        }
+
+        std::string line;
+
+        while(std::getline(file, line))
+        {
+            if(line.empty() == true || line[0] == '#')
+            {
+                continue;
+            }
+
+            std::istringstream entry(line);
+
+            int n;
+            int t[HOST_CALIBRATION_KERNELS];
+
+            entry >> n;
+
+            for(int k = 0; k < HOST_CALIBRATION_KERNELS; ++k)
+            {
+                entry >> t[k];
+            }
+
+            if(entry.fail() == false && n == nthreads)
+            {
+                for(int k = 0; k < HOST_CALIBRATION_KERNELS; ++k)
+                {
+                    threshold[k] = t[k];
+                }
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void rocalution_write_omp_thresholds(const std::string& filename,
+                                         int                nthreads,
+                                         const int*         threshold)
+    {
+        log_debug(0, "rocalution_write_omp_thresholds()", filename, nthreads, threshold);
+
+        // Keep the entries of all other thread counts
+        std::vector<std::string> lines;
+
+        std::ifstream in(filename.c_str());
+        std::string   line;
+
+        while(std::getline(in, line))
+        {
+            if(line.empty() == true || line[0] == '#')
+            {
+                continue;
+            }
+
+            std::istringstream entry(line);
+
+            int n;
+            entry >> n;
+
+            if(entry.fail() == false && n != nthreads)
+            {
+                lines.push_back(line);
+            }
+        }
+
+        in.close();
+
+        std::ofstream out(filename.c_str(), std::ios::trunc);
+
+        if(out.is_open() == false)
+        {
+            LOG_INFO("Cannot write OpenMP thresholds to file " << filename);
+            return;
+        }
+
+        out << "# rocALUTION OpenMP thresholds: threads BLAS1 reduction SpMV conversion"
+            << std::endl;
+
+        for(size_t i = 0; i < lines.size(); ++i)
+        {
+            out << lines[i] << std::endl;
+        }
+
+        out << nthreads;
+
+        for(int k = 0; k < HOST_CALIBRATION_KERNELS; ++k)
+        {
+            out << " " << threshold[k];
+        }
+
+        out << std::endl;
+    }
+
+} // namespace rocalution
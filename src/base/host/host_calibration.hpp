@@ -0,0 +1,47 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2020 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_HOST_CALIBRATION_HPP_
+#define ROCALUTION_HOST_HOST_CALIBRATION_HPP_
+
+#include <string>
+
+namespace rocalution
+{
+
+    // Measure the OpenMP threshold size of each kernel class (see _omp_kernel_class) for
+    // the given number of threads
+    void rocalution_calibrate_omp_thresholds(int nthreads, int* threshold);
+
+    // Read the thresholds for the given number of threads from a calibration file, returns
+    // false if the file does not exist or does not contain an entry for nthreads
+    bool rocalution_read_omp_thresholds(const std::string& filename, int nthreads, int* threshold);
+
+    // Add (or replace) the thresholds for the given number of threads to a calibration file
+    void rocalution_write_omp_thresholds(const std::string& filename,
+                                         int                nthreads,
+                                         const int*         threshold);
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_CALIBRATION_HPP_
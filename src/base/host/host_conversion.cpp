@@ -28,6 +28,7 @@
 #include "../matrix_formats.hpp"
 #include "../matrix_formats_ind.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <stdlib.h>
 
@@ -114,9 +115,6 @@ namespace rocalution
         allocate_host(*nnz, &dst->col);
         allocate_host(*nnz, &dst->val);
 
-        set_to_zero_host(*nnz, dst->col);
-        set_to_zero_host(*nnz, dst->val);
-
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -184,7 +182,6 @@ namespace rocalution
         allocate_host(nnz, &dst->col);
         allocate_host(nnz, &dst->val);
 
-        set_to_zero_host(nrow + 1, dst->row_offset);
         set_to_zero_host(nnz, dst->col);
         set_to_zero_host(nnz, dst->val);
 
@@ -250,10 +247,6 @@ namespace rocalution
         allocate_host(nnz, &dst->col);
         allocate_host(nnz, &dst->val);
 
-        set_to_zero_host(nrow + 1, dst->row_offset);
-        set_to_zero_host(nnz, dst->col);
-        set_to_zero_host(nnz, dst->val);
-
         for(IndexType ai = 0; ai < nrow + 1; ++ai)
         {
             dst->row_offset[ai] = src.row_offset[ai] - nrow + ai;
@@ -557,7 +550,8 @@ namespace rocalution
                     for(IndexType c = 0; c < src.blockdim; ++c)
                     {
                         dst->col[idx] = src.blockdim * src.col[k] + c;
-                        dst->val[idx] = src.val[BCSR_IND(k, c, r, src.blockdim)];
+                        dst->val[idx] = src.val[BCSR_IND(
+                            src.blockdim * src.blockdim * k, r, c, src.blockdim)];
 
                         ++idx;
                     }
@@ -590,10 +584,6 @@ namespace rocalution
         allocate_host(nnz, &dst->col);
         allocate_host(nnz, &dst->val);
 
-        set_to_zero_host(nnz, dst->row);
-        set_to_zero_host(nnz, dst->col);
-        set_to_zero_host(nnz, dst->val);
-
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -661,9 +651,6 @@ namespace rocalution
         allocate_host(*nnz_ell, &dst->val);
         allocate_host(*nnz_ell, &dst->col);
 
-        set_to_zero_host(*nnz_ell, dst->val);
-        set_to_zero_host(*nnz_ell, dst->col);
-
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -740,9 +727,6 @@ namespace rocalution
         allocate_host(*nnz_csr, &dst->col);
         allocate_host(*nnz_csr, &dst->val);
 
-        set_to_zero_host(*nnz_csr, dst->col);
-        set_to_zero_host(*nnz_csr, dst->val);
-
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -766,6 +750,200 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType, typename IndexType>
+    bool csr_to_sell(int                                    omp_threads,
+                     IndexType                              nnz,
+                     IndexType                              nrow,
+                     IndexType                              ncol,
+                     IndexType                              slice_size,
+                     IndexType                              sigma,
+                     const MatrixCSR<ValueType, IndexType>& src,
+                     MatrixSELL<ValueType, IndexType>*      dst,
+                     IndexType*                             nnz_sell)
+    {
+        assert(nnz > 0);
+        assert(nrow > 0);
+        assert(ncol > 0);
+        assert(slice_size > 0);
+        assert(sigma > 0);
+        assert(sigma % slice_size == 0);
+
+        omp_set_num_threads(omp_threads);
+
+        dst->slice_size = slice_size;
+        dst->sigma      = sigma;
+        dst->nslice     = (nrow - 1) / slice_size + 1;
+
+        IndexType nrow_pad = dst->nslice * slice_size;
+
+        allocate_host(dst->nslice + 1, &dst->slice_offset);
+        allocate_host(nrow_pad, &dst->perm);
+        allocate_host(nrow_pad, &dst->row_length);
+
+        // Sort the rows of each sigma window by descending length, such that rows of
+        // similar length share a slice
+        IndexType nwindow = (nrow - 1) / sigma + 1;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType w = 0; w < nwindow; ++w)
+        {
+            IndexType begin = w * sigma;
+            IndexType end   = std::min(begin + sigma, nrow);
+
+            for(IndexType i = begin; i < end; ++i)
+            {
+                dst->perm[i] = i;
+            }
+
+            std::stable_sort(dst->perm + begin, dst->perm + end, [&](IndexType a, IndexType b) {
+                return src.row_offset[a + 1] - src.row_offset[a]
+                       > src.row_offset[b + 1] - src.row_offset[b];
+            });
+        }
+
+        for(IndexType i = 0; i < nrow_pad; ++i)
+        {
+            if(i < nrow)
+            {
+                IndexType ai = dst->perm[i];
+
+                dst->row_length[i] = src.row_offset[ai + 1] - src.row_offset[ai];
+            }
+            else
+            {
+                dst->perm[i]       = static_cast<IndexType>(-1);
+                dst->row_length[i] = 0;
+            }
+        }
+
+        // Slice offsets, each slice is padded to its longest row
+        dst->slice_offset[0] = 0;
+        for(IndexType s = 0; s < dst->nslice; ++s)
+        {
+            IndexType width = 0;
+
+            for(IndexType r = 0; r < slice_size; ++r)
+            {
+                width = std::max(width, dst->row_length[s * slice_size + r]);
+            }
+
+            dst->slice_offset[s + 1] = dst->slice_offset[s] + width * slice_size;
+        }
+
+        *nnz_sell = dst->slice_offset[dst->nslice];
+
+        allocate_host(*nnz_sell, &dst->col);
+        allocate_host(*nnz_sell, &dst->val);
+
+        // Padding elements repeat the last column of their row with a zero value, such that
+        // the SpMV does not need to branch on them
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType s = 0; s < dst->nslice; ++s)
+        {
+            IndexType offset = dst->slice_offset[s];
+            IndexType width  = (dst->slice_offset[s + 1] - offset) / slice_size;
+
+            for(IndexType r = 0; r < slice_size; ++r)
+            {
+                IndexType ai      = dst->perm[s * slice_size + r];
+                IndexType pad_col = 0;
+                IndexType n       = 0;
+
+                if(ai >= 0)
+                {
+                    for(IndexType aj = src.row_offset[ai]; aj < src.row_offset[ai + 1]; ++aj)
+                    {
+                        IndexType ind = SELL_IND(offset, r, n, slice_size);
+
+                        dst->col[ind] = src.col[aj];
+                        dst->val[ind] = src.val[aj];
+                        pad_col       = src.col[aj];
+                        ++n;
+                    }
+                }
+
+                for(; n < width; ++n)
+                {
+                    IndexType ind = SELL_IND(offset, r, n, slice_size);
+
+                    dst->col[ind] = pad_col;
+                    dst->val[ind] = static_cast<ValueType>(0);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType, typename IndexType>
+    bool sell_to_csr(int                                     omp_threads,
+                     IndexType                               nnz,
+                     IndexType                               nrow,
+                     IndexType                               ncol,
+                     const MatrixSELL<ValueType, IndexType>& src,
+                     MatrixCSR<ValueType, IndexType>*        dst,
+                     IndexType*                              nnz_csr)
+    {
+        assert(nnz > 0);
+        assert(nrow > 0);
+        assert(ncol > 0);
+
+        omp_set_num_threads(omp_threads);
+
+        allocate_host(nrow + 1, &dst->row_offset);
+        set_to_zero_host(nrow + 1, dst->row_offset);
+
+        for(IndexType i = 0; i < nrow; ++i)
+        {
+            dst->row_offset[src.perm[i] + 1] = src.row_length[i];
+        }
+
+        for(IndexType i = 0; i < nrow; ++i)
+        {
+            dst->row_offset[i + 1] += dst->row_offset[i];
+        }
+
+        *nnz_csr = dst->row_offset[nrow];
+
+        allocate_host(*nnz_csr, &dst->col);
+        allocate_host(*nnz_csr, &dst->val);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(IndexType s = 0; s < src.nslice; ++s)
+        {
+            IndexType offset = src.slice_offset[s];
+
+            for(IndexType r = 0; r < src.slice_size; ++r)
+            {
+                IndexType i = s * src.slice_size + r;
+
+                if(i >= nrow)
+                {
+                    break;
+                }
+
+                IndexType ind = dst->row_offset[src.perm[i]];
+
+                for(IndexType n = 0; n < src.row_length[i]; ++n)
+                {
+                    IndexType aj = SELL_IND(offset, r, n, src.slice_size);
+
+                    dst->col[ind] = src.col[aj];
+                    dst->val[ind] = src.val[aj];
+                    ++ind;
+                }
+            }
+        }
+
+        return true;
+    }
+
     template <typename ValueType, typename IndexType>
     bool hyb_to_csr(int                                    omp_threads,
                     IndexType                              nnz,
@@ -836,9 +1014,6 @@ namespace rocalution
         allocate_host(*nnz_csr, &dst->col);
         allocate_host(*nnz_csr, &dst->val);
 
-        set_to_zero_host(*nnz_csr, dst->col);
-        set_to_zero_host(*nnz_csr, dst->val);
-
         start = 0;
 
         // TODO
@@ -1565,6 +1740,82 @@ namespace rocalution
                              MatrixELL<int, int>*       dst,
                              int*                       nnz_ell);
 
+    template bool csr_to_sell(int                           omp_threads,
+                              int                           nnz,
+                              int                           nrow,
+                              int                           ncol,
+                              int                           slice_size,
+                              int                           sigma,
+                              const MatrixCSR<double, int>& src,
+                              MatrixSELL<double, int>*      dst,
+                              int*                          nnz_sell);
+
+    template bool csr_to_sell(int                          omp_threads,
+                              int                          nnz,
+                              int                          nrow,
+                              int                          ncol,
+                              int                          slice_size,
+                              int                          sigma,
+                              const MatrixCSR<float, int>& src,
+                              MatrixSELL<float, int>*      dst,
+                              int*                         nnz_sell);
+
+#ifdef SUPPORT_COMPLEX
+    template bool csr_to_sell(int                                         omp_threads,
+                              int                                         nnz,
+                              int                                         nrow,
+                              int                                         ncol,
+                              int                                         slice_size,
+                              int                                         sigma,
+                              const MatrixCSR<std::complex<double>, int>& src,
+                              MatrixSELL<std::complex<double>, int>*      dst,
+                              int*                                        nnz_sell);
+
+    template bool csr_to_sell(int                                        omp_threads,
+                              int                                        nnz,
+                              int                                        nrow,
+                              int                                        ncol,
+                              int                                        slice_size,
+                              int                                        sigma,
+                              const MatrixCSR<std::complex<float>, int>& src,
+                              MatrixSELL<std::complex<float>, int>*      dst,
+                              int*                                       nnz_sell);
+#endif
+
+    template bool sell_to_csr(int                            omp_threads,
+                              int                            nnz,
+                              int                            nrow,
+                              int                            ncol,
+                              const MatrixSELL<double, int>& src,
+                              MatrixCSR<double, int>*        dst,
+                              int*                           nnz_csr);
+
+    template bool sell_to_csr(int                           omp_threads,
+                              int                           nnz,
+                              int                           nrow,
+                              int                           ncol,
+                              const MatrixSELL<float, int>& src,
+                              MatrixCSR<float, int>*        dst,
+                              int*                          nnz_csr);
+
+#ifdef SUPPORT_COMPLEX
+    template bool sell_to_csr(int                                          omp_threads,
+                              int                                          nnz,
+                              int                                          nrow,
+                              int                                          ncol,
+                              const MatrixSELL<std::complex<double>, int>& src,
+                              MatrixCSR<std::complex<double>, int>*        dst,
+                              int*                                         nnz_csr);
+
+    template bool sell_to_csr(int                                         omp_threads,
+                              int                                         nnz,
+                              int                                         nrow,
+                              int                                         ncol,
+                              const MatrixSELL<std::complex<float>, int>& src,
+                              MatrixCSR<std::complex<float>, int>*        dst,
+                              int*                                        nnz_csr);
+#endif
+
     template bool csr_to_dense(int                           omp_threads,
                                int                           nnz,
                                int                           nrow,
@@ -79,6 +79,17 @@ namespace rocalution
                     MatrixELL<ValueType, IndexType>*       dst,
                     IndexType*                             nnz_ell);
 
+    template <typename ValueType, typename IndexType>
+    bool csr_to_sell(int                                    omp_threads,
+                     IndexType                              nnz,
+                     IndexType                              nrow,
+                     IndexType                              ncol,
+                     IndexType                              slice_size,
+                     IndexType                              sigma,
+                     const MatrixCSR<ValueType, IndexType>& src,
+                     MatrixSELL<ValueType, IndexType>*      dst,
+                     IndexType*                             nnz_sell);
+
     template <typename ValueType, typename IndexType>
     bool csr_to_hyb(int                                    omp_threads,
                     IndexType                              nnz,
@@ -124,6 +135,15 @@ namespace rocalution
                     MatrixCSR<ValueType, IndexType>*       dst,
                     IndexType*                             nnz_csr);
 
+    template <typename ValueType, typename IndexType>
+    bool sell_to_csr(int                                     omp_threads,
+                     IndexType                               nnz,
+                     IndexType                               nrow,
+                     IndexType                               ncol,
+                     const MatrixSELL<ValueType, IndexType>& src,
+                     MatrixCSR<ValueType, IndexType>*        dst,
+                     IndexType*                              nnz_csr);
+
     template <typename ValueType, typename IndexType>
     bool coo_to_csr(int                                    omp_threads,
                     IndexType                              nnz,
@@ -31,6 +31,7 @@
 #include "host_vector.hpp"
 
 #include <complex>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -41,6 +42,404 @@
 namespace rocalution
 {
 
+    // BCSR SpMV y = scalar * A * x (+ y) with the block dimension known at compile time,
+    // such that the block loops can be fully unrolled and vectorized
+    template <int BLOCKDIM, typename ValueType>
+    static void bcsr_spmv(int                    nrowb,
+                          const int*             row_offset,
+                          const int*             col,
+                          const ValueType*       val,
+                          ValueType              scalar,
+                          bool                   add,
+                          const ValueType* const in,
+                          ValueType* const       out)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            ValueType sum[BLOCKDIM];
+
+            for(int bi = 0; bi < BLOCKDIM; ++bi)
+            {
+                sum[bi] = static_cast<ValueType>(0);
+            }
+
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                const ValueType* blk = val + BLOCKDIM * BLOCKDIM * aj;
+                const ValueType* x   = in + BLOCKDIM * col[aj];
+
+                for(int bj = 0; bj < BLOCKDIM; ++bj)
+                {
+                    for(int bi = 0; bi < BLOCKDIM; ++bi)
+                    {
+                        sum[bi] += blk[BCSR_IND(0, bi, bj, BLOCKDIM)] * x[bj];
+                    }
+                }
+            }
+
+            ValueType* y = out + BLOCKDIM * ai;
+
+            for(int bi = 0; bi < BLOCKDIM; ++bi)
+            {
+                y[bi] = add ? y[bi] + scalar * sum[bi] : scalar * sum[bi];
+            }
+        }
+    }
+
+    // BCSR SpMV y = scalar * A * x (+ y) for arbitrary block dimensions
+    template <typename ValueType>
+    static void bcsr_spmv_generic(int                    nrowb,
+                                  int                    blockdim,
+                                  const int*             row_offset,
+                                  const int*             col,
+                                  const ValueType*       val,
+                                  ValueType              scalar,
+                                  bool                   add,
+                                  const ValueType* const in,
+                                  ValueType* const       out)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            for(int bi = 0; bi < blockdim; ++bi)
+            {
+                int row_begin = row_offset[ai];
+                int row_end   = row_offset[ai + 1];
+
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int aj = row_begin; aj < row_end; ++aj)
+                {
+                    int c = col[aj];
+
+                    for(int bj = 0; bj < blockdim; ++bj)
+                    {
+                        sum += val[BCSR_IND(blockdim * blockdim * aj, bi, bj, blockdim)]
+                               * in[blockdim * c + bj];
+                    }
+                }
+
+                if(add == true)
+                {
+                    out[ai * blockdim + bi] += scalar * sum;
+                }
+                else
+                {
+                    out[ai * blockdim + bi] = scalar * sum;
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    static void bcsr_spmv_dispatch(const MatrixBCSR<ValueType, int>& mat,
+                                   int                               nrowb,
+                                   ValueType                         scalar,
+                                   bool                              add,
+                                   const ValueType*                  in,
+                                   ValueType*                        out)
+    {
+        const int*       row = mat.row_offset;
+        const int*       col = mat.col;
+        const ValueType* val = mat.val;
+
+        switch(mat.blockdim)
+        {
+        case 2:
+            bcsr_spmv<2>(nrowb, row, col, val, scalar, add, in, out);
+            break;
+        case 3:
+            bcsr_spmv<3>(nrowb, row, col, val, scalar, add, in, out);
+            break;
+        case 4:
+            bcsr_spmv<4>(nrowb, row, col, val, scalar, add, in, out);
+            break;
+        case 5:
+            bcsr_spmv<5>(nrowb, row, col, val, scalar, add, in, out);
+            break;
+        case 6:
+            bcsr_spmv<6>(nrowb, row, col, val, scalar, add, in, out);
+            break;
+        case 7:
+            bcsr_spmv<7>(nrowb, row, col, val, scalar, add, in, out);
+            break;
+        case 8:
+            bcsr_spmv<8>(nrowb, row, col, val, scalar, add, in, out);
+            break;
+        default:
+            bcsr_spmv_generic(nrowb, mat.blockdim, row, col, val, scalar, add, in, out);
+            break;
+        }
+    }
+
+    // Extract the (inverse) diagonal entries of the diagonal blocks, returns true if a zero
+    // diagonal entry has been replaced by one
+    template <int BLOCKDIM, typename ValueType>
+    static bool bcsr_extract_diag(int              nrowb,
+                                  int              blockdim,
+                                  const int*       row_offset,
+                                  const int*       col,
+                                  const ValueType* val,
+                                  bool             inverse,
+                                  ValueType*       diag)
+    {
+        // Compile time block dimension, if available
+        const int dim = BLOCKDIM > 0 ? BLOCKDIM : blockdim;
+
+        int detect_zero_diag = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(| : detect_zero_diag)
+#endif
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                if(col[aj] == ai)
+                {
+                    const ValueType* blk = val + dim * dim * aj;
+
+                    for(int bi = 0; bi < dim; ++bi)
+                    {
+                        ValueType d = blk[BCSR_IND(0, bi, bi, dim)];
+
+                        if(inverse == false)
+                        {
+                            diag[dim * ai + bi] = d;
+                        }
+                        else if(d != static_cast<ValueType>(0))
+                        {
+                            diag[dim * ai + bi] = static_cast<ValueType>(1) / d;
+                        }
+                        else
+                        {
+                            diag[dim * ai + bi] = static_cast<ValueType>(1);
+                            detect_zero_diag    = 1;
+                        }
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        return detect_zero_diag == 1;
+    }
+
+    template <typename ValueType>
+    static bool bcsr_extract_diag_dispatch(const MatrixBCSR<ValueType, int>& mat,
+                                           bool                              inverse,
+                                           ValueType*                        diag)
+    {
+        const int*       row = mat.row_offset;
+        const int*       col = mat.col;
+        const ValueType* val = mat.val;
+
+        int nrowb = mat.nrowb;
+        int dim   = mat.blockdim;
+
+        switch(dim)
+        {
+        case 2:
+            return bcsr_extract_diag<2>(nrowb, dim, row, col, val, inverse, diag);
+        case 3:
+            return bcsr_extract_diag<3>(nrowb, dim, row, col, val, inverse, diag);
+        case 4:
+            return bcsr_extract_diag<4>(nrowb, dim, row, col, val, inverse, diag);
+        case 5:
+            return bcsr_extract_diag<5>(nrowb, dim, row, col, val, inverse, diag);
+        case 6:
+            return bcsr_extract_diag<6>(nrowb, dim, row, col, val, inverse, diag);
+        case 7:
+            return bcsr_extract_diag<7>(nrowb, dim, row, col, val, inverse, diag);
+        case 8:
+            return bcsr_extract_diag<8>(nrowb, dim, row, col, val, inverse, diag);
+        default:
+            return bcsr_extract_diag<0>(nrowb, dim, row, col, val, inverse, diag);
+        }
+    }
+
+    // Dense block helpers, blocks are dim x dim and stored column-major (see BCSR_IND)
+
+    // C = C - A * B
+    template <typename ValueType>
+    static void bcsr_block_gemm_sub(int dim, const ValueType* A, const ValueType* B, ValueType* C)
+    {
+        for(int c = 0; c < dim; ++c)
+        {
+            for(int k = 0; k < dim; ++k)
+            {
+                ValueType b = B[BCSR_IND(0, k, c, dim)];
+
+                for(int r = 0; r < dim; ++r)
+                {
+                    C[BCSR_IND(0, r, c, dim)] -= A[BCSR_IND(0, r, k, dim)] * b;
+                }
+            }
+        }
+    }
+
+    // In-place LU factorization of a block without pivoting, L has unit diagonal and is
+    // stored in the strictly lower part
+    template <typename ValueType>
+    static void bcsr_block_lu(int dim, ValueType* A)
+    {
+        for(int k = 0; k < dim; ++k)
+        {
+            ValueType inv_pivot = static_cast<ValueType>(1) / A[BCSR_IND(0, k, k, dim)];
+
+            for(int r = k + 1; r < dim; ++r)
+            {
+                A[BCSR_IND(0, r, k, dim)] *= inv_pivot;
+            }
+
+            for(int c = k + 1; c < dim; ++c)
+            {
+                ValueType u = A[BCSR_IND(0, k, c, dim)];
+
+                for(int r = k + 1; r < dim; ++r)
+                {
+                    A[BCSR_IND(0, r, c, dim)] -= A[BCSR_IND(0, r, k, dim)] * u;
+                }
+            }
+        }
+    }
+
+    // Invert the triangular factors of a packed LU block, the result is packed the same way,
+    // i.e. inv(L) in the strictly lower part (unit diagonal) and inv(U) in the upper part
+    template <typename ValueType>
+    static void bcsr_block_lu_invert(int dim, const ValueType* LU, ValueType* inv)
+    {
+        for(int c = 0; c < dim; ++c)
+        {
+            // inv(U), column c from the diagonal upwards
+            inv[BCSR_IND(0, c, c, dim)] = static_cast<ValueType>(1) / LU[BCSR_IND(0, c, c, dim)];
+
+            for(int r = c - 1; r >= 0; --r)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int m = r + 1; m <= c; ++m)
+                {
+                    sum += LU[BCSR_IND(0, r, m, dim)] * inv[BCSR_IND(0, m, c, dim)];
+                }
+
+                inv[BCSR_IND(0, r, c, dim)] = -sum / LU[BCSR_IND(0, r, r, dim)];
+            }
+
+            // inv(L), column c below the diagonal
+            for(int r = c + 1; r < dim; ++r)
+            {
+                ValueType sum = LU[BCSR_IND(0, r, c, dim)];
+
+                for(int m = c + 1; m < r; ++m)
+                {
+                    sum += LU[BCSR_IND(0, r, m, dim)] * inv[BCSR_IND(0, m, c, dim)];
+                }
+
+                inv[BCSR_IND(0, r, c, dim)] = -sum;
+            }
+        }
+    }
+
+    // Block LU solve with the inverted diagonal blocks, work has to hold dim elements
+    template <int BLOCKDIM, typename ValueType>
+    static void bcsr_lusolve(int              nrowb,
+                             int              blockdim,
+                             const int*       row_offset,
+                             const int*       col,
+                             const ValueType* val,
+                             const int*       diag,
+                             const ValueType* diag_inv,
+                             const ValueType* in,
+                             ValueType*       work,
+                             ValueType*       out)
+    {
+        // Compile time block dimension, if available
+        const int dim = BLOCKDIM > 0 ? BLOCKDIM : blockdim;
+
+        // Solve L
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            for(int bi = 0; bi < dim; ++bi)
+            {
+                work[bi] = in[dim * ai + bi];
+            }
+
+            for(int aj = row_offset[ai]; aj < diag[ai]; ++aj)
+            {
+                const ValueType* blk = val + dim * dim * aj;
+                const ValueType* x   = out + dim * col[aj];
+
+                for(int bj = 0; bj < dim; ++bj)
+                {
+                    for(int bi = 0; bi < dim; ++bi)
+                    {
+                        work[bi] -= blk[BCSR_IND(0, bi, bj, dim)] * x[bj];
+                    }
+                }
+            }
+
+            // Unit lower triangular part of the inverted diagonal block
+            const ValueType* inv = diag_inv + dim * dim * ai;
+
+            for(int bi = 0; bi < dim; ++bi)
+            {
+                ValueType sum = work[bi];
+
+                for(int bj = 0; bj < bi; ++bj)
+                {
+                    sum += inv[BCSR_IND(0, bi, bj, dim)] * work[bj];
+                }
+
+                out[dim * ai + bi] = sum;
+            }
+        }
+
+        // Solve U
+        for(int ai = nrowb - 1; ai >= 0; --ai)
+        {
+            for(int bi = 0; bi < dim; ++bi)
+            {
+                work[bi] = out[dim * ai + bi];
+            }
+
+            for(int aj = diag[ai] + 1; aj < row_offset[ai + 1]; ++aj)
+            {
+                const ValueType* blk = val + dim * dim * aj;
+                const ValueType* x   = out + dim * col[aj];
+
+                for(int bj = 0; bj < dim; ++bj)
+                {
+                    for(int bi = 0; bi < dim; ++bi)
+                    {
+                        work[bi] -= blk[BCSR_IND(0, bi, bj, dim)] * x[bj];
+                    }
+                }
+            }
+
+            // Upper triangular part of the inverted diagonal block
+            const ValueType* inv = diag_inv + dim * dim * ai;
+
+            for(int bi = 0; bi < dim; ++bi)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int bj = bi; bj < dim; ++bj)
+                {
+                    sum += inv[BCSR_IND(0, bi, bj, dim)] * work[bj];
+                }
+
+                out[dim * ai + bi] = sum;
+            }
+        }
+    }
+
     template <typename ValueType>
     HostMatrixBCSR<ValueType>::HostMatrixBCSR()
     {
@@ -60,6 +459,9 @@ namespace rocalution
         this->mat_.val        = NULL;
         this->mat_.blockdim   = blockdim;
 
+        this->lu_diag_     = NULL;
+        this->lu_diag_inv_ = NULL;
+
         this->set_backend(local_backend);
     }
 
@@ -77,9 +479,27 @@ namespace rocalution
         LOG_INFO("HostMatrixBCSR<ValueType>");
     }
 
+    template <typename ValueType>
+    size_t HostMatrixBCSR<ValueType>::GetMemoryUsage(void) const
+    {
+        size_t bytes = BaseMatrix<ValueType>::GetMemoryUsage();
+
+        // Inverted diagonal blocks of the LU factorization
+        if(this->lu_diag_ != NULL)
+        {
+            size_t dim2 = this->mat_.blockdim * this->mat_.blockdim;
+
+            bytes += this->mat_.nrowb * (sizeof(int) + dim2 * sizeof(ValueType));
+        }
+
+        return bytes;
+    }
+
     template <typename ValueType>
     void HostMatrixBCSR<ValueType>::Clear()
     {
+        this->LUAnalyseClear();
+
         if(this->nnz_ > 0)
         {
             free_host(&this->mat_.row_offset);
@@ -166,6 +586,8 @@ namespace rocalution
         assert(this->nnz_ > 0);
         assert(this->mat_.blockdim > 1);
 
+        this->LUAnalyseClear();
+
         *row_offset = this->mat_.row_offset;
         *col        = this->mat_.col;
         *val        = this->mat_.val;
@@ -267,7 +689,10 @@ namespace rocalution
         {
             this->Clear();
 
-            if(csr_to_bcsr(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(csr_to_bcsr(nthreads,
                            cast_mat->nnz_,
                            cast_mat->nrow_,
                            cast_mat->ncol_,
@@ -303,36 +728,14 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->mat_.nrowb);
-
-            int bsrdim = this->mat_.blockdim;
+            _set_omp_backend_threads(this->local_backend_, this->mat_.nrowb, OpenMPKernelSpMV);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int ai = 0; ai < this->mat_.nrowb; ++ai)
-            {
-                for(int bi = 0; bi < bsrdim; ++bi)
-                {
-                    int row_begin = this->mat_.row_offset[ai];
-                    int row_end   = this->mat_.row_offset[ai + 1];
-
-                    ValueType sum = static_cast<ValueType>(0);
-
-                    for(int aj = row_begin; aj < row_end; ++aj)
-                    {
-                        int col = this->mat_.col[aj];
-
-                        for(int bj = 0; bj < bsrdim; ++bj)
-                        {
-                            sum += this->mat_.val[BCSR_IND(bsrdim * bsrdim * aj, bi, bj, bsrdim)]
-                                   * cast_in->vec_[bsrdim * col + bj];
-                        }
-                    }
-
-                    cast_out->vec_[ai * bsrdim + bi] = sum;
-                }
-            }
+            bcsr_spmv_dispatch(this->mat_,
+                               this->mat_.nrowb,
+                               static_cast<ValueType>(1),
+                               false,
+                               cast_in->vec_,
+                               cast_out->vec_);
         }
     }
 
@@ -354,38 +757,348 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
             assert(this->nrow_ == this->ncol_);
 
-            int bsrdim = this->mat_.blockdim;
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int ai = 0; ai < this->mat_.nrowb; ++ai)
+            bcsr_spmv_dispatch(
+                this->mat_, this->mat_.nrowb, scalar, true, cast_in->vec_, cast_out->vec_);
+        }
+    }
+
+    template <typename ValueType>
+    bool HostMatrixBCSR<ValueType>::ExtractDiagonal(BaseVector<ValueType>* vec_diag) const
+    {
+        assert(vec_diag != NULL);
+        assert(vec_diag->GetSize() == this->nrow_);
+        assert(this->mat_.nrowb == this->mat_.ncolb);
+
+        HostVector<ValueType>* cast_vec_diag = dynamic_cast<HostVector<ValueType>*>(vec_diag);
+
+        assert(cast_vec_diag != NULL);
+
+        _set_omp_backend_threads(this->local_backend_, this->mat_.nrowb);
+
+        bcsr_extract_diag_dispatch(this->mat_, false, cast_vec_diag->vec_);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool
+        HostMatrixBCSR<ValueType>::ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const
+    {
+        assert(vec_inv_diag != NULL);
+        assert(vec_inv_diag->GetSize() == this->nrow_);
+        assert(this->mat_.nrowb == this->mat_.ncolb);
+
+        HostVector<ValueType>* cast_vec_inv_diag
+            = dynamic_cast<HostVector<ValueType>*>(vec_inv_diag);
+
+        assert(cast_vec_inv_diag != NULL);
+
+        _set_omp_backend_threads(this->local_backend_, this->mat_.nrowb);
+
+        if(bcsr_extract_diag_dispatch(this->mat_, true, cast_vec_inv_diag->vec_) == true)
+        {
+            LOG_VERBOSE_INFO(
+                2,
+                "*** warning: in HostMatrixBCSR::ExtractInverseDiagonal() a zero has been detected "
+                "on the diagonal. It has been replaced with one to avoid inf");
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixBCSR<ValueType>::ILU0Factorize(void)
+    {
+        assert(this->mat_.nrowb == this->mat_.ncolb);
+        assert(this->nnz_ > 0);
+
+        // The inverted diagonal blocks of a previous analysis become invalid
+        this->LUAnalyseClear();
+
+        int nrowb = this->mat_.nrowb;
+        int dim   = this->mat_.blockdim;
+        int dim2  = dim * dim;
+
+        // Position of the diagonal block of each block row, all block rows require one
+        int* diag_offset = NULL;
+        allocate_host(nrowb, &diag_offset);
+
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            diag_offset[ai] = -1;
+
+            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                if(this->mat_.col[aj] == ai)
+                {
+                    diag_offset[ai] = aj;
+                    break;
+                }
+            }
+
+            if(diag_offset[ai] == -1)
+            {
+                free_host(&diag_offset);
+                return false;
+            }
+        }
+
+        int*       nnz_entries = NULL;
+        ValueType* diag_inv    = NULL;
+        ValueType* tmp         = NULL;
+
+        allocate_host(nrowb, &nnz_entries);
+        allocate_host(nrowb * dim2, &diag_inv);
+        allocate_host(dim2, &tmp);
+
+        for(int i = 0; i < nrowb; ++i)
+        {
+            nnz_entries[i] = -1;
+        }
+
+        // ai = 0 to N loop over all block rows
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            int row_start = this->mat_.row_offset[ai];
+            int row_end   = this->mat_.row_offset[ai + 1];
+
+            // nnz position of ai-th block row in mat_.val array
+            for(int j = row_start; j < row_end; ++j)
+            {
+                nnz_entries[this->mat_.col[j]] = j;
+            }
+
+            // loop over the blocks of the lower part
+            for(int j = row_start; j < diag_offset[ai]; ++j)
             {
-                for(int bi = 0; bi < bsrdim; ++bi)
+                int        col_j = this->mat_.col[j];
+                ValueType* L     = this->mat_.val + dim2 * j;
+
+                // multiplication factor L_ij = A_ij * inv(U_jj)
+                for(int k = 0; k < dim2; ++k)
                 {
-                    int row_begin = this->mat_.row_offset[ai];
-                    int row_end   = this->mat_.row_offset[ai + 1];
+                    tmp[k] = L[k];
+                    L[k]   = static_cast<ValueType>(0);
+                }
 
-                    ValueType sum = static_cast<ValueType>(0);
+                const ValueType* inv = diag_inv + dim2 * col_j;
 
-                    for(int aj = row_begin; aj < row_end; ++aj)
+                for(int c = 0; c < dim; ++c)
+                {
+                    for(int m = 0; m <= c; ++m)
                     {
-                        int col = this->mat_.col[aj];
+                        ValueType u = inv[BCSR_IND(0, m, c, dim)];
 
-                        for(int bj = 0; bj < bsrdim; ++bj)
+                        for(int r = 0; r < dim; ++r)
                         {
-                            sum += this->mat_.val[BCSR_IND(bsrdim * bsrdim * aj, bi, bj, bsrdim)]
-                                   * cast_in->vec_[bsrdim * col + bj];
+                            L[BCSR_IND(0, r, c, dim)] += tmp[BCSR_IND(0, r, m, dim)] * u;
                         }
                     }
+                }
+
+                // linear combination with the upper part of block row col_j
+                for(int k = diag_offset[col_j] + 1; k < this->mat_.row_offset[col_j + 1]; ++k)
+                {
+                    int idx = nnz_entries[this->mat_.col[k]];
+
+                    if(idx != -1)
+                    {
+                        bcsr_block_gemm_sub(
+                            dim, L, this->mat_.val + dim2 * k, this->mat_.val + dim2 * idx);
+                    }
+                }
+            }
+
+            // factorize the diagonal block and invert its triangular factors
+            ValueType* D   = this->mat_.val + dim2 * diag_offset[ai];
+            ValueType* inv = diag_inv + dim2 * ai;
+
+            bcsr_block_lu(dim, D);
+            bcsr_block_lu_invert(dim, D, inv);
+
+            // upper part U_ij = inv(L_ii) * A_ij
+            for(int j = diag_offset[ai] + 1; j < row_end; ++j)
+            {
+                ValueType* U = this->mat_.val + dim2 * j;
+
+                for(int c = 0; c < dim; ++c)
+                {
+                    for(int r = dim - 1; r > 0; --r)
+                    {
+                        ValueType sum = static_cast<ValueType>(0);
+
+                        for(int m = 0; m < r; ++m)
+                        {
+                            sum += inv[BCSR_IND(0, r, m, dim)] * U[BCSR_IND(0, m, c, dim)];
+                        }
+
+                        U[BCSR_IND(0, r, c, dim)] += sum;
+                    }
+                }
+            }
+
+            // clear nnz entries
+            for(int j = row_start; j < row_end; ++j)
+            {
+                nnz_entries[this->mat_.col[j]] = -1;
+            }
+        }
+
+        free_host(&nnz_entries);
+        free_host(&tmp);
+
+        // Keep the diagonal positions and the inverted factors of the diagonal blocks for
+        // LUSolve, they are exactly what LUAnalyse would compute
+        this->lu_diag_     = diag_offset;
+        this->lu_diag_inv_ = diag_inv;
+
+        return true;
+    }
+
+    template <typename ValueType>
+    void HostMatrixBCSR<ValueType>::LUAnalyse(void)
+    {
+        // Already provided by ILU0Factorize, all other changes of the values clear them
+        if(this->lu_diag_inv_ != NULL)
+        {
+            return;
+        }
+
+        if(this->nnz_ == 0 || this->mat_.nrowb != this->mat_.ncolb)
+        {
+            return;
+        }
 
-                    cast_out->vec_[ai * bsrdim + bi] += scalar * sum;
+        int nrowb = this->mat_.nrowb;
+        int dim2  = this->mat_.blockdim * this->mat_.blockdim;
+
+        allocate_host(nrowb, &this->lu_diag_);
+        allocate_host(nrowb * dim2, &this->lu_diag_inv_);
+
+        int missing_diag = 0;
+
+        _set_omp_backend_threads(this->local_backend_, nrowb);
+
+        // Invert the factors of the diagonal blocks, such that the solves only require
+        // small dense matrix-vector products
+#ifdef _OPENMP
+#pragma omp parallel for reduction(| : missing_diag)
+#endif
+        for(int ai = 0; ai < nrowb; ++ai)
+        {
+            this->lu_diag_[ai] = -1;
+
+            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                if(this->mat_.col[aj] == ai)
+                {
+                    this->lu_diag_[ai] = aj;
+
+                    bcsr_block_lu_invert(this->mat_.blockdim,
+                                         this->mat_.val + dim2 * aj,
+                                         this->lu_diag_inv_ + dim2 * ai);
+                    break;
                 }
             }
+
+            if(this->lu_diag_[ai] == -1)
+            {
+                missing_diag = 1;
+            }
         }
+
+        if(missing_diag == 1)
+        {
+            LOG_VERBOSE_INFO(2,
+                             "*** warning: HostMatrixBCSR::LUAnalyse() diagonal block is missing, "
+                             "the solve is performed in CSR format");
+
+            this->LUAnalyseClear();
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixBCSR<ValueType>::LUAnalyseClear(void)
+    {
+        if(this->lu_diag_ != NULL)
+        {
+            free_host(&this->lu_diag_);
+        }
+
+        if(this->lu_diag_inv_ != NULL)
+        {
+            free_host(&this->lu_diag_inv_);
+        }
+    }
+
+    template <typename ValueType>
+    bool HostMatrixBCSR<ValueType>::LUSolve(const BaseVector<ValueType>& in,
+                                            BaseVector<ValueType>*       out) const
+    {
+        // Requires the inverted diagonal blocks of LUAnalyse
+        if(this->lu_diag_inv_ == NULL)
+        {
+            return false;
+        }
+
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        int nrowb = this->mat_.nrowb;
+        int dim   = this->mat_.blockdim;
+
+        const int*       row = this->mat_.row_offset;
+        const int*       col = this->mat_.col;
+        const ValueType* val = this->mat_.val;
+        const int*       dg  = this->lu_diag_;
+        const ValueType* inv = this->lu_diag_inv_;
+        const ValueType* x   = cast_in->vec_;
+        ValueType*       y   = cast_out->vec_;
+
+        std::vector<ValueType> work(dim);
+        ValueType*             w = work.data();
+
+        switch(dim)
+        {
+        case 2:
+            bcsr_lusolve<2>(nrowb, dim, row, col, val, dg, inv, x, w, y);
+            break;
+        case 3:
+            bcsr_lusolve<3>(nrowb, dim, row, col, val, dg, inv, x, w, y);
+            break;
+        case 4:
+            bcsr_lusolve<4>(nrowb, dim, row, col, val, dg, inv, x, w, y);
+            break;
+        case 5:
+            bcsr_lusolve<5>(nrowb, dim, row, col, val, dg, inv, x, w, y);
+            break;
+        case 6:
+            bcsr_lusolve<6>(nrowb, dim, row, col, val, dg, inv, x, w, y);
+            break;
+        case 7:
+            bcsr_lusolve<7>(nrowb, dim, row, col, val, dg, inv, x, w, y);
+            break;
+        case 8:
+            bcsr_lusolve<8>(nrowb, dim, row, col, val, dg, inv, x, w, y);
+            break;
+        default:
+            bcsr_lusolve<0>(nrowb, dim, row, col, val, dg, inv, x, w, y);
+            break;
+        }
+
+        return true;
     }
 
     template class HostMatrixBCSR<double>;
@@ -56,6 +56,8 @@ namespace rocalution
             return this->mat_.blockdim;
         }
 
+        virtual size_t GetMemoryUsage(void) const;
+
         virtual void Clear(void);
         virtual void AllocateBCSR(int nnzb, int nrowb, int ncolb, int blockdim);
         virtual void SetDataPtrBCSR(int**       row_offset,
@@ -72,6 +74,15 @@ namespace rocalution
         virtual void CopyFrom(const BaseMatrix<ValueType>& mat);
         virtual void CopyTo(BaseMatrix<ValueType>* mat) const;
 
+        virtual bool ExtractDiagonal(BaseVector<ValueType>* vec_diag) const;
+        virtual bool ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const;
+
+        virtual bool ILU0Factorize(void);
+
+        virtual void LUAnalyse(void);
+        virtual void LUAnalyseClear(void);
+        virtual bool LUSolve(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
+
         virtual void Apply(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
@@ -80,6 +91,11 @@ namespace rocalution
     private:
         MatrixBCSR<ValueType, int> mat_;
 
+        // Diagonal block positions and their inverted LU factors (see LUAnalyse and
+        // ILU0Factorize), they are cleared whenever the values of the matrix change
+        int*       lu_diag_;
+        ValueType* lu_diag_inv_;
+
         friend class BaseVector<ValueType>;
         friend class HostVector<ValueType>;
         friend class HostMatrixCSR<ValueType>;
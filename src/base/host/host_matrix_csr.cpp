@@ -37,6 +37,8 @@
 #include "host_matrix_ell.hpp"
 #include "host_matrix_hyb.hpp"
 #include "host_matrix_mcsr.hpp"
+#include "host_matrix_sell.hpp"
+#include "host_thread_team.hpp"
 #include "host_vector.hpp"
 
 #include <algorithm>
@@ -45,6 +47,8 @@
 #include <map>
 #include <math.h>
 #include <string.h>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -81,6 +85,30 @@ namespace rocalution
 
         this->L_diag_unit_ = false;
         this->U_diag_unit_ = false;
+
+        this->L_nlevel_    = 0;
+        this->L_level_ptr_ = NULL;
+        this->L_level_row_ = NULL;
+
+        this->U_nlevel_    = 0;
+        this->U_level_ptr_ = NULL;
+        this->U_level_row_ = NULL;
+
+        this->LT_nlevel_     = 0;
+        this->LT_level_ptr_  = NULL;
+        this->LT_level_row_  = NULL;
+        this->LT_row_offset_ = NULL;
+        this->LT_col_        = NULL;
+        this->LT_idx_        = NULL;
+
+        this->trisolve_flag_ = NULL;
+
+        this->it_tmp_ = NULL;
+
+        this->spmv_nparts_   = 0;
+        this->spmv_part_row_ = NULL;
+        this->spmv_part_nnz_ = NULL;
+        this->spmv_carry_    = NULL;
     }
 
     template <typename ValueType>
@@ -103,6 +131,17 @@ namespace rocalution
             this->nrow_ = 0;
             this->ncol_ = 0;
             this->nnz_  = 0;
+
+            this->LUAnalyseClear();
+            this->LLAnalyseClear();
+
+            if(this->trisolve_flag_ != NULL)
+            {
+                free_host(&this->trisolve_flag_);
+            }
+
+            this->ItLUAnalyseClear();
+            this->SpMVPartitionClear_();
         }
     }
 
@@ -124,6 +163,53 @@ namespace rocalution
             "HostMatrixCSR<ValueType>, OpenMP threads: " << this->local_backend_.OpenMP_threads);
     }
 
+    template <typename ValueType>
+    size_t HostMatrixCSR<ValueType>::GetMemoryUsage(void) const
+    {
+        size_t bytes = BaseMatrix<ValueType>::GetMemoryUsage();
+        size_t nrow  = this->nrow_;
+
+        // Analysis data of the triangular solves
+        if(this->L_level_ptr_ != NULL)
+        {
+            bytes += (this->L_nlevel_ + 1 + nrow) * sizeof(int);
+        }
+
+        if(this->U_level_ptr_ != NULL)
+        {
+            bytes += (this->U_nlevel_ + 1 + nrow) * sizeof(int);
+        }
+
+        if(this->LT_level_ptr_ != NULL)
+        {
+            bytes += (this->LT_nlevel_ + 1 + nrow) * sizeof(int);
+        }
+
+        if(this->LT_row_offset_ != NULL)
+        {
+            bytes += (nrow + 1 + 2 * static_cast<size_t>(this->LT_row_offset_[nrow])) * sizeof(int);
+        }
+
+        if(this->trisolve_flag_ != NULL)
+        {
+            bytes += nrow * sizeof(int);
+        }
+
+        if(this->it_tmp_ != NULL)
+        {
+            bytes += 2 * nrow * sizeof(ValueType);
+        }
+
+        // SpMV partition
+        if(this->spmv_part_row_ != NULL)
+        {
+            bytes += 2 * (this->spmv_nparts_ + 1) * sizeof(int)
+                     + this->spmv_nparts_ * sizeof(ValueType);
+        }
+
+        return bytes;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::Check(void) const
     {
@@ -241,9 +327,9 @@ namespace rocalution
             allocate_host(nnz, &this->mat_.col);
             allocate_host(nnz, &this->mat_.val);
 
-            set_to_zero_host(nrow + 1, mat_.row_offset);
-            set_to_zero_host(nnz, mat_.col);
-            set_to_zero_host(nnz, mat_.val);
+            _host_set_to_zero(this->local_backend_, nrow + 1, this->mat_.row_offset);
+            _host_set_to_zero(this->local_backend_, nnz, this->mat_.col);
+            _host_set_to_zero(this->local_backend_, nnz, this->mat_.val);
 
             this->nrow_ = nrow;
             this->ncol_ = ncol;
@@ -292,6 +378,17 @@ namespace rocalution
         this->nrow_ = 0;
         this->ncol_ = 0;
         this->nnz_  = 0;
+
+        this->LUAnalyseClear();
+        this->LLAnalyseClear();
+
+        if(this->trisolve_flag_ != NULL)
+        {
+            free_host(&this->trisolve_flag_);
+        }
+
+        this->ItLUAnalyseClear();
+        this->SpMVPartitionClear_();
     }
 
     template <typename ValueType>
@@ -354,6 +451,40 @@ namespace rocalution
         }
     }
 
+    // Copy CSR arrays by the merge path partition of the matrix-vector product, such that
+    // each thread first touches the row offsets, columns and values it reads in the SpMV
+    template <typename ValueType>
+    static void csr_copy_by_rows(const Rocalution_Backend_Descriptor& backend,
+                                 int                                  nparts,
+                                 const int*                           part_row,
+                                 const int*                           part_nnz,
+                                 int                                  nrow,
+                                 const int*                           src_row_offset,
+                                 const int*                           src_col,
+                                 const ValueType*                     src_val,
+                                 int*                                 row_offset,
+                                 int*                                 col,
+                                 ValueType*                           val)
+    {
+        _host_parallel_run(backend, nparts, [&](int p) {
+            for(int i = part_row[p]; i < part_row[p + 1]; ++i)
+            {
+                row_offset[i] = src_row_offset[i];
+            }
+
+            if(p == nparts - 1)
+            {
+                row_offset[nrow] = src_row_offset[nrow];
+            }
+
+            for(int j = part_nnz[p]; j < part_nnz[p + 1]; ++j)
+            {
+                col[j] = src_col[j];
+                val[j] = src_val[j];
+            }
+        });
+    }
+
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::CopyFrom(const BaseMatrix<ValueType>& mat)
     {
@@ -364,35 +495,40 @@ namespace rocalution
         if(const HostMatrixCSR<ValueType>* cast_mat
            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&mat))
         {
+            // Allocate and copy without zeroing first, such that the copy places the pages
             if(this->nnz_ == 0)
             {
-                this->AllocateCSR(cast_mat->nnz_, cast_mat->nrow_, cast_mat->ncol_);
+                if(cast_mat->nnz_ > 0)
+                {
+                    this->CopyFromHostCSR(cast_mat->mat_.row_offset,
+                                          cast_mat->mat_.col,
+                                          cast_mat->mat_.val,
+                                          cast_mat->nnz_,
+                                          cast_mat->nrow_,
+                                          cast_mat->ncol_);
+                }
+
+                return;
             }
 
             assert((this->nnz_ == cast_mat->nnz_) && (this->nrow_ == cast_mat->nrow_)
                    && (this->ncol_ == cast_mat->ncol_));
 
-            if(this->nnz_ > 0)
-            {
-                _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            int nparts = _host_parallel_parts(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-                for(int i = 0; i < this->nrow_ + 1; ++i)
-                {
-                    this->mat_.row_offset[i] = cast_mat->mat_.row_offset[i];
-                }
+            this->SpMVPartition_(nparts, cast_mat->mat_.row_offset);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-                for(int j = 0; j < this->nnz_; ++j)
-                {
-                    this->mat_.col[j] = cast_mat->mat_.col[j];
-                    this->mat_.val[j] = cast_mat->mat_.val[j];
-                }
-            }
+            csr_copy_by_rows(this->local_backend_,
+                             nparts,
+                             this->spmv_part_row_,
+                             this->spmv_part_nnz_,
+                             this->nrow_,
+                             cast_mat->mat_.row_offset,
+                             cast_mat->mat_.col,
+                             cast_mat->mat_.val,
+                             this->mat_.row_offset,
+                             this->mat_.col,
+                             this->mat_.val);
         }
         else
         {
@@ -457,24 +593,21 @@ namespace rocalution
             this->ncol_ = ncol;
             this->nnz_  = nnz;
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            int nparts = _host_parallel_parts(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->nrow_ + 1; ++i)
-            {
-                this->mat_.row_offset[i] = row_offset[i];
-            }
+            this->SpMVPartition_(nparts, row_offset);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int j = 0; j < this->nnz_; ++j)
-            {
-                this->mat_.col[j] = col[j];
-                this->mat_.val[j] = val[j];
-            }
+            csr_copy_by_rows(this->local_backend_,
+                             nparts,
+                             this->spmv_part_row_,
+                             this->spmv_part_nnz_,
+                             this->nrow_,
+                             row_offset,
+                             col,
+                             val,
+                             this->mat_.row_offset,
+                             this->mat_.col,
+                             this->mat_.val);
         }
     }
 
@@ -523,13 +656,10 @@ namespace rocalution
             int ncol = cast_mat->mat_.ncolb * cast_mat->mat_.blockdim;
             int nnz  = cast_mat->mat_.nnzb * cast_mat->mat_.blockdim * cast_mat->mat_.blockdim;
 
-            if(bcsr_to_csr(this->local_backend_.OpenMP_threads,
-                           nnz,
-                           nrow,
-                           ncol,
-                           cast_mat->mat_,
-                           &this->mat_)
-               == true)
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, nnz, OpenMPKernelConversion);
+
+            if(bcsr_to_csr(nthreads, nnz, nrow, ncol, cast_mat->mat_, &this->mat_) == true)
             {
                 this->nrow_ = nrow;
                 this->ncol_ = ncol;
@@ -544,7 +674,10 @@ namespace rocalution
         {
             this->Clear();
 
-            if(coo_to_csr(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(coo_to_csr(nthreads,
                           cast_mat->nnz_,
                           cast_mat->nrow_,
                           cast_mat->ncol_,
@@ -566,7 +699,10 @@ namespace rocalution
             this->Clear();
             int nnz = 0;
 
-            if(dense_to_csr(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(dense_to_csr(nthreads,
                             cast_mat->nrow_,
                             cast_mat->ncol_,
                             cast_mat->mat_,
@@ -588,7 +724,10 @@ namespace rocalution
             this->Clear();
             int nnz;
 
-            if(dia_to_csr(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(dia_to_csr(nthreads,
                           cast_mat->nnz_,
                           cast_mat->nrow_,
                           cast_mat->ncol_,
@@ -611,7 +750,10 @@ namespace rocalution
             this->Clear();
             int nnz;
 
-            if(ell_to_csr(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(ell_to_csr(nthreads,
                           cast_mat->nnz_,
                           cast_mat->nrow_,
                           cast_mat->ncol_,
@@ -628,12 +770,41 @@ namespace rocalution
             }
         }
 
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            this->Clear();
+            int nnz;
+
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(sell_to_csr(nthreads,
+                           cast_mat->nnz_,
+                           cast_mat->nrow_,
+                           cast_mat->ncol_,
+                           cast_mat->mat_,
+                           &this->mat_,
+                           &nnz)
+               == true)
+            {
+                this->nrow_ = cast_mat->nrow_;
+                this->ncol_ = cast_mat->ncol_;
+                this->nnz_  = nnz;
+
+                return true;
+            }
+        }
+
         if(const HostMatrixMCSR<ValueType>* cast_mat
            = dynamic_cast<const HostMatrixMCSR<ValueType>*>(&mat))
         {
             this->Clear();
 
-            if(mcsr_to_csr(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(mcsr_to_csr(nthreads,
                            cast_mat->nnz_,
                            cast_mat->nrow_,
                            cast_mat->ncol_,
@@ -655,7 +826,10 @@ namespace rocalution
             this->Clear();
             int nnz;
 
-            if(hyb_to_csr(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(hyb_to_csr(nthreads,
                           cast_mat->nnz_,
                           cast_mat->nrow_,
                           cast_mat->ncol_,
@@ -677,6 +851,278 @@ namespace rocalution
         return false;
     }
 
+    // Merge path search, see
+    // D. Merrill, M. Garland, Merge-based parallel sparse matrix-vector multiplication
+    // Returns the coordinate (row, idx) where the given diagonal crosses the merge path of
+    // the row end offsets and the non-zero indices
+    static void csr_merge_path_search(
+        int diagonal, int nrow, int nnz, const int* row_offset, int* row, int* idx)
+    {
+        int x_min = std::max(diagonal - nnz, 0);
+        int x_max = std::min(diagonal, nrow);
+
+        while(x_min < x_max)
+        {
+            int pivot = (x_min + x_max) / 2;
+
+            if(row_offset[pivot + 1] <= diagonal - pivot - 1)
+            {
+                x_min = pivot + 1;
+            }
+            else
+            {
+                x_max = pivot;
+            }
+        }
+
+        *row = std::min(x_min, nrow);
+        *idx = diagonal - x_min;
+    }
+
+    // Merge path SpMV, y = A * x (add == false) or y = y + scalar * A * x (add == true).
+    // Each part processes the same number of rows plus non-zeros. Rows that are split
+    // between parts are completed by adding the carry-out of the preceding parts.
+    template <typename ValueType>
+    static void csr_spmv_merge_path(const Rocalution_Backend_Descriptor& backend,
+                                    int                                  nparts,
+                                    const int*                           part_row,
+                                    const int*                           part_nnz,
+                                    ValueType*                           carry,
+                                    int                                  nrow,
+                                    const int*                           row_offset,
+                                    const int*                           col,
+                                    const ValueType*                     val,
+                                    ValueType                            scalar,
+                                    bool                                 add,
+                                    const ValueType*                     x,
+                                    ValueType*                           y)
+    {
+        _host_parallel_run(backend, nparts, [&](int p) {
+            int ai      = part_row[p];
+            int aj      = part_nnz[p];
+            int row_end = part_row[p + 1];
+            int nnz_end = part_nnz[p + 1];
+
+            // Rows that end within this part
+            for(; ai < row_end; ++ai)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(; aj < row_offset[ai + 1]; ++aj)
+                {
+                    sum += val[aj] * x[col[aj]];
+                }
+
+                if(add == true)
+                {
+                    y[ai] += scalar * sum;
+                }
+                else
+                {
+                    y[ai] = sum;
+                }
+            }
+
+            // Partial sum of the row that continues in the next part
+            ValueType sum = static_cast<ValueType>(0);
+
+            for(; aj < nnz_end; ++aj)
+            {
+                sum += val[aj] * x[col[aj]];
+            }
+
+            carry[p] = sum;
+        });
+
+        // Carry-out fix-up
+        for(int p = 0; p < nparts - 1; ++p)
+        {
+            int ai = part_row[p + 1];
+
+            if(ai < nrow)
+            {
+                y[ai] += (add == true) ? scalar * carry[p] : carry[p];
+            }
+        }
+    }
+
+    // Merge path SpMV fused with a dot product, y = A * x (b == NULL) or y = b - A * x.
+    // Returns the sum of z_i * y_i (conj(z_i) * y_i if conj is set) with z = y if z == NULL.
+    // Each row enters the dot product while its result is still in a register. Rows that are
+    // split between parts are completed and added after the carry-out fix-up. The part sums
+    // are combined in a fixed order, such that the result does not depend on thread timing.
+    template <typename ValueType>
+    static ValueType csr_spmv_dot_merge_path(const Rocalution_Backend_Descriptor& backend,
+                                             int                                  nparts,
+                                             const int*                           part_row,
+                                             const int*                           part_nnz,
+                                             ValueType*                           carry,
+                                             int                                  nrow,
+                                             const int*                           row_offset,
+                                             const int*                           col,
+                                             const ValueType*                     val,
+                                             const ValueType*                     x,
+                                             const ValueType*                     b,
+                                             const ValueType*                     z,
+                                             bool                                 conj,
+                                             ValueType*                           y)
+    {
+        // Pad the part sums to separate cache lines
+        struct part_sum
+        {
+            ValueType val;
+            char      pad[64];
+        };
+
+        std::vector<part_sum> dot(nparts);
+
+        _host_parallel_run(backend, nparts, [&](int p) {
+            int ai      = part_row[p];
+            int aj      = part_nnz[p];
+            int row_end = part_row[p + 1];
+            int nnz_end = part_nnz[p + 1];
+
+            // A first row that started in a preceding part is still incomplete
+            int row_dot = (aj > row_offset[ai]) ? ai + 1 : ai;
+
+            ValueType sum_dot = static_cast<ValueType>(0);
+
+            // Rows that end within this part
+            for(; ai < row_end; ++ai)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(; aj < row_offset[ai + 1]; ++aj)
+                {
+                    sum += val[aj] * x[col[aj]];
+                }
+
+                ValueType yi = (b == NULL) ? sum : b[ai] - sum;
+
+                y[ai] = yi;
+
+                if(ai >= row_dot)
+                {
+                    ValueType zi = (z == NULL) ? yi : z[ai];
+
+                    sum_dot += ((conj == true) ? rocalution_conj(zi) : zi) * yi;
+                }
+            }
+
+            // Partial sum of the row that continues in the next part
+            ValueType sum = static_cast<ValueType>(0);
+
+            for(; aj < nnz_end; ++aj)
+            {
+                sum += val[aj] * x[col[aj]];
+            }
+
+            carry[p]   = sum;
+            dot[p].val = sum_dot;
+        });
+
+        // Carry-out fix-up
+        for(int p = 0; p < nparts - 1; ++p)
+        {
+            int ai = part_row[p + 1];
+
+            if(ai < nrow)
+            {
+                y[ai] += (b == NULL) ? carry[p] : -carry[p];
+            }
+        }
+
+        ValueType result = dot[0].val;
+
+        for(int p = 1; p < nparts; ++p)
+        {
+            result += dot[p].val;
+
+            // Split row that ends within part p
+            int ai = part_row[p];
+
+            if(ai < part_row[p + 1] && part_nnz[p] > row_offset[ai])
+            {
+                ValueType zi = (z == NULL) ? y[ai] : z[ai];
+
+                result += ((conj == true) ? rocalution_conj(zi) : zi) * y[ai];
+            }
+        }
+
+        return result;
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::SpMVPartition_(int nparts, const int* row_offset) const
+    {
+        assert(nparts > 0);
+
+        if(row_offset == NULL)
+        {
+            row_offset = this->mat_.row_offset;
+        }
+
+        // Reuse the cached partition if every split point still lies within its row
+        if(this->spmv_nparts_ == nparts && this->spmv_part_row_[nparts] == this->nrow_
+           && this->spmv_part_nnz_[nparts] == this->nnz_)
+        {
+            bool valid = true;
+
+            for(int p = 0; p < nparts; ++p)
+            {
+                int ai = this->spmv_part_row_[p];
+                int aj = this->spmv_part_nnz_[p];
+
+                if(ai > this->spmv_part_row_[p + 1] || aj > this->spmv_part_nnz_[p + 1]
+                   || aj < row_offset[ai] || (ai < this->nrow_ && aj > row_offset[ai + 1]))
+                {
+                    valid = false;
+                    break;
+                }
+            }
+
+            if(valid == true)
+            {
+                return;
+            }
+        }
+
+        this->SpMVPartitionClear_();
+
+        allocate_host(nparts + 1, &this->spmv_part_row_);
+        allocate_host(nparts + 1, &this->spmv_part_nnz_);
+        allocate_host(nparts, &this->spmv_carry_);
+
+        long long total = static_cast<long long>(this->nrow_) + this->nnz_;
+
+        for(int p = 0; p <= nparts; ++p)
+        {
+            int diagonal = static_cast<int>(total * p / nparts);
+
+            csr_merge_path_search(diagonal,
+                                  this->nrow_,
+                                  this->nnz_,
+                                  row_offset,
+                                  &this->spmv_part_row_[p],
+                                  &this->spmv_part_nnz_[p]);
+        }
+
+        this->spmv_nparts_ = nparts;
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::SpMVPartitionClear_(void) const
+    {
+        if(this->spmv_part_row_ != NULL)
+        {
+            free_host(&this->spmv_part_row_);
+            free_host(&this->spmv_part_nnz_);
+            free_host(&this->spmv_carry_);
+        }
+
+        this->spmv_nparts_ = 0;
+    }
+
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::Apply(const BaseVector<ValueType>& in,
                                          BaseVector<ValueType>*       out) const
@@ -692,10 +1138,33 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
-        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+        int nparts = _host_parallel_parts(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+        // Balance the non-zeros between the threads, such that long rows do not stall the
+        // remaining threads
+        if(nparts > 1 && this->nnz_ > 0)
+        {
+            this->SpMVPartition_(nparts);
+
+            csr_spmv_merge_path(this->local_backend_,
+                                nparts,
+                                this->spmv_part_row_,
+                                this->spmv_part_nnz_,
+                                this->spmv_carry_,
+                                this->nrow_,
+                                this->mat_.row_offset,
+                                this->mat_.col,
+                                this->mat_.val,
+                                static_cast<ValueType>(1),
+                                false,
+                                cast_in->vec_,
+                                cast_out->vec_);
+
+            return;
+        }
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for num_threads(nparts)
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
@@ -730,10 +1199,31 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            int nparts = _host_parallel_parts(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+            if(nparts > 1)
+            {
+                this->SpMVPartition_(nparts);
+
+                csr_spmv_merge_path(this->local_backend_,
+                                    nparts,
+                                    this->spmv_part_row_,
+                                    this->spmv_part_nnz_,
+                                    this->spmv_carry_,
+                                    this->nrow_,
+                                    this->mat_.row_offset,
+                                    this->mat_.col,
+                                    this->mat_.val,
+                                    scalar,
+                                    true,
+                                    cast_in->vec_,
+                                    cast_out->vec_);
+
+                return;
+            }
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for num_threads(nparts)
 #endif
             for(int ai = 0; ai < this->nrow_; ++ai)
             {
@@ -746,18 +1236,418 @@ namespace rocalution
         }
     }
 
+    // SpMM with k interleaved vectors, Y = A * X (add == false) or Y = Y + scalar * A * X
+    // (add == true). Each matrix entry is loaded once and applied to a contiguous row of X.
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ExtractDiagonal(BaseVector<ValueType>* vec_diag) const
+    static void csr_spmm_interleaved(int              nrow,
+                                     int              k,
+                                     const int*       row_offset,
+                                     const int*       col,
+                                     const ValueType* val,
+                                     ValueType        scalar,
+                                     bool             add,
+                                     const ValueType* x,
+                                     ValueType*       y)
     {
-        assert(vec_diag != NULL);
-        assert(vec_diag->GetSize() == this->nrow_);
-
-        HostVector<ValueType>* cast_vec_diag = dynamic_cast<HostVector<ValueType>*>(vec_diag);
-
-        _set_omp_backend_threads(this->local_backend_, this->nrow_);
-
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel
+#endif
+        {
+            std::vector<ValueType> sum(k);
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int ai = 0; ai < nrow; ++ai)
+            {
+                for(int v = 0; v < k; ++v)
+                {
+                    sum[v] = static_cast<ValueType>(0);
+                }
+
+                for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+                {
+                    ValueType        a  = val[aj];
+                    const ValueType* xr = x + col[aj] * k;
+
+                    for(int v = 0; v < k; ++v)
+                    {
+                        sum[v] += a * xr[v];
+                    }
+                }
+
+                ValueType* yr = y + ai * k;
+
+                if(add == true)
+                {
+                    for(int v = 0; v < k; ++v)
+                    {
+                        yr[v] += scalar * sum[v];
+                    }
+                }
+                else
+                {
+                    for(int v = 0; v < k; ++v)
+                    {
+                        yr[v] = sum[v];
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ApplyMultiVector(const BaseVector<ValueType>& in,
+                                                    int                          num_vectors,
+                                                    BaseVector<ValueType>*       out) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(num_vectors > 0);
+            assert(in.GetSize() == this->ncol_ * num_vectors);
+            assert(out->GetSize() == this->nrow_ * num_vectors);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+            csr_spmm_interleaved(this->nrow_,
+                                 num_vectors,
+                                 this->mat_.row_offset,
+                                 this->mat_.col,
+                                 this->mat_.val,
+                                 static_cast<ValueType>(1),
+                                 false,
+                                 cast_in->vec_,
+                                 cast_out->vec_);
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ApplyAddMultiVector(const BaseVector<ValueType>& in,
+                                                       int                          num_vectors,
+                                                       ValueType                    scalar,
+                                                       BaseVector<ValueType>*       out) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(num_vectors > 0);
+            assert(in.GetSize() == this->ncol_ * num_vectors);
+            assert(out->GetSize() == this->nrow_ * num_vectors);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+            csr_spmm_interleaved(this->nrow_,
+                                 num_vectors,
+                                 this->mat_.row_offset,
+                                 this->mat_.col,
+                                 this->mat_.val,
+                                 scalar,
+                                 true,
+                                 cast_in->vec_,
+                                 cast_out->vec_);
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ApplyDot(const BaseVector<ValueType>& in,
+                                            const BaseVector<ValueType>& x,
+                                            bool                         conj,
+                                            BaseVector<ValueType>*       out,
+                                            ValueType*                   dot) const
+    {
+        assert(in.GetSize() == this->ncol_);
+        assert(x.GetSize() == this->nrow_);
+        assert(out->GetSize() == this->nrow_);
+        assert(dot != NULL);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        const HostVector<ValueType>* cast_x   = dynamic_cast<const HostVector<ValueType>*>(&x);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_x != NULL);
+        assert(cast_out != NULL);
+
+        int nparts = _host_parallel_parts(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+        this->SpMVPartition_(nparts);
+
+        *dot = csr_spmv_dot_merge_path(this->local_backend_,
+                                       nparts,
+                                       this->spmv_part_row_,
+                                       this->spmv_part_nnz_,
+                                       this->spmv_carry_,
+                                       this->nrow_,
+                                       this->mat_.row_offset,
+                                       this->mat_.col,
+                                       this->mat_.val,
+                                       cast_in->vec_,
+                                       static_cast<const ValueType*>(NULL),
+                                       cast_x->vec_,
+                                       conj,
+                                       cast_out->vec_);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ResidualNorm(const BaseVector<ValueType>& rhs,
+                                                const BaseVector<ValueType>& in,
+                                                BaseVector<ValueType>*       out,
+                                                ValueType*                   norm) const
+    {
+        assert(rhs.GetSize() == this->nrow_);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+        assert(norm != NULL);
+
+        const HostVector<ValueType>* cast_rhs = dynamic_cast<const HostVector<ValueType>*>(&rhs);
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_rhs != NULL);
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        int nparts = _host_parallel_parts(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+        this->SpMVPartition_(nparts);
+
+        ValueType norm2 = csr_spmv_dot_merge_path(this->local_backend_,
+                                                  nparts,
+                                                  this->spmv_part_row_,
+                                                  this->spmv_part_nnz_,
+                                                  this->spmv_carry_,
+                                                  this->nrow_,
+                                                  this->mat_.row_offset,
+                                                  this->mat_.col,
+                                                  this->mat_.val,
+                                                  cast_in->vec_,
+                                                  cast_rhs->vec_,
+                                                  static_cast<const ValueType*>(NULL),
+                                                  true,
+                                                  cast_out->vec_);
+
+        *norm = sqrt(norm2);
+
+        return true;
+    }
+
+    // Computes the rows [row_beg, row_end) of y = (A - shift I) x. If record is set, the
+    // largest column index that has been accessed plus one is returned
+    template <typename ValueType>
+    static int csr_matrix_powers_block(int              row_beg,
+                                       int              row_end,
+                                       const int*       row_offset,
+                                       const int*       col,
+                                       const ValueType* val,
+                                       ValueType        shift,
+                                       bool             record,
+                                       const ValueType* x,
+                                       ValueType*       y)
+    {
+        int max_col = 0;
+
+        if(record == true)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for reduction(max : max_col)
+#endif
+            for(int ai = row_beg; ai < row_end; ++ai)
+            {
+                ValueType sum = -shift * x[ai];
+
+                for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+                {
+                    sum += val[aj] * x[col[aj]];
+                    max_col = std::max(max_col, col[aj] + 1);
+                }
+
+                y[ai] = sum;
+            }
+        }
+        else
+        {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int ai = row_beg; ai < row_end; ++ai)
+            {
+                ValueType sum = -shift * x[ai];
+
+                for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+                {
+                    sum += val[aj] * x[col[aj]];
+                }
+
+                y[ai] = sum;
+            }
+        }
+
+        return max_col;
+    }
+
+    // Matrix powers kernel, y_0 = (A - shift_0 I) x and y_l = (A - shift_l I) y_l-1.
+    // The rows are split into blocks of roughly the same number of non-zeros, and the
+    // powers are computed in a skewed order: block b of power l is computed as soon as
+    // all rows of power l-1 it depends on are available. For matrices with a moderate
+    // bandwidth (e.g. after RCMK reordering), the rows of power l-1 and the matrix block
+    // are still cache resident, such that the matrix is streamed from memory roughly once
+    // instead of k times. For matrices with a large bandwidth, the schedule falls back to
+    // computing one power after another.
+    template <typename ValueType>
+    static void csr_matrix_powers(int              nrow,
+                                  int              k,
+                                  const int*       row_offset,
+                                  const int*       col,
+                                  const ValueType* val,
+                                  const ValueType* shift,
+                                  const ValueType* x,
+                                  ValueType**      y)
+    {
+        // Non-zeros per block, such that a few blocks of all powers fit into the cache
+        const int block_nnz = 32768;
+
+        ValueType zero = static_cast<ValueType>(0);
+
+        int nnz      = row_offset[nrow];
+        int row_size = std::max(nnz / std::max(nrow, 1), 1);
+        int bs       = std::max(block_nnz / row_size, 256);
+        int nblocks  = (nrow - 1) / bs + 1;
+
+        // Column bound of each block, i.e. the number of rows of power l-1 required to
+        // compute the block of power l
+        std::vector<int> bound(nblocks);
+
+        // Number of blocks that have been computed for each power
+        std::vector<int> done(k, 0);
+
+        for(int b = 0; b < nblocks; ++b)
+        {
+            // The first power depends on x only, the column bounds are recorded on the fly
+            bound[b] = csr_matrix_powers_block(b * bs,
+                                               std::min((b + 1) * bs, nrow),
+                                               row_offset,
+                                               col,
+                                               val,
+                                               (shift != NULL) ? shift[0] : zero,
+                                               true,
+                                               x,
+                                               y[0]);
+            done[0] = b + 1;
+
+            // Advance all remaining powers as far as their dependencies allow
+            for(int l = 1; l < k; ++l)
+            {
+                int avail = std::min(done[l - 1] * bs, nrow);
+
+                while(done[l] < done[l - 1] && bound[done[l]] <= avail)
+                {
+                    int c = done[l];
+
+                    csr_matrix_powers_block(c * bs,
+                                            std::min((c + 1) * bs, nrow),
+                                            row_offset,
+                                            col,
+                                            val,
+                                            (shift != NULL) ? shift[l] : zero,
+                                            false,
+                                            y[l - 1],
+                                            y[l]);
+                    ++done[l];
+                }
+            }
+        }
+
+        // Complete the remaining blocks, power l-1 is available entirely
+        for(int l = 1; l < k; ++l)
+        {
+            for(int c = done[l]; c < nblocks; ++c)
+            {
+                csr_matrix_powers_block(c * bs,
+                                        std::min((c + 1) * bs, nrow),
+                                        row_offset,
+                                        col,
+                                        val,
+                                        (shift != NULL) ? shift[l] : zero,
+                                        false,
+                                        y[l - 1],
+                                        y[l]);
+            }
+        }
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::MatrixPowers(const BaseVector<ValueType>& in,
+                                                int                          k,
+                                                const ValueType*             shift,
+                                                BaseVector<ValueType>**      out) const
+    {
+        if(this->nnz_ > 0 && k > 0)
+        {
+            assert(this->nrow_ == this->ncol_);
+            assert(in.GetSize() == this->ncol_);
+            assert(out != NULL);
+
+            const HostVector<ValueType>* cast_in = dynamic_cast<const HostVector<ValueType>*>(&in);
+
+            assert(cast_in != NULL);
+
+            std::vector<ValueType*> y(k);
+
+            for(int l = 0; l < k; ++l)
+            {
+                HostVector<ValueType>* cast_out = dynamic_cast<HostVector<ValueType>*>(out[l]);
+
+                assert(cast_out != NULL);
+                assert(cast_out != cast_in);
+                assert(cast_out->GetSize() == this->nrow_);
+
+                y[l] = cast_out->vec_;
+            }
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+            csr_matrix_powers(this->nrow_,
+                              k,
+                              this->mat_.row_offset,
+                              this->mat_.col,
+                              this->mat_.val,
+                              shift,
+                              cast_in->vec_,
+                              &y[0]);
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ExtractDiagonal(BaseVector<ValueType>* vec_diag) const
+    {
+        assert(vec_diag != NULL);
+        assert(vec_diag->GetSize() == this->nrow_);
+
+        HostVector<ValueType>* cast_vec_diag = dynamic_cast<HostVector<ValueType>*>(vec_diag);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
 #endif
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
@@ -1136,134 +2026,730 @@ namespace rocalution
         return true;
     }
 
-    template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::LUSolve(const BaseVector<ValueType>& in,
-                                           BaseVector<ValueType>*       out) const
+    // Minimum average number of rows per level for the level scheduled triangular solves to
+    // pay off the synchronization between consecutive levels
+    static const int TRI_SOLVE_MIN_LEVEL_WIDTH = 64;
+
+    // Minimum average number of rows per level for the sync-free triangular solves to be
+    // faster than sequential substitution
+    static const int TRI_SOLVE_MIN_SYNCFREE_WIDTH = 4;
+
+    // Number of consecutive rows a thread takes at once in the sync-free triangular solves
+    static const int TRI_SOLVE_SYNCFREE_CHUNK = 16;
+
+    // Number of busy-wait polls before a waiting thread yields
+    static const int TRI_SOLVE_SYNCFREE_SPIN = 1024;
+
+    // Level set analysis of a triangular CSR pattern, see
+    // E. Anderson, Y. Saad, Solving sparse triangular linear systems on parallel computers
+    // Rows are grouped into levels such that each row only depends on rows of previous levels
+    static void csr_level_schedule(int        nrow,
+                                   const int* row_offset,
+                                   const int* col,
+                                   bool       upper,
+                                   int*       nlevel,
+                                   int**      level_ptr,
+                                   int**      level_row)
     {
-        assert(in.GetSize() >= 0);
-        assert(out->GetSize() >= 0);
-        assert(in.GetSize() == this->ncol_);
-        assert(out->GetSize() == this->nrow_);
+        assert(*level_ptr == NULL);
+        assert(*level_row == NULL);
 
-        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
-        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+        *nlevel = 0;
 
-        assert(cast_in != NULL);
-        assert(cast_out != NULL);
+        if(nrow == 0)
+        {
+            return;
+        }
 
-        // Solve L
-        for(int ai = 0; ai < this->nrow_; ++ai)
+        int* level = NULL;
+        allocate_host(nrow, &level);
+
+        // Compute the level of each row, dependencies are processed first
+        for(int k = 0; k < nrow; ++k)
         {
-            cast_out->vec_[ai] = cast_in->vec_[ai];
+            int ai  = (upper == true) ? nrow - 1 - k : k;
+            int lvl = 0;
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
             {
-                if(this->mat_.col[aj] < ai)
-                {
-                    // under the diagonal
-                    cast_out->vec_[ai] -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
-                }
-                else
+                int c = col[aj];
+
+                if((upper == true && c > ai) || (upper == false && c < ai))
                 {
-                    // CSR should be sorted
-                    break;
+                    lvl = std::max(lvl, level[c] + 1);
                 }
             }
+
+            level[ai] = lvl;
+            *nlevel   = std::max(*nlevel, lvl + 1);
         }
 
-        // last elements should be the diagonal one (last)
-        int diag_aj = this->nnz_ - 1;
+        // Bucket the rows by level
+        allocate_host(*nlevel + 1, level_ptr);
+        allocate_host(nrow, level_row);
 
-        // Solve U
-        for(int ai = this->nrow_ - 1; ai >= 0; --ai)
+        set_to_zero_host(*nlevel + 1, *level_ptr);
+
+        for(int ai = 0; ai < nrow; ++ai)
         {
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
-            {
-                if(this->mat_.col[aj] > ai)
-                {
-                    // above the diagonal
-                    cast_out->vec_[ai] -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
-                }
+            ++(*level_ptr)[level[ai] + 1];
+        }
 
-                if(this->mat_.col[aj] == ai)
-                {
-                    diag_aj = aj;
-                }
-            }
+        for(int l = 0; l < *nlevel; ++l)
+        {
+            (*level_ptr)[l + 1] += (*level_ptr)[l];
+        }
+
+        for(int ai = 0; ai < nrow; ++ai)
+        {
+            (*level_row)[(*level_ptr)[level[ai]]++] = ai;
+        }
 
-            cast_out->vec_[ai] /= this->mat_.val[diag_aj];
+        // Shift back the level offsets
+        for(int l = *nlevel; l > 0; --l)
+        {
+            (*level_ptr)[l] = (*level_ptr)[l - 1];
         }
 
-        return true;
-    }
+        (*level_ptr)[0] = 0;
 
-    template <typename ValueType>
-    void HostMatrixCSR<ValueType>::LLAnalyse(void)
-    {
-        // do nothing
+        free_host(&level);
     }
 
-    template <typename ValueType>
-    void HostMatrixCSR<ValueType>::LLAnalyseClear(void)
+    static void csr_level_schedule_clear(int* nlevel, int** level_ptr, int** level_row)
     {
-        // do nothing
-    }
+        if(*level_ptr != NULL)
+        {
+            free_host(level_ptr);
+        }
 
-    template <typename ValueType>
-    void HostMatrixCSR<ValueType>::LUAnalyse(void)
-    {
-        // do nothing
-    }
+        if(*level_row != NULL)
+        {
+            free_host(level_row);
+        }
 
-    template <typename ValueType>
-    void HostMatrixCSR<ValueType>::LUAnalyseClear(void)
-    {
-        // do nothing
+        *nlevel = 0;
     }
 
-    template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::LLSolve(const BaseVector<ValueType>& in,
-                                           BaseVector<ValueType>*       out) const
+    // Transposes the strictly lower part of a sorted CSR matrix whose diagonal entries are
+    // the last entries of each row, LT_idx references the corresponding entries in val
+    static void csr_lower_transpose(int        nrow,
+                                    const int* row_offset,
+                                    const int* col,
+                                    int**      LT_row_offset,
+                                    int**      LT_col,
+                                    int**      LT_idx)
     {
-        assert(in.GetSize() >= 0);
-        assert(out->GetSize() >= 0);
-        assert(in.GetSize() == this->ncol_);
-        assert(out->GetSize() == this->nrow_);
+        allocate_host(nrow + 1, LT_row_offset);
+        set_to_zero_host(nrow + 1, *LT_row_offset);
 
-        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
-        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+        int* ptr = *LT_row_offset;
 
-        assert(cast_in != NULL);
-        assert(cast_out != NULL);
+        for(int ai = 0; ai < nrow; ++ai)
+        {
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1] - 1; ++aj)
+            {
+                ++ptr[col[aj] + 1];
+            }
+        }
 
-        // Solve L
-        for(int ai = 0; ai < this->nrow_; ++ai)
+        for(int ai = 0; ai < nrow; ++ai)
         {
-            ValueType value    = cast_in->vec_[ai];
-            int       diag_idx = this->mat_.row_offset[ai + 1] - 1;
+            ptr[ai + 1] += ptr[ai];
+        }
+
+        allocate_host(ptr[nrow], LT_col);
+        allocate_host(ptr[nrow], LT_idx);
 
-            for(int aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+        // Rows are traversed in ascending order, thus LT columns are sorted
+        for(int ai = 0; ai < nrow; ++ai)
+        {
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1] - 1; ++aj)
             {
-                value -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                int idx = ptr[col[aj]]++;
+
+                (*LT_col)[idx] = ai;
+                (*LT_idx)[idx] = aj;
             }
+        }
 
-            cast_out->vec_[ai] = value / this->mat_.val[diag_idx];
+        for(int ai = nrow; ai > 0; --ai)
+        {
+            ptr[ai] = ptr[ai - 1];
         }
 
-        // Solve L^T
-        for(int ai = this->nrow_ - 1; ai >= 0; --ai)
+        ptr[0] = 0;
+    }
+
+    // Selects the triangular solve algorithm for a schedule with nlevel levels
+    static int csr_trisolve_select(int alg, int nrow, int nlevel)
+    {
+        // Not analysed or single threaded
+        if(nlevel == 0 || omp_get_max_threads() == 1)
         {
-            int       diag_idx = this->mat_.row_offset[ai + 1] - 1;
-            ValueType value    = cast_out->vec_[ai] / this->mat_.val[diag_idx];
+            return TriSolveSerial;
+        }
 
-            for(int aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+        if(alg == TriSolveAuto)
+        {
+            if(nrow >= TRI_SOLVE_MIN_LEVEL_WIDTH * nlevel)
             {
-                cast_out->vec_[this->mat_.col[aj]] -= value * this->mat_.val[aj];
+                return TriSolveLevelSchedule;
             }
 
-            cast_out->vec_[ai] = value;
+            if(nrow >= TRI_SOLVE_MIN_SYNCFREE_WIDTH * nlevel)
+            {
+                return TriSolveSyncFree;
+            }
+
+            return TriSolveSerial;
         }
 
+        return alg;
+    }
+
+    // Busy-waits until row has been marked as solved
+    static inline void csr_trisolve_wait(const int* flag, int row)
+    {
+        for(int spin = 0;; ++spin)
+        {
+            int done;
+
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+            done = flag[row];
+
+            if(done != 0)
+            {
+                break;
+            }
+
+            if(spin >= TRI_SOLVE_SYNCFREE_SPIN)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // Executes a triangular sweep, kernel(ai) solves row ai. The dependencies of each row
+    // are given by the entries of the CSR pattern (row_offset, col) that are below
+    // (upper == false) or above (upper == true) the diagonal.
+    template <typename RowKernel>
+    static void csr_trisolve_execute(int        alg,
+                                     int        nrow,
+                                     bool       upper,
+                                     const int* row_offset,
+                                     const int* col,
+                                     int        nlevel,
+                                     const int* level_ptr,
+                                     const int* level_row,
+                                     int*       flag,
+                                     RowKernel  kernel)
+    {
+        alg = csr_trisolve_select(alg, nrow, nlevel);
+
+        if(alg == TriSolveLevelSchedule)
+        {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for(int l = 0; l < nlevel; ++l)
+            {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                for(int k = level_ptr[l]; k < level_ptr[l + 1]; ++k)
+                {
+                    kernel(level_row[k]);
+                }
+            }
+        }
+        else if(alg == TriSolveSyncFree)
+        {
+            assert(flag != NULL);
+
+            // Rows are handed out in level order, thus a row only waits for rows which
+            // have already been taken by a running thread
+            int next = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                for(int ai = 0; ai < nrow; ++ai)
+                {
+                    flag[ai] = 0;
+                }
+
+                while(true)
+                {
+                    int begin;
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                    {
+                        begin = next;
+                        next += TRI_SOLVE_SYNCFREE_CHUNK;
+                    }
+
+                    if(begin >= nrow)
+                    {
+                        break;
+                    }
+
+                    int end = std::min(begin + TRI_SOLVE_SYNCFREE_CHUNK, nrow);
+
+                    for(int k = begin; k < end; ++k)
+                    {
+                        int ai = level_row[k];
+
+                        for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+                        {
+                            int c = col[aj];
+
+                            if((upper == true && c > ai) || (upper == false && c < ai))
+                            {
+                                csr_trisolve_wait(flag, c);
+                            }
+                        }
+
+#ifdef _OPENMP
+#pragma omp flush
+#endif
+
+                        kernel(ai);
+
+#ifdef _OPENMP
+#pragma omp flush
+#pragma omp atomic write
+#endif
+                        flag[ai] = 1;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for(int k = 0; k < nrow; ++k)
+            {
+                kernel((upper == true) ? nrow - 1 - k : k);
+            }
+        }
+    }
+
+    // Forward substitution of a single row using its strictly lower part, the diagonal
+    // entry is expected to follow the strictly lower part (sorted CSR)
+    template <typename ValueType>
+    static inline void csr_lsolve_row(int              ai,
+                                      const int*       row_offset,
+                                      const int*       col,
+                                      const ValueType* val,
+                                      bool             diag_unit,
+                                      const ValueType* in,
+                                      ValueType*       out)
+    {
+        ValueType sum = in[ai];
+        int       aj  = row_offset[ai];
+
+        for(; aj < row_offset[ai + 1]; ++aj)
+        {
+            if(col[aj] >= ai)
+            {
+                // CSR should be sorted
+                break;
+            }
+
+            // under the diagonal
+            sum -= val[aj] * out[col[aj]];
+        }
+
+        if(diag_unit == false)
+        {
+            assert(aj < row_offset[ai + 1]);
+            assert(col[aj] == ai);
+            sum /= val[aj];
+        }
+
+        out[ai] = sum;
+    }
+
+    // Backward substitution of a single row using its strictly upper part
+    template <typename ValueType>
+    static inline void csr_usolve_row(int              ai,
+                                      const int*       row_offset,
+                                      const int*       col,
+                                      const ValueType* val,
+                                      bool             diag_unit,
+                                      const ValueType* in,
+                                      ValueType*       out)
+    {
+        ValueType sum     = in[ai];
+        int       diag_aj = -1;
+
+        for(int aj = row_offset[ai + 1] - 1; aj >= row_offset[ai]; --aj)
+        {
+            if(col[aj] > ai)
+            {
+                // above the diagonal
+                sum -= val[aj] * out[col[aj]];
+            }
+            else
+            {
+                // CSR should be sorted
+                if(col[aj] == ai)
+                {
+                    diag_aj = aj;
+                }
+
+                break;
+            }
+        }
+
+        if(diag_unit == false)
+        {
+            assert(diag_aj >= 0);
+            sum /= val[diag_aj];
+        }
+
+        out[ai] = sum;
+    }
+
+    // Forward substitution of a single row of an incomplete Cholesky factor, where the
+    // diagonal entry is the last entry of each row
+    template <typename ValueType>
+    static inline void csr_llsolve_row(int              ai,
+                                       const int*       row_offset,
+                                       const int*       col,
+                                       const ValueType* val,
+                                       const ValueType* inv_diag,
+                                       const ValueType* in,
+                                       ValueType*       out)
+    {
+        ValueType value    = in[ai];
+        int       diag_idx = row_offset[ai + 1] - 1;
+
+        for(int aj = row_offset[ai]; aj < diag_idx; ++aj)
+        {
+            value -= val[aj] * out[col[aj]];
+        }
+
+        out[ai] = (inv_diag == NULL) ? value / val[diag_idx] : value * inv_diag[ai];
+    }
+
+    // Backward substitution of a single row of the transposed incomplete Cholesky factor,
+    // using the explicitly transposed strictly lower part
+    template <typename ValueType>
+    static inline void csr_lltsolve_row(int              ai,
+                                        const int*       row_offset,
+                                        const ValueType* val,
+                                        const int*       LT_row_offset,
+                                        const int*       LT_col,
+                                        const int*       LT_idx,
+                                        const ValueType* inv_diag,
+                                        ValueType*       out)
+    {
+        ValueType value = out[ai];
+
+        for(int k = LT_row_offset[ai]; k < LT_row_offset[ai + 1]; ++k)
+        {
+            value -= val[LT_idx[k]] * out[LT_col[k]];
+        }
+
+        out[ai] = (inv_diag == NULL) ? value / val[row_offset[ai + 1] - 1] : value * inv_diag[ai];
+    }
+
+    // Performs max_iter Jacobi sweeps x_k[ai] = kernel(ai, x_{k-1}) of a triangular system,
+    // starting with x_0 = 0 (passed to the kernel as NULL). The iterates alternate between
+    // tmp and out, such that the last one is written to out.
+    template <typename ValueType, typename RowKernel>
+    static void csr_jacobi_sweeps(
+        int nrow, int max_iter, ValueType* tmp, ValueType* out, RowKernel kernel)
+    {
+        const ValueType* cur = NULL;
+
+        for(int k = 0; k < max_iter; ++k)
+        {
+            ValueType* next = ((max_iter - 1 - k) % 2 == 0) ? out : tmp;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int ai = 0; ai < nrow; ++ai)
+            {
+                next[ai] = kernel(ai, cur);
+            }
+
+            cur = next;
+        }
+    }
+
+    // Jacobi update of row ai of a lower triangular system, fusing the SpMV with the strictly
+    // lower part and the diagonal scaling. inv_diag is optional.
+    template <typename ValueType>
+    static inline ValueType csr_jacobi_lrow(int              ai,
+                                            const int*       row_offset,
+                                            const int*       col,
+                                            const ValueType* val,
+                                            bool             diag_unit,
+                                            const ValueType* inv_diag,
+                                            const ValueType* rhs,
+                                            const ValueType* cur)
+    {
+        ValueType sum  = rhs[ai];
+        ValueType diag = static_cast<ValueType>(1);
+
+        for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+        {
+            int c = col[aj];
+
+            if(c < ai)
+            {
+                if(cur != NULL)
+                {
+                    sum -= val[aj] * cur[c];
+                }
+            }
+            else
+            {
+                if(c == ai)
+                {
+                    diag = val[aj];
+                }
+
+                break;
+            }
+        }
+
+        if(diag_unit == true)
+        {
+            return sum;
+        }
+
+        return (inv_diag == NULL) ? sum / diag : sum * inv_diag[ai];
+    }
+
+    // Jacobi update of row ai of an upper triangular system
+    template <typename ValueType>
+    static inline ValueType csr_jacobi_urow(int              ai,
+                                            const int*       row_offset,
+                                            const int*       col,
+                                            const ValueType* val,
+                                            bool             diag_unit,
+                                            const ValueType* rhs,
+                                            const ValueType* cur)
+    {
+        ValueType sum  = rhs[ai];
+        ValueType diag = static_cast<ValueType>(1);
+
+        for(int aj = row_offset[ai + 1] - 1; aj >= row_offset[ai]; --aj)
+        {
+            int c = col[aj];
+
+            if(c > ai)
+            {
+                if(cur != NULL)
+                {
+                    sum -= val[aj] * cur[c];
+                }
+            }
+            else
+            {
+                if(c == ai)
+                {
+                    diag = val[aj];
+                }
+
+                break;
+            }
+        }
+
+        return (diag_unit == true) ? sum : sum / diag;
+    }
+
+    // Jacobi update of row ai of L^T, using the transposed strictly lower part of L
+    template <typename ValueType>
+    static inline ValueType csr_jacobi_ltrow(int              ai,
+                                             const int*       row_offset,
+                                             const ValueType* val,
+                                             const int*       LT_row_offset,
+                                             const int*       LT_col,
+                                             const int*       LT_idx,
+                                             const ValueType* inv_diag,
+                                             const ValueType* rhs,
+                                             const ValueType* cur)
+    {
+        ValueType sum = rhs[ai];
+
+        if(cur != NULL)
+        {
+            for(int k = LT_row_offset[ai]; k < LT_row_offset[ai + 1]; ++k)
+            {
+                sum -= val[LT_idx[k]] * cur[LT_col[k]];
+            }
+        }
+
+        return (inv_diag == NULL) ? sum / val[row_offset[ai + 1] - 1] : sum * inv_diag[ai];
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::LUSolve(const BaseVector<ValueType>& in,
+                                           BaseVector<ValueType>*       out) const
+    {
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        const int*       row_offset = this->mat_.row_offset;
+        const int*       col        = this->mat_.col;
+        const ValueType* val        = this->mat_.val;
+        const ValueType* x          = cast_in->vec_;
+        ValueType*       y          = cast_out->vec_;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Solve L
+        csr_trisolve_execute(this->local_backend_.OpenMP_trisolve,
+                             this->nrow_,
+                             false,
+                             row_offset,
+                             col,
+                             this->L_nlevel_,
+                             this->L_level_ptr_,
+                             this->L_level_row_,
+                             this->trisolve_flag_,
+                             [&](int ai) { csr_lsolve_row(ai, row_offset, col, val, true, x, y); });
+
+        // Solve U
+        csr_trisolve_execute(this->local_backend_.OpenMP_trisolve,
+                             this->nrow_,
+                             true,
+                             row_offset,
+                             col,
+                             this->U_nlevel_,
+                             this->U_level_ptr_,
+                             this->U_level_row_,
+                             this->trisolve_flag_,
+                             [&](int ai) { csr_usolve_row(ai, row_offset, col, val, false, y, y); });
+
+        return true;
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LLAnalyse(void)
+    {
+        assert(this->nrow_ == this->ncol_);
+
+        this->LLAnalyseClear();
+        this->TriSolveFlagAllocate_();
+
+        // Forward sweep with L
+        csr_level_schedule(this->nrow_,
+                           this->mat_.row_offset,
+                           this->mat_.col,
+                           false,
+                           &this->L_nlevel_,
+                           &this->L_level_ptr_,
+                           &this->L_level_row_);
+
+        // Backward sweep with L^T requires the transposed strictly lower part
+        csr_lower_transpose(this->nrow_,
+                            this->mat_.row_offset,
+                            this->mat_.col,
+                            &this->LT_row_offset_,
+                            &this->LT_col_,
+                            &this->LT_idx_);
+
+        csr_level_schedule(this->nrow_,
+                           this->LT_row_offset_,
+                           this->LT_col_,
+                           true,
+                           &this->LT_nlevel_,
+                           &this->LT_level_ptr_,
+                           &this->LT_level_row_);
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LLAnalyseClear(void)
+    {
+        csr_level_schedule_clear(&this->L_nlevel_, &this->L_level_ptr_, &this->L_level_row_);
+        csr_level_schedule_clear(&this->LT_nlevel_, &this->LT_level_ptr_, &this->LT_level_row_);
+
+        if(this->LT_row_offset_ != NULL)
+        {
+            free_host(&this->LT_row_offset_);
+        }
+
+        if(this->LT_col_ != NULL)
+        {
+            free_host(&this->LT_col_);
+        }
+
+        if(this->LT_idx_ != NULL)
+        {
+            free_host(&this->LT_idx_);
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LUAnalyse(void)
+    {
+        assert(this->nrow_ == this->ncol_);
+
+        this->LUAnalyseClear();
+        this->TriSolveFlagAllocate_();
+
+        csr_level_schedule(this->nrow_,
+                           this->mat_.row_offset,
+                           this->mat_.col,
+                           false,
+                           &this->L_nlevel_,
+                           &this->L_level_ptr_,
+                           &this->L_level_row_);
+        csr_level_schedule(this->nrow_,
+                           this->mat_.row_offset,
+                           this->mat_.col,
+                           true,
+                           &this->U_nlevel_,
+                           &this->U_level_ptr_,
+                           &this->U_level_row_);
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LUAnalyseClear(void)
+    {
+        csr_level_schedule_clear(&this->L_nlevel_, &this->L_level_ptr_, &this->L_level_row_);
+        csr_level_schedule_clear(&this->U_nlevel_, &this->U_level_ptr_, &this->U_level_row_);
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::LLSolve(const BaseVector<ValueType>& in,
+                                           BaseVector<ValueType>*       out) const
+    {
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        this->LLSolve_(cast_in->vec_, NULL, cast_out->vec_);
+
         return true;
     }
 
@@ -1284,56 +2770,359 @@ namespace rocalution
         HostVector<ValueType>* cast_out = dynamic_cast<HostVector<ValueType>*>(out);
 
         assert(cast_in != NULL);
+        assert(cast_diag != NULL);
         assert(cast_out != NULL);
 
+        this->LLSolve_(cast_in->vec_, cast_diag->vec_, cast_out->vec_);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LLSolve_(const ValueType* in,
+                                            const ValueType* inv_diag,
+                                            ValueType*       out) const
+    {
+        const int*       row_offset    = this->mat_.row_offset;
+        const int*       col           = this->mat_.col;
+        const ValueType* val           = this->mat_.val;
+        const int*       LT_row_offset = this->LT_row_offset_;
+        const int*       LT_col        = this->LT_col_;
+        const int*       LT_idx        = this->LT_idx_;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
         // Solve L
-        for(int ai = 0; ai < this->nrow_; ++ai)
-        {
-            ValueType value    = cast_in->vec_[ai];
-            int       diag_idx = this->mat_.row_offset[ai + 1] - 1;
+        csr_trisolve_execute(
+            this->local_backend_.OpenMP_trisolve,
+            this->nrow_,
+            false,
+            row_offset,
+            col,
+            this->L_nlevel_,
+            this->L_level_ptr_,
+            this->L_level_row_,
+            this->trisolve_flag_,
+            [&](int ai) { csr_llsolve_row(ai, row_offset, col, val, inv_diag, in, out); });
 
-            for(int aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
+        // Solve L^T
+        if(LT_row_offset == NULL)
+        {
+            // Not analysed, scatter column-wise
+            for(int ai = this->nrow_ - 1; ai >= 0; --ai)
             {
-                value -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
+                int       diag_idx = row_offset[ai + 1] - 1;
+                ValueType value
+                    = (inv_diag == NULL) ? out[ai] / val[diag_idx] : out[ai] * inv_diag[ai];
+
+                for(int aj = row_offset[ai]; aj < diag_idx; ++aj)
+                {
+                    out[col[aj]] -= value * val[aj];
+                }
+
+                out[ai] = value;
             }
+        }
+        else
+        {
+            csr_trisolve_execute(this->local_backend_.OpenMP_trisolve,
+                                 this->nrow_,
+                                 true,
+                                 LT_row_offset,
+                                 LT_col,
+                                 this->LT_nlevel_,
+                                 this->LT_level_ptr_,
+                                 this->LT_level_row_,
+                                 this->trisolve_flag_,
+                                 [&](int ai) {
+                                     csr_lltsolve_row(ai,
+                                                      row_offset,
+                                                      val,
+                                                      LT_row_offset,
+                                                      LT_col,
+                                                      LT_idx,
+                                                      inv_diag,
+                                                      out);
+                                 });
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LAnalyse(bool diag_unit)
+    {
+        assert(this->nrow_ == this->ncol_);
+
+        this->L_diag_unit_ = diag_unit;
+
+        this->TriSolveFlagAllocate_();
+
+        csr_level_schedule_clear(&this->L_nlevel_, &this->L_level_ptr_, &this->L_level_row_);
+        csr_level_schedule(this->nrow_,
+                           this->mat_.row_offset,
+                           this->mat_.col,
+                           false,
+                           &this->L_nlevel_,
+                           &this->L_level_ptr_,
+                           &this->L_level_row_);
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::LAnalyseClear(void)
+    {
+        csr_level_schedule_clear(&this->L_nlevel_, &this->L_level_ptr_, &this->L_level_row_);
+
+        this->L_diag_unit_ = true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::LSolve(const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        const int*       row_offset = this->mat_.row_offset;
+        const int*       col        = this->mat_.col;
+        const ValueType* val        = this->mat_.val;
+        const ValueType* x          = cast_in->vec_;
+        ValueType*       y          = cast_out->vec_;
+        bool             diag_unit  = this->L_diag_unit_;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Solve L
+        csr_trisolve_execute(
+            this->local_backend_.OpenMP_trisolve,
+            this->nrow_,
+            false,
+            row_offset,
+            col,
+            this->L_nlevel_,
+            this->L_level_ptr_,
+            this->L_level_row_,
+            this->trisolve_flag_,
+            [&](int ai) { csr_lsolve_row(ai, row_offset, col, val, diag_unit, x, y); });
+
+        return true;
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::UAnalyse(bool diag_unit)
+    {
+        assert(this->nrow_ == this->ncol_);
+
+        this->U_diag_unit_ = diag_unit;
+
+        this->TriSolveFlagAllocate_();
+
+        csr_level_schedule_clear(&this->U_nlevel_, &this->U_level_ptr_, &this->U_level_row_);
+        csr_level_schedule(this->nrow_,
+                           this->mat_.row_offset,
+                           this->mat_.col,
+                           true,
+                           &this->U_nlevel_,
+                           &this->U_level_ptr_,
+                           &this->U_level_row_);
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::UAnalyseClear(void)
+    {
+        csr_level_schedule_clear(&this->U_nlevel_, &this->U_level_ptr_, &this->U_level_row_);
+
+        this->U_diag_unit_ = false;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::USolve(const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        const int*       row_offset = this->mat_.row_offset;
+        const int*       col        = this->mat_.col;
+        const ValueType* val        = this->mat_.val;
+        const ValueType* x          = cast_in->vec_;
+        ValueType*       y          = cast_out->vec_;
+        bool             diag_unit  = this->U_diag_unit_;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Solve U
+        csr_trisolve_execute(
+            this->local_backend_.OpenMP_trisolve,
+            this->nrow_,
+            true,
+            row_offset,
+            col,
+            this->U_nlevel_,
+            this->U_level_ptr_,
+            this->U_level_row_,
+            this->trisolve_flag_,
+            [&](int ai) { csr_usolve_row(ai, row_offset, col, val, diag_unit, x, y); });
+
+        return true;
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::TriSolveFlagAllocate_(void)
+    {
+        if(this->trisolve_flag_ == NULL)
+        {
+            allocate_host(this->nrow_, &this->trisolve_flag_);
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::ItLUAnalyse(void)
+    {
+        assert(this->nrow_ == this->ncol_);
 
-            cast_out->vec_[ai] = value * cast_diag->vec_[ai];
+        if(this->it_tmp_ == NULL)
+        {
+            allocate_host(2 * this->nrow_, &this->it_tmp_);
         }
+    }
 
-        // Solve L^T
-        for(int ai = this->nrow_ - 1; ai >= 0; --ai)
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::ItLUAnalyseClear(void)
+    {
+        if(this->it_tmp_ != NULL)
         {
-            int       diag_idx = this->mat_.row_offset[ai + 1] - 1;
-            ValueType value    = cast_out->vec_[ai] * cast_diag->vec_[ai];
+            free_host(&this->it_tmp_);
+        }
+    }
 
-            for(int aj = this->mat_.row_offset[ai]; aj < diag_idx; ++aj)
-            {
-                cast_out->vec_[this->mat_.col[aj]] -= value * this->mat_.val[aj];
-            }
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ItLUSolve(int                          max_iter,
+                                             const BaseVector<ValueType>& in,
+                                             BaseVector<ValueType>*       out) const
+    {
+        assert(max_iter > 0);
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
 
-            cast_out->vec_[ai] = value;
+        const int*       row_offset = this->mat_.row_offset;
+        const int*       col        = this->mat_.col;
+        const ValueType* val        = this->mat_.val;
+
+        // Temporary storage of two iterates, allocated by the analysis
+        ValueType* tmp = this->it_tmp_;
+
+        if(tmp == NULL)
+        {
+            allocate_host(2 * this->nrow_, &tmp);
+        }
+
+        ValueType* y = tmp;
+        ValueType* z = tmp + this->nrow_;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Solve L, the result is stored in y
+        const ValueType* rhs = cast_in->vec_;
+
+        csr_jacobi_sweeps(this->nrow_, max_iter, z, y, [&](int ai, const ValueType* cur) {
+            return csr_jacobi_lrow(
+                ai, row_offset, col, val, true, static_cast<const ValueType*>(NULL), rhs, cur);
+        });
+
+        // Solve U
+        csr_jacobi_sweeps(
+            this->nrow_, max_iter, z, cast_out->vec_, [&](int ai, const ValueType* cur) {
+                return csr_jacobi_urow(ai, row_offset, col, val, false, y, cur);
+            });
+
+        if(this->it_tmp_ == NULL)
+        {
+            free_host(&tmp);
         }
 
         return true;
     }
 
     template <typename ValueType>
-    void HostMatrixCSR<ValueType>::LAnalyse(bool diag_unit)
+    void HostMatrixCSR<ValueType>::ItLLAnalyse(void)
     {
-        this->L_diag_unit_ = diag_unit;
+        assert(this->nrow_ == this->ncol_);
+
+        if(this->it_tmp_ == NULL)
+        {
+            allocate_host(2 * this->nrow_, &this->it_tmp_);
+        }
+
+        // The transposed strictly lower part is shared with LLAnalyse
+        if(this->LT_row_offset_ == NULL)
+        {
+            csr_lower_transpose(this->nrow_,
+                                this->mat_.row_offset,
+                                this->mat_.col,
+                                &this->LT_row_offset_,
+                                &this->LT_col_,
+                                &this->LT_idx_);
+        }
     }
 
-    template <typename ValueType>
-    void HostMatrixCSR<ValueType>::LAnalyseClear(void)
-    {
-        // do nothing
-        this->L_diag_unit_ = true;
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::ItLLAnalyseClear(void)
+    {
+        if(this->it_tmp_ != NULL)
+        {
+            free_host(&this->it_tmp_);
+        }
+
+        // Keep the transposed lower part if it is still required by LLSolve, the level
+        // schedule of L is shared with LLAnalyse and LUAnalyse and is not touched
+        if(this->LT_nlevel_ == 0)
+        {
+            if(this->LT_row_offset_ != NULL)
+            {
+                free_host(&this->LT_row_offset_);
+            }
+
+            if(this->LT_col_ != NULL)
+            {
+                free_host(&this->LT_col_);
+            }
+
+            if(this->LT_idx_ != NULL)
+            {
+                free_host(&this->LT_idx_);
+            }
+        }
     }
 
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::LSolve(const BaseVector<ValueType>& in,
-                                          BaseVector<ValueType>*       out) const
+    bool HostMatrixCSR<ValueType>::ItLLSolve(int                          max_iter,
+                                             const BaseVector<ValueType>& in,
+                                             BaseVector<ValueType>*       out) const
     {
+        assert(max_iter > 0);
         assert(in.GetSize() >= 0);
         assert(out->GetSize() >= 0);
         assert(in.GetSize() == this->ncol_);
@@ -1345,101 +3134,91 @@ namespace rocalution
         assert(cast_in != NULL);
         assert(cast_out != NULL);
 
-        int diag_aj = 0;
-
-        // Solve L
-        for(int ai = 0; ai < this->nrow_; ++ai)
-        {
-            cast_out->vec_[ai] = cast_in->vec_[ai];
-
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
-            {
-                if(this->mat_.col[aj] < ai)
-                {
-                    // under the diagonal
-                    cast_out->vec_[ai] -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
-                }
-                else
-                {
-                    // CSR should be sorted
-                    if(this->L_diag_unit_ == false)
-                    {
-                        assert(this->mat_.col[aj] == ai);
-                        diag_aj = aj;
-                    }
-                    break;
-                }
-            }
-
-            if(this->L_diag_unit_ == false)
-            {
-                cast_out->vec_[ai] /= this->mat_.val[diag_aj];
-            }
-        }
+        this->ItLLSolve_(max_iter, cast_in->vec_, NULL, cast_out->vec_);
 
         return true;
     }
 
     template <typename ValueType>
-    void HostMatrixCSR<ValueType>::UAnalyse(bool diag_unit)
-    {
-        this->U_diag_unit_ = diag_unit;
-    }
-
-    template <typename ValueType>
-    void HostMatrixCSR<ValueType>::UAnalyseClear(void)
-    {
-        // do nothing
-        this->U_diag_unit_ = false;
-    }
-
-    template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::USolve(const BaseVector<ValueType>& in,
-                                          BaseVector<ValueType>*       out) const
+    bool HostMatrixCSR<ValueType>::ItLLSolve(int                          max_iter,
+                                             const BaseVector<ValueType>& in,
+                                             const BaseVector<ValueType>& inv_diag,
+                                             BaseVector<ValueType>*       out) const
     {
+        assert(max_iter > 0);
         assert(in.GetSize() >= 0);
         assert(out->GetSize() >= 0);
         assert(in.GetSize() == this->ncol_);
         assert(out->GetSize() == this->nrow_);
+        assert(inv_diag.GetSize() == this->nrow_ || inv_diag.GetSize() == this->ncol_);
 
-        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
-        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+        const HostVector<ValueType>* cast_in = dynamic_cast<const HostVector<ValueType>*>(&in);
+        const HostVector<ValueType>* cast_diag
+            = dynamic_cast<const HostVector<ValueType>*>(&inv_diag);
+        HostVector<ValueType>* cast_out = dynamic_cast<HostVector<ValueType>*>(out);
 
         assert(cast_in != NULL);
+        assert(cast_diag != NULL);
         assert(cast_out != NULL);
 
-        // last elements should the diagonal one (last)
-        int diag_aj = this->nnz_ - 1;
+        this->ItLLSolve_(max_iter, cast_in->vec_, cast_diag->vec_, cast_out->vec_);
 
-        // Solve U
-        for(int ai = this->nrow_ - 1; ai >= 0; --ai)
+        return true;
+    }
+
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::ItLLSolve_(int              max_iter,
+                                              const ValueType* in,
+                                              const ValueType* inv_diag,
+                                              ValueType*       out) const
+    {
+        const int*       row_offset    = this->mat_.row_offset;
+        const int*       col           = this->mat_.col;
+        const ValueType* val           = this->mat_.val;
+        int*             LT_row_offset = this->LT_row_offset_;
+        int*             LT_col        = this->LT_col_;
+        int*             LT_idx        = this->LT_idx_;
+
+        // Not analysed, transpose the strictly lower part on the fly
+        if(LT_row_offset == NULL)
         {
-            cast_out->vec_[ai] = cast_in->vec_[ai];
+            csr_lower_transpose(this->nrow_, row_offset, col, &LT_row_offset, &LT_col, &LT_idx);
+        }
 
-            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
-            {
-                if(this->mat_.col[aj] > ai)
-                {
-                    // above the diagonal
-                    cast_out->vec_[ai] -= this->mat_.val[aj] * cast_out->vec_[this->mat_.col[aj]];
-                }
+        ValueType* tmp = this->it_tmp_;
 
-                if(this->L_diag_unit_ == false)
-                {
-                    if(this->mat_.col[aj] == ai)
-                    {
-                        diag_aj = aj;
-                    }
-                }
-            }
+        if(tmp == NULL)
+        {
+            allocate_host(2 * this->nrow_, &tmp);
+        }
 
-            if(this->L_diag_unit_ == false)
-            {
-                cast_out->vec_[ai] /= this->mat_.val[diag_aj];
-            }
+        ValueType* y = tmp;
+        ValueType* z = tmp + this->nrow_;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Solve L, the result is stored in y
+        csr_jacobi_sweeps(this->nrow_, max_iter, z, y, [&](int ai, const ValueType* cur) {
+            return csr_jacobi_lrow(ai, row_offset, col, val, false, inv_diag, in, cur);
+        });
+
+        // Solve L^T
+        csr_jacobi_sweeps(this->nrow_, max_iter, z, out, [&](int ai, const ValueType* cur) {
+            return csr_jacobi_ltrow(
+                ai, row_offset, val, LT_row_offset, LT_col, LT_idx, inv_diag, y, cur);
+        });
+
+        if(this->it_tmp_ == NULL)
+        {
+            free_host(&tmp);
         }
 
-        return true;
+        if(this->LT_row_offset_ == NULL)
+        {
+            free_host(&LT_row_offset);
+            free_host(&LT_col);
+            free_host(&LT_idx);
+        }
     }
 
     // Algorithm for ILU factorization is based on
@@ -1524,225 +3303,509 @@ namespace rocalution
         return true;
     }
 
-    // Algorithm for ILUT factorization is based on
-    // Y. Saad, Iterative methods for sparse linear systems, 2nd edition, SIAM
+    // Fixed-point ILU(0) factorization is based on
+    // E. Chow, A. Patel, Fine-grained parallel incomplete LU factorization, SIAM J. Sci. Comput.,
+    // 37(2), 2015. The sweeps are synchronous, i.e. each sweep only reads the iterate of the
+    // previous one, such that the factors do not depend on the thread scheduling.
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ILUTFactorize(double t, int maxrow)
+    bool HostMatrixCSR<ValueType>::ItILU0Factorize(int max_iter)
     {
+        assert(max_iter > 0);
         assert(this->nrow_ == this->ncol_);
         assert(this->nnz_ > 0);
 
-        int nrow = this->nrow_;
-        int ncol = this->ncol_;
+        const int* row_offset = this->mat_.row_offset;
+        const int* col        = this->mat_.col;
 
-        int*       row_offset  = NULL;
-        int*       diag_offset = NULL;
-        int*       nnz_entries = NULL;
-        bool*      nnz_pos     = (bool*)malloc(nrow * sizeof(bool));
-        ValueType* w           = NULL;
-
-        allocate_host(nrow + 1, &row_offset);
-        allocate_host(nrow, &diag_offset);
-        allocate_host(nrow, &nnz_entries);
-        allocate_host(nrow, &w);
+        int* diag_offset = NULL;
+        allocate_host(this->nrow_, &diag_offset);
 
-        for(int i = 0; i < nrow; ++i)
+        for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            w[i]           = 0.0;
-            nnz_entries[i] = -1;
-            nnz_pos[i]     = false;
-            diag_offset[i] = 0;
+            diag_offset[ai] = -1;
+
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                if(col[aj] == ai)
+                {
+                    diag_offset[ai] = aj;
+                    break;
+                }
+            }
+
+            if(diag_offset[ai] == -1)
+            {
+                LOG_INFO("ILU breakdown: structural zero diagonal");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(this->mat_.val[diag_offset[ai]] == static_cast<ValueType>(0))
+            {
+                LOG_INFO("ILU breakdown: division by zero");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
         }
 
-        // pre-allocate 1.5x nnz arrays for preconditioner matrix
-        int        nnzA       = this->nnz_;
-        int        alloc_size = int(nnzA * 1.5);
-        int*       col        = (int*)malloc(alloc_size * sizeof(int));
-        ValueType* val        = (ValueType*)malloc(alloc_size * sizeof(ValueType));
+        // Column-wise access to the upper part (including the diagonal), such that the
+        // entries u_kj of column j are sorted by k
+        int* U_col_offset = NULL;
+        int* U_row        = NULL;
+        int* U_idx        = NULL;
 
-        // initialize row_offset
-        row_offset[0] = 0;
-        int nnz       = 0;
+        allocate_host(this->ncol_ + 1, &U_col_offset);
+        set_to_zero_host(this->ncol_ + 1, U_col_offset);
 
-        // loop over all rows
         for(int ai = 0; ai < this->nrow_; ++ai)
         {
-            row_offset[ai + 1] = row_offset[ai];
+            for(int aj = diag_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                ++U_col_offset[col[aj] + 1];
+            }
+        }
+
+        for(int ai = 0; ai < this->ncol_; ++ai)
+        {
+            U_col_offset[ai + 1] += U_col_offset[ai];
+        }
 
-            int    row_begin = this->mat_.row_offset[ai];
-            int    row_end   = this->mat_.row_offset[ai + 1];
-            double row_norm  = 0.0;
+        int U_nnz = U_col_offset[this->ncol_];
 
-            // fill working array with ai-th row
-            int m = 0;
-            for(int aj = row_begin; aj < row_end; ++aj)
+        allocate_host(U_nnz, &U_row);
+        allocate_host(U_nnz, &U_idx);
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(int aj = diag_offset[ai]; aj < row_offset[ai + 1]; ++aj)
             {
-                int idx        = this->mat_.col[aj];
-                w[idx]         = this->mat_.val[aj];
-                nnz_entries[m] = idx;
-                nnz_pos[idx]   = true;
+                int idx = U_col_offset[col[aj]]++;
+
+                U_row[idx] = ai;
+                U_idx[idx] = aj;
+            }
+        }
+
+        for(int ai = this->ncol_; ai > 0; --ai)
+        {
+            U_col_offset[ai] = U_col_offset[ai - 1];
+        }
+
+        U_col_offset[0] = 0;
+
+        // Keep the entries of A and start with L = tril(A) D^-1, U = triu(A)
+        ValueType* val_A   = NULL;
+        ValueType* val_new = NULL;
+
+        allocate_host(this->nnz_, &val_A);
+        allocate_host(this->nnz_, &val_new);
 
-                row_norm += std::abs(this->mat_.val[aj]);
-                ++m;
+        for(int i = 0; i < this->nnz_; ++i)
+        {
+            val_A[i] = this->mat_.val[i];
+        }
+
+        ValueType* val_old = this->mat_.val;
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(int aj = row_offset[ai]; aj < diag_offset[ai]; ++aj)
+            {
+                val_old[aj] /= val_A[diag_offset[col[aj]]];
             }
+        }
 
-            // threshold for dropping strategy
-            double threshold = t * row_norm / (row_end - row_begin);
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-            for(int k = 0; k < nrow; ++k)
+        for(int iter = 0; iter < max_iter; ++iter)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int ai = 0; ai < this->nrow_; ++ai)
             {
-                if(nnz_entries[k] == -1)
+                for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
                 {
-                    break;
-                }
+                    int       j    = col[aj];
+                    int       kmax = (ai < j) ? ai : j;
+                    ValueType sum  = val_A[aj];
 
-                int aj = nnz_entries[k];
+                    // sum_{k < min(i,j)} l_ik u_kj, merging row i of L and column j of U
+                    int lk = row_offset[ai];
+                    int uk = U_col_offset[j];
 
-                // get smallest column index
-                int sidx = k;
-                for(int j = k + 1; j < nrow; ++j)
-                {
-                    if(nnz_entries[j] == -1)
+                    while(lk < diag_offset[ai] && uk < U_col_offset[j + 1])
                     {
-                        break;
-                    }
+                        int kl = col[lk];
+                        int ku = U_row[uk];
 
-                    if(nnz_entries[j] < aj)
-                    {
-                        sidx = j;
-                        aj   = nnz_entries[j];
+                        if(kl >= kmax || ku >= kmax)
+                        {
+                            break;
+                        }
+
+                        if(kl == ku)
+                        {
+                            sum -= val_old[lk] * val_old[U_idx[uk]];
+                            ++lk;
+                            ++uk;
+                        }
+                        else if(kl < ku)
+                        {
+                            ++lk;
+                        }
+                        else
+                        {
+                            ++uk;
+                        }
                     }
+
+                    val_new[aj] = (ai > j) ? sum / val_old[diag_offset[j]] : sum;
+                }
+            }
+
+            ValueType* swap = val_old;
+            val_old         = val_new;
+            val_new         = swap;
+        }
+
+        // Make sure the factors end up in mat_.val
+        if(val_old != this->mat_.val)
+        {
+            for(int i = 0; i < this->nnz_; ++i)
+            {
+                this->mat_.val[i] = val_old[i];
+            }
+            val_new = val_old;
+        }
+
+        free_host(&val_new);
+        free_host(&val_A);
+        free_host(&diag_offset);
+        free_host(&U_col_offset);
+        free_host(&U_row);
+        free_host(&U_idx);
+
+        return true;
+    }
+
+    // Minimum number of non-zeros of an independent block of rows in the ILUT factorization,
+    // smaller blocks are merged with their successors
+    static const int ILUT_MIN_BLOCK_NNZ = 1024;
+
+    // Sparse working row of the ILUT factorization. The columns are kept in the order they
+    // are created, pos maps a column to its position in col and val.
+    template <typename ValueType>
+    struct csr_ilut_work
+    {
+        std::vector<int>             col;
+        std::vector<ValueType>       val;
+        std::unordered_map<int, int> pos;
+    };
+
+    // ILUT factorization of row ai, the factorized rows are stored in (fact_col, fact_val)
+    // with fact_diag being the position of the diagonal entry (-1 if there is none). All
+    // rows the ai-th row depends on must have been factorized. The working row needs to be
+    // empty and is emptied again on return, such that its memory only depends on the fill-in
+    // of a single row.
+    template <typename ValueType>
+    static void csr_ilut_row(int                       ai,
+                             const int*                row_offset,
+                             const int*                col,
+                             const ValueType*          val,
+                             double                    t,
+                             int                       maxrow,
+                             std::vector<int>*         fact_col,
+                             std::vector<ValueType>*   fact_val,
+                             int*                      fact_diag,
+                             csr_ilut_work<ValueType>& work)
+    {
+        std::vector<int>&             w_col = work.col;
+        std::vector<ValueType>&       w_val = work.val;
+        std::unordered_map<int, int>& w_pos = work.pos;
+
+        int    row_begin = row_offset[ai];
+        int    row_end   = row_offset[ai + 1];
+        double row_norm  = 0.0;
+
+        // fill working row with ai-th row
+        for(int aj = row_begin; aj < row_end; ++aj)
+        {
+            w_pos[col[aj]] = static_cast<int>(w_col.size());
+            w_col.push_back(col[aj]);
+            w_val.push_back(val[aj]);
+
+            row_norm += std::abs(val[aj]);
+        }
+
+        // threshold for dropping strategy
+        double threshold = t * row_norm / (row_end - row_begin);
+
+        for(int k = 0; k < static_cast<int>(w_col.size()); ++k)
+        {
+            int aj = w_col[k];
+
+            // get smallest column index
+            int sidx = k;
+            for(int j = k + 1; j < static_cast<int>(w_col.size()); ++j)
+            {
+                if(w_col[j] < aj)
+                {
+                    sidx = j;
+                    aj   = w_col[j];
                 }
+            }
+
+            // swap column index
+            if(k != sidx)
+            {
+                std::swap(w_col[k], w_col[sidx]);
+                std::swap(w_val[k], w_val[sidx]);
 
-                aj = nnz_entries[k];
+                w_pos[w_col[k]]    = k;
+                w_pos[w_col[sidx]] = sidx;
+            }
+
+            // lower matrix part
+            if(aj < ai)
+            {
+                const int*       aj_col  = fact_col[aj].data();
+                const ValueType* aj_val  = fact_val[aj].data();
+                int              aj_diag = fact_diag[aj];
 
-                // swap column index
-                if(k != sidx)
+                // if zero diagonal entry do nothing
+                if(aj_diag == -1 || aj_val[aj_diag] == static_cast<ValueType>(0))
                 {
-                    nnz_entries[k]    = nnz_entries[sidx];
-                    nnz_entries[sidx] = aj;
-                    aj                = nnz_entries[k];
+                    LOG_INFO("(ILUT) zero row");
+                    continue;
                 }
 
-                // lower matrix part
-                if(aj < ai)
+                w_val[k] /= aj_val[aj_diag];
+
+                ValueType w_k = w_val[k];
+
+                // do linear combination with previous row
+                for(int l = aj_diag + 1; l < static_cast<int>(fact_col[aj].size()); ++l)
                 {
-                    // if zero diagonal entry do nothing
-                    if(val[diag_offset[aj]] == static_cast<ValueType>(0))
-                    {
-                        LOG_INFO("(ILUT) zero row");
-                        continue;
-                    }
+                    int       idx    = aj_col[l];
+                    ValueType fillin = w_k * aj_val[l];
 
-                    w[aj] /= val[diag_offset[aj]];
+                    std::unordered_map<int, int>::const_iterator it = w_pos.find(idx);
 
-                    // do linear combination with previous row
-                    for(int l = diag_offset[aj] + 1; l < row_offset[aj + 1]; ++l)
+                    // drop off strategy for fill in
+                    if(it == w_pos.end())
                     {
-                        int       idx    = col[l];
-                        ValueType fillin = w[aj] * val[l];
-
-                        // drop off strategy for fill in
-                        if(nnz_pos[idx] == false)
-                        {
-                            if(std::abs(fillin) >= threshold)
-                            {
-                                nnz_entries[m] = idx;
-                                nnz_pos[idx]   = true;
-                                w[idx] -= fillin;
-                                ++m;
-                            }
-                        }
-                        else
+                        if(std::abs(fillin) >= threshold)
                         {
-                            w[idx] -= fillin;
+                            w_pos[idx] = static_cast<int>(w_col.size());
+                            w_col.push_back(idx);
+                            w_val.push_back(-fillin);
                         }
                     }
+                    else
+                    {
+                        w_val[it->second] -= fillin;
+                    }
                 }
             }
+        }
+
+        // fill ai-th row of preconditioner matrix
+        for(int k = 0, num_lower = 0, num_upper = 0; k < static_cast<int>(w_col.size()); ++k)
+        {
+            int aj = w_col[k];
+
+            // lower part
+            if(aj < ai && num_lower < maxrow)
+            {
+                fact_col[ai].push_back(aj);
+                fact_val[ai].push_back(w_val[k]);
+
+                ++num_lower;
+
+                // upper part
+            }
+            else if(aj > ai && num_upper < maxrow)
+            {
+                fact_col[ai].push_back(aj);
+                fact_val[ai].push_back(w_val[k]);
+
+                ++num_upper;
+
+                // diagonal part
+            }
+            else if(aj == ai)
+            {
+                fact_diag[ai] = static_cast<int>(fact_col[ai].size());
+
+                fact_col[ai].push_back(aj);
+                fact_val[ai].push_back(w_val[k]);
+            }
+
+            // clear working row
+            w_pos.erase(aj);
+        }
+
+        w_col.clear();
+        w_val.clear();
+    }
+
+    // Algorithm for ILUT factorization is based on
+    // Y. Saad, Iterative methods for sparse linear systems, 2nd edition, SIAM
+    //
+    // Rows are factorized in parallel by independent blocks. A block [begin, end) of
+    // consecutive rows can be factorized on its own, if none of its rows has a lower entry
+    // left of begin, since fill-in can only be created right of the eliminating row. Rows
+    // that break this condition are factorized sequentially after all blocks have been
+    // processed. The result is identical to the sequential factorization.
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ILUTFactorize(double t, int maxrow)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        int nrow = this->nrow_;
+        int ncol = this->ncol_;
+
+        const int*       mat_row_offset = this->mat_.row_offset;
+        const int*       mat_col        = this->mat_.col;
+        const ValueType* mat_val        = this->mat_.val;
+
+        _set_omp_backend_threads(this->local_backend_, nrow);
+
+        int nthreads = omp_get_max_threads();
+
+        // Split the rows into independent blocks, each block is described by its range of
+        // consecutive rows
+        std::vector<int> block_begin;
+        std::vector<int> block_end;
+        std::vector<int> rest;
 
-            // fill ai-th row of preconditioner matrix
-            for(int k = 0, num_lower = 0, num_upper = 0; k < nrow; ++k)
+        int block_nnz = std::max(ILUT_MIN_BLOCK_NNZ, this->nnz_ / (4 * nthreads));
+        int begin     = -1;
+        int nnz       = 0;
+
+        for(int ai = 0; ai < nrow; ++ai)
+        {
+            int min_col = ai;
+
+            for(int aj = mat_row_offset[ai]; aj < mat_row_offset[ai + 1]; ++aj)
             {
-                int aj = nnz_entries[k];
+                min_col = std::min(min_col, mat_col[aj]);
+            }
 
-                if(aj == -1)
+            // Rows without lower entries can start a new block
+            if(min_col == ai && (begin == -1 || nnz >= block_nnz))
+            {
+                if(begin != -1)
                 {
-                    break;
+                    block_begin.push_back(begin);
+                    block_end.push_back(ai);
                 }
 
-                if(nnz_pos[aj] == false)
-                {
-                    break;
-                }
+                begin = ai;
+                nnz   = 0;
+            }
 
-                // lower part
-                if(aj < ai && num_lower < maxrow)
+            if(begin != -1 && min_col >= begin)
+            {
+                nnz += mat_row_offset[ai + 1] - mat_row_offset[ai];
+            }
+            else
+            {
+                // Row depends on rows of previous blocks, close the current block
+                if(begin != -1)
                 {
-                    val[nnz] = w[aj];
-                    col[nnz] = aj;
+                    block_begin.push_back(begin);
+                    block_end.push_back(ai);
+                }
 
-                    ++row_offset[ai + 1];
-                    ++num_lower;
-                    ++nnz;
+                begin = -1;
+                rest.push_back(ai);
+            }
+        }
 
-                    // upper part
-                }
-                else if(aj > ai && num_upper < maxrow)
-                {
-                    val[nnz] = w[aj];
-                    col[nnz] = aj;
+        if(begin != -1)
+        {
+            block_begin.push_back(begin);
+            block_end.push_back(nrow);
+        }
 
-                    ++row_offset[ai + 1];
-                    ++num_upper;
-                    ++nnz;
+        int nblocks = static_cast<int>(block_begin.size());
 
-                    // diagonal part
-                }
-                else if(aj == ai)
-                {
-                    val[nnz] = w[aj];
-                    col[nnz] = aj;
+        // Factorized rows
+        std::vector<int>*       fact_col  = new std::vector<int>[nrow];
+        std::vector<ValueType>* fact_val  = new std::vector<ValueType>[nrow];
+        int*                    fact_diag = NULL;
 
-                    diag_offset[ai] = row_offset[ai + 1];
+        allocate_host(nrow, &fact_diag);
 
-                    ++row_offset[ai + 1];
-                    ++nnz;
-                }
+        // Sparse working row for each thread
+        int nwork = std::min(nthreads, std::max(nblocks, 1));
 
-                // clear working arrays
-                w[aj]          = static_cast<ValueType>(0);
-                nnz_entries[k] = -1;
-                nnz_pos[aj]    = false;
-            }
+        std::vector<csr_ilut_work<ValueType>> work(nwork);
 
-            // resize preconditioner matrix if needed
-            if(alloc_size < nnz + 2 * maxrow + 1)
-            {
-                alloc_size += int(nnzA * 1.5);
-                int*       col_tmp = (int*)realloc(col, alloc_size * sizeof(int));
-                ValueType* val_tmp = (ValueType*)realloc(val, alloc_size * sizeof(ValueType));
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < nrow; ++i)
+        {
+            fact_diag[i] = -1;
+        }
 
-                if(col_tmp == NULL || val_tmp == NULL)
-                {
-                    free(col);
-                    free(val);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nwork)
+#endif
+        {
+            int tid = omp_get_thread_num();
 
-                    LOG_INFO("ILUTFactorize failed on realloc");
-                    FATAL_ERROR(__FILE__, __LINE__);
-                }
-                else
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for(int b = 0; b < nblocks; ++b)
+            {
+                for(int ai = block_begin[b]; ai < block_end[b]; ++ai)
                 {
-                    col = col_tmp;
-                    val = val_tmp;
+                    csr_ilut_row(ai,
+                                 mat_row_offset,
+                                 mat_col,
+                                 mat_val,
+                                 t,
+                                 maxrow,
+                                 fact_col,
+                                 fact_val,
+                                 fact_diag,
+                                 work[tid]);
                 }
             }
         }
 
-        free_host(&w);
-        free_host(&diag_offset);
-        free_host(&nnz_entries);
-        free(nnz_pos);
+        // Remaining rows
+        for(size_t i = 0; i < rest.size(); ++i)
+        {
+            csr_ilut_row(rest[i],
+                         mat_row_offset,
+                         mat_col,
+                         mat_val,
+                         t,
+                         maxrow,
+                         fact_col,
+                         fact_val,
+                         fact_diag,
+                         work[0]);
+        }
+
+        free_host(&fact_diag);
+
+        // Assemble the preconditioner matrix
+        int* row_offset = NULL;
+        allocate_host(nrow + 1, &row_offset);
+
+        row_offset[0] = 0;
+        for(int i = 0; i < nrow; ++i)
+        {
+            row_offset[i + 1] = row_offset[i] + static_cast<int>(fact_col[i].size());
+        }
+
+        nnz = row_offset[nrow];
 
         // pinned memory
         int*       p_col = NULL;
@@ -1751,14 +3814,22 @@ namespace rocalution
         allocate_host(nnz, &p_col);
         allocate_host(nnz, &p_val);
 
-        for(int i = 0; i < nnz; ++i)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < nrow; ++i)
         {
-            p_col[i] = col[i];
-            p_val[i] = val[i];
+            int idx = row_offset[i];
+
+            for(size_t j = 0; j < fact_col[i].size(); ++j)
+            {
+                p_col[idx + j] = fact_col[i][j];
+                p_val[idx + j] = fact_val[i][j];
+            }
         }
 
-        free(col);
-        free(val);
+        delete[] fact_col;
+        delete[] fact_val;
 
         this->Clear();
         this->SetDataPtrCSR(&row_offset, &p_col, &p_val, nnz, nrow, ncol);
@@ -1894,6 +3965,170 @@ namespace rocalution
         return true;
     }
 
+    // Fixed-point IC(0) factorization, see ItILU0Factorize
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ItICFactorize(int max_iter, BaseVector<ValueType>* inv_diag)
+    {
+        assert(max_iter > 0);
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        assert(inv_diag != NULL);
+        HostVector<ValueType>* cast_diag = dynamic_cast<HostVector<ValueType>*>(inv_diag);
+        assert(cast_diag != NULL);
+
+        cast_diag->Allocate(this->nrow_);
+
+        const int* row_offset = this->mat_.row_offset;
+        const int* col        = this->mat_.col;
+
+        int* diag_offset = NULL;
+        allocate_host(this->nrow_, &diag_offset);
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            diag_offset[ai] = -1;
+
+            for(int aj = row_offset[ai]; aj < row_offset[ai + 1]; ++aj)
+            {
+                if(col[aj] == ai)
+                {
+                    diag_offset[ai] = aj;
+                    break;
+                }
+            }
+
+            if(diag_offset[ai] == -1)
+            {
+                LOG_INFO("IC breakdown: structural zero diagonal");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(this->mat_.val[diag_offset[ai]] == static_cast<ValueType>(0))
+            {
+                LOG_INFO("IC breakdown: division by zero");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+        }
+
+        // Keep the entries of A and start with L = tril(A) D^-1/2
+        ValueType* val_A   = NULL;
+        ValueType* val_new = NULL;
+
+        allocate_host(this->nnz_, &val_A);
+        allocate_host(this->nnz_, &val_new);
+
+        for(int i = 0; i < this->nnz_; ++i)
+        {
+            val_A[i] = this->mat_.val[i];
+        }
+
+        ValueType* val_old = this->mat_.val;
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            val_old[diag_offset[ai]] = std::sqrt(std::abs(val_A[diag_offset[ai]]));
+        }
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(int aj = row_offset[ai]; aj < diag_offset[ai]; ++aj)
+            {
+                val_old[aj] /= val_old[diag_offset[col[aj]]];
+            }
+        }
+
+        // Entries of the upper part are not touched
+        for(int i = 0; i < this->nnz_; ++i)
+        {
+            val_new[i] = val_old[i];
+        }
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        for(int iter = 0; iter < max_iter; ++iter)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int ai = 0; ai < this->nrow_; ++ai)
+            {
+                for(int aj = row_offset[ai]; aj <= diag_offset[ai]; ++aj)
+                {
+                    int       j   = col[aj];
+                    ValueType sum = val_A[aj];
+
+                    // sum_{k < j} l_ik l_jk, merging rows i and j of L
+                    int ik = row_offset[ai];
+                    int jk = row_offset[j];
+
+                    while(ik < diag_offset[ai] && jk < diag_offset[j])
+                    {
+                        int ki = col[ik];
+                        int kj = col[jk];
+
+                        if(ki >= j || kj >= j)
+                        {
+                            break;
+                        }
+
+                        if(ki == kj)
+                        {
+                            sum -= val_old[ik] * val_old[jk];
+                            ++ik;
+                            ++jk;
+                        }
+                        else if(ki < kj)
+                        {
+                            ++ik;
+                        }
+                        else
+                        {
+                            ++jk;
+                        }
+                    }
+
+                    val_new[aj] = (ai > j) ? sum / val_old[diag_offset[j]]
+                                           : static_cast<ValueType>(std::sqrt(std::abs(sum)));
+                }
+            }
+
+            ValueType* swap = val_old;
+            val_old         = val_new;
+            val_new         = swap;
+        }
+
+        // Make sure the factor ends up in mat_.val
+        if(val_old != this->mat_.val)
+        {
+            for(int i = 0; i < this->nnz_; ++i)
+            {
+                this->mat_.val[i] = val_old[i];
+            }
+            val_new = val_old;
+        }
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            ValueType diag_entry = this->mat_.val[diag_offset[ai]];
+
+            // Check for numerical zero
+            if(diag_entry == static_cast<ValueType>(0))
+            {
+                LOG_INFO("IC breakdown: division by zero");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            cast_diag->vec_[ai] = static_cast<ValueType>(1) / diag_entry;
+        }
+
+        free_host(&val_new);
+        free_host(&val_A);
+        free_host(&diag_offset);
+
+        return true;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::MultiColoring(int&             num_colors,
                                                  int**            size_colors,
@@ -2089,6 +4324,92 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::PartitionPermutation(int              num_parts,
+                                                        int&             size,
+                                                        BaseVector<int>* permutation) const
+    {
+        assert(num_parts > 0);
+        assert(permutation != NULL);
+        assert(permutation->GetSize() == this->nrow_);
+        assert(permutation->GetSize() == this->ncol_);
+
+        HostVector<int>* cast_perm = dynamic_cast<HostVector<int>*>(permutation);
+        assert(cast_perm != NULL);
+
+        int*  part      = NULL;
+        bool* interface = NULL;
+
+        allocate_host(this->nrow_, &part);
+        allocate_host(this->nrow_, &interface);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Split the rows into parts of consecutive rows with similar number of non-zeros
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            long long p
+                = static_cast<long long>(this->mat_.row_offset[ai]) * num_parts / this->nnz_;
+
+            part[ai]      = std::min(static_cast<int>(p), num_parts - 1);
+            interface[ai] = false;
+        }
+
+        // For each coupling between two parts, the row of the latter part is an interface row
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int col = this->mat_.col[aj];
+
+                if(part[col] < part[ai])
+                {
+                    interface[ai] = true;
+                }
+                else if(part[col] > part[ai])
+                {
+                    interface[col] = true;
+                }
+            }
+        }
+
+        size = 0;
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            if(interface[ai] == false)
+            {
+                ++size;
+            }
+        }
+
+        // Interior rows keep their order, interface rows are mapped to the last block
+        int k_int = 0;
+        int k_ext = size;
+
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            if(interface[ai] == false)
+            {
+                cast_perm->vec_[ai] = k_int;
+                ++k_int;
+            }
+            else
+            {
+                cast_perm->vec_[ai] = k_ext;
+                ++k_ext;
+            }
+        }
+
+        free_host(&part);
+        free_host(&interface);
+
+        return true;
+    }
+
     // following R.E.Bank and C.C.Douglas paper
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::SymbolicMatMatMult(const BaseMatrix<ValueType>& src)
@@ -2649,9 +4970,32 @@ namespace rocalution
             }
         }
 
+        const int* pattern_row_offset = cast_mat->mat_.row_offset;
+        const int* pattern_col        = cast_mat->mat_.col;
+
+        // Row ai only depends on the rows of its strictly lower part, thus the rows are
+        // factorized following the level schedule of the lower pattern
+        int  nlevel    = 0;
+        int* level_ptr = NULL;
+        int* level_row = NULL;
+        int* flag      = NULL;
+
+        csr_level_schedule(cast_mat->nrow_,
+                           pattern_row_offset,
+                           pattern_col,
+                           false,
+                           &nlevel,
+                           &level_ptr,
+                           &level_row);
+        allocate_host(cast_mat->nrow_, &flag);
+
         // ai = 1 to N
-        for(int ai = 1; ai < cast_mat->nrow_; ++ai)
-        {
+        auto factorize_row = [&](int ai) {
+            if(ai == 0)
+            {
+                return;
+            }
+
             // ak = 1 to ai-1
             for(int ak = cast_mat->mat_.row_offset[ai]; ai > cast_mat->mat_.col[ak]; ++ak)
             {
@@ -2704,7 +5048,21 @@ namespace rocalution
                     ++row_offset[ai + 1];
                 }
             }
-        }
+        };
+
+        csr_trisolve_execute(this->local_backend_.OpenMP_trisolve,
+                             cast_mat->nrow_,
+                             false,
+                             pattern_row_offset,
+                             pattern_col,
+                             nlevel,
+                             level_ptr,
+                             level_row,
+                             flag,
+                             factorize_row);
+
+        csr_level_schedule_clear(&nlevel, &level_ptr, &level_row);
+        free_host(&flag);
 
         row_offset[0] = this->mat_.row_offset[0];
         row_offset[1] = this->mat_.row_offset[1];
@@ -2718,9 +5076,13 @@ namespace rocalution
 
         this->AllocateCSR(nnz, cast_mat->nrow_, cast_mat->ncol_);
 
-        int jj = 0;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int i = 0; i < cast_mat->nrow_; ++i)
         {
+            int jj = row_offset[i];
+
             for(int j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1]; ++j)
             {
                 if(levels[j] <= p)
@@ -2730,9 +5092,9 @@ namespace rocalution
                     ++jj;
                 }
             }
-        }
 
-        assert(jj == nnz);
+            assert(jj == row_offset[i + 1]);
+        }
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -45,6 +45,8 @@ namespace rocalution
             return CSR;
         }
 
+        virtual size_t GetMemoryUsage(void) const;
+
         virtual bool Check(void) const;
         virtual void AllocateCSR(int nnz, int nrow, int ncol);
         virtual void SetDataPtrCSR(
@@ -81,6 +83,9 @@ namespace rocalution
 
         virtual bool ZeroBlockPermutation(int& size, BaseVector<int>* permutation) const;
 
+        virtual bool
+            PartitionPermutation(int num_parts, int& size, BaseVector<int>* permutation) const;
+
         virtual bool SymbolicPower(int p);
 
         virtual bool SymbolicMatMatMult(const BaseMatrix<ValueType>& src);
@@ -128,8 +133,10 @@ namespace rocalution
             CreateFromMap(const BaseVector<int>& map, int n, int m, BaseMatrix<ValueType>* pro);
 
         virtual bool ICFactorize(BaseVector<ValueType>* inv_diag);
+        virtual bool ItICFactorize(int max_iter, BaseVector<ValueType>* inv_diag);
 
         virtual bool ILU0Factorize(void);
+        virtual bool ItILU0Factorize(int max_iter);
         virtual bool ILUpFactorizeNumeric(int p, const BaseMatrix<ValueType>& mat);
         virtual bool ILUTFactorize(double t, int maxrow);
 
@@ -152,6 +159,22 @@ namespace rocalution
         virtual void UAnalyseClear(void);
         virtual bool USolve(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
 
+        virtual void ItLUAnalyse(void);
+        virtual void ItLUAnalyseClear(void);
+        virtual bool ItLUSolve(int                          max_iter,
+                               const BaseVector<ValueType>& in,
+                               BaseVector<ValueType>*       out) const;
+
+        virtual void ItLLAnalyse(void);
+        virtual void ItLLAnalyseClear(void);
+        virtual bool ItLLSolve(int                          max_iter,
+                               const BaseVector<ValueType>& in,
+                               BaseVector<ValueType>*       out) const;
+        virtual bool ItLLSolve(int                          max_iter,
+                               const BaseVector<ValueType>& in,
+                               const BaseVector<ValueType>& inv_diag,
+                               BaseVector<ValueType>*       out) const;
+
         virtual bool Gershgorin(ValueType& lambda_min, ValueType& lambda_max) const;
 
         virtual void Apply(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
@@ -159,6 +182,28 @@ namespace rocalution
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const;
 
+        virtual bool ApplyMultiVector(const BaseVector<ValueType>& in,
+                                      int                          num_vectors,
+                                      BaseVector<ValueType>*       out) const;
+        virtual bool ApplyAddMultiVector(const BaseVector<ValueType>& in,
+                                         int                          num_vectors,
+                                         ValueType                    scalar,
+                                         BaseVector<ValueType>*       out) const;
+        virtual bool ApplyDot(const BaseVector<ValueType>& in,
+                              const BaseVector<ValueType>& x,
+                              bool                         conj,
+                              BaseVector<ValueType>*       out,
+                              ValueType*                   dot) const;
+        virtual bool ResidualNorm(const BaseVector<ValueType>& rhs,
+                                  const BaseVector<ValueType>& in,
+                                  BaseVector<ValueType>*       out,
+                                  ValueType*                   norm) const;
+
+        virtual bool MatrixPowers(const BaseVector<ValueType>& in,
+                                  int                          k,
+                                  const ValueType*             shift,
+                                  BaseVector<ValueType>**      out) const;
+
         virtual bool Compress(double drop_off);
         virtual bool Transpose(void);
         virtual bool Transpose(BaseMatrix<ValueType>* T) const;
@@ -245,6 +290,24 @@ namespace rocalution
                                      int                    rGsize) const;
 
     private:
+        // Forward and backward sweep of LLSolve, inv_diag is optional
+        void LLSolve_(const ValueType* in, const ValueType* inv_diag, ValueType* out) const;
+
+        // Jacobi sweeps of ItLLSolve, inv_diag is optional
+        void ItLLSolve_(int              max_iter,
+                        const ValueType* in,
+                        const ValueType* inv_diag,
+                        ValueType*       out) const;
+
+        // Allocate the row completion flags of the sync-free triangular solves
+        void TriSolveFlagAllocate_(void);
+
+        // Compute (or reuse) the merge path partition of the SpMV into nparts parts. By
+        // default, the row offsets of the matrix are used, the source row offsets can be
+        // passed to place the pages of a copy by the partition before it is written.
+        void SpMVPartition_(int nparts, const int* row_offset = NULL) const;
+        void SpMVPartitionClear_(void) const;
+
         MatrixCSR<ValueType, int> mat_;
 
         friend class BaseVector<ValueType>;
@@ -253,6 +316,7 @@ namespace rocalution
         friend class HostMatrixDIA<ValueType>;
         friend class HostMatrixELL<ValueType>;
         friend class HostMatrixHYB<ValueType>;
+        friend class HostMatrixSELL<ValueType>;
         friend class HostMatrixDENSE<ValueType>;
         friend class HostMatrixMCSR<ValueType>;
         friend class HostMatrixBCSR<ValueType>;
@@ -261,6 +325,38 @@ namespace rocalution
 
         bool L_diag_unit_;
         bool U_diag_unit_;
+
+        // Level set schedules of the triangular solves, built during the analysis phase
+        int  L_nlevel_;
+        int* L_level_ptr_;
+        int* L_level_row_;
+
+        int  U_nlevel_;
+        int* U_level_ptr_;
+        int* U_level_row_;
+
+        // Transposed strictly lower part for the backward sweep of LLSolve, LT_idx_ points
+        // into mat_.val such that refactorizations do not invalidate the analysis
+        int  LT_nlevel_;
+        int* LT_level_ptr_;
+        int* LT_level_row_;
+        int* LT_row_offset_;
+        int* LT_col_;
+        int* LT_idx_;
+
+        // Row completion flags of the sync-free triangular solves
+        int* trisolve_flag_;
+
+        // Temporary storage of the Jacobi sweeps (two iterates)
+        ValueType* it_tmp_;
+
+        // Merge path partition of the SpMV, part p starts at row spmv_part_row_[p] and
+        // non-zero spmv_part_nnz_[p]. The partition is computed on first use and kept as
+        // long as it matches the sparsity pattern and the number of threads.
+        mutable int        spmv_nparts_;
+        mutable int*       spmv_part_row_;
+        mutable int*       spmv_part_nnz_;
+        mutable ValueType* spmv_carry_;
     };
 
 } // namespace rocalution
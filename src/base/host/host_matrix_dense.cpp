@@ -217,7 +217,10 @@ namespace rocalution
         {
             this->Clear();
 
-            if(csr_to_dense(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(csr_to_dense(nthreads,
                             cast_mat->nnz_,
                             cast_mat->nrow_,
                             cast_mat->ncol_,
@@ -254,7 +254,10 @@ namespace rocalution
             this->Clear();
             int nnz = 0;
 
-            if(csr_to_dia(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(csr_to_dia(nthreads,
                           cast_mat->nnz_,
                           cast_mat->nrow_,
                           cast_mat->ncol_,
@@ -291,7 +294,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -352,7 +355,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
 #ifdef _OPENMP
 #pragma omp parallel for
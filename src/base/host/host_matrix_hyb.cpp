@@ -84,6 +84,13 @@ namespace rocalution
                  << " COO nnz=" << this->coo_nnz_);
     }
 
+    template <typename ValueType>
+    size_t HostMatrixHYB<ValueType>::GetMemoryUsage(void) const
+    {
+        return static_cast<size_t>(this->ell_nnz_) * (sizeof(int) + sizeof(ValueType))
+               + static_cast<size_t>(this->coo_nnz_) * (2 * sizeof(int) + sizeof(ValueType));
+    }
+
     template <typename ValueType>
     void HostMatrixHYB<ValueType>::Clear()
     {
@@ -260,7 +267,10 @@ namespace rocalution
             int coo_nnz = 0;
             int ell_nnz = 0;
 
-            if(csr_to_hyb(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(csr_to_hyb(nthreads,
                           cast_mat->nnz_,
                           cast_mat->nrow_,
                           cast_mat->ncol_,
@@ -301,7 +311,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
             // ELL
             if(this->ell_nnz_ > 0)
@@ -356,7 +366,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
             // ELL
             if(this->ell_nnz_ > 0)
@@ -58,6 +58,8 @@ namespace rocalution
             return HYB;
         }
 
+        virtual size_t GetMemoryUsage(void) const;
+
         virtual void Clear(void);
         virtual void AllocateHYB(int ell_nnz, int coo_nnz, int ell_max_row, int nrow, int ncol);
 
@@ -242,7 +242,10 @@ namespace rocalution
         {
             this->Clear();
 
-            if(csr_to_mcsr(this->local_backend_.OpenMP_threads,
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(csr_to_mcsr(nthreads,
                            cast_mat->nnz_,
                            cast_mat->nrow_,
                            cast_mat->ncol_,
@@ -417,7 +420,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
             assert(this->nrow_ == this->ncol_);
 
@@ -456,7 +459,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
 
             assert(this->nrow_ == this->ncol_);
 
@@ -0,0 +1,508 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "host_matrix_sell.hpp"
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/log.hpp"
+#include "../matrix_formats_ind.hpp"
+#include "host_conversion.hpp"
+#include "host_matrix_csr.hpp"
+#include "host_vector.hpp"
+
+#include <complex>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_set_num_threads(num) ;
+#endif
+
+namespace rocalution
+{
+
+    // Width of the SIMD registers of the host in bytes. The host code is compiled with
+    // -march=native, thus this is the widest instruction set of the build machine.
+#if defined(__AVX512F__)
+    static const int SELL_SIMD_BYTES = 64;
+#elif defined(__AVX__)
+    static const int SELL_SIMD_BYTES = 32;
+#else
+    static const int SELL_SIMD_BYTES = 16;
+#endif
+
+    // Number of rows per slice (C), one SIMD register of ValueType, but at least 4 rows
+    // to keep enough independent accumulators for narrow registers and complex types
+    template <typename ValueType>
+    struct sell_slice_size
+    {
+        static const int value = SELL_SIMD_BYTES / static_cast<int>(sizeof(ValueType)) > 4
+                                     ? SELL_SIMD_BYTES / static_cast<int>(sizeof(ValueType))
+                                     : 4;
+    };
+
+    // Number of rows within which the rows are sorted by their length (sigma), a multiple
+    // of the slice size of all value types
+    static const int SELL_SIGMA = 256;
+
+    // Sum of the C rows of a slice with the given width, the rows are processed
+    // simultaneously in SIMD lanes. Padding elements hold zero values and thus need no
+    // special treatment.
+    template <int C, typename ValueType>
+    static inline void sell_slice_spmv(int              width,
+                                       const int*       col,
+                                       const ValueType* val,
+                                       const ValueType* x,
+                                       ValueType*       sum)
+    {
+        for(int r = 0; r < C; ++r)
+        {
+            sum[r] = static_cast<ValueType>(0);
+        }
+
+        for(int n = 0; n < width; ++n)
+        {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(int r = 0; r < C; ++r)
+            {
+                sum[r] += val[n * C + r] * x[col[n * C + r]];
+            }
+        }
+    }
+
+#if defined(__AVX512F__)
+    // AVX-512, one slice of 8 double or 16 float rows is a single register, x is gathered.
+    // The gathers use the masked form with a zero source, the unmasked form starts from an
+    // undefined register.
+    template <>
+    inline void sell_slice_spmv<8, double>(
+        int width, const int* col, const double* val, const double* x, double* sum)
+    {
+        __m512d zero = _mm512_setzero_pd();
+        __m512d acc  = zero;
+
+        for(int n = 0; n < width; ++n)
+        {
+            __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(col + n * 8));
+            __m512d xv  = _mm512_mask_i32gather_pd(zero, 0xFF, idx, x, 8);
+
+            acc = _mm512_fmadd_pd(_mm512_loadu_pd(val + n * 8), xv, acc);
+        }
+
+        _mm512_storeu_pd(sum, acc);
+    }
+
+    template <>
+    inline void sell_slice_spmv<16, float>(
+        int width, const int* col, const float* val, const float* x, float* sum)
+    {
+        __m512 zero = _mm512_setzero_ps();
+        __m512 acc  = zero;
+
+        for(int n = 0; n < width; ++n)
+        {
+            __m512i idx = _mm512_loadu_si512(col + n * 16);
+            __m512  xv  = _mm512_mask_i32gather_ps(zero, 0xFFFF, idx, x, 4);
+
+            acc = _mm512_fmadd_ps(_mm512_loadu_ps(val + n * 16), xv, acc);
+        }
+
+        _mm512_storeu_ps(sum, acc);
+    }
+#elif defined(__AVX2__)
+    // AVX2, one slice of 4 double or 8 float rows is a single register, x is gathered.
+    // The gathers use the masked form with a zero source, the unmasked form starts from an
+    // undefined register.
+    template <>
+    inline void sell_slice_spmv<4, double>(
+        int width, const int* col, const double* val, const double* x, double* sum)
+    {
+        __m256d zero = _mm256_setzero_pd();
+        __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        __m256d acc  = zero;
+
+        for(int n = 0; n < width; ++n)
+        {
+            __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(col + n * 4));
+            __m256d xv  = _mm256_mask_i32gather_pd(zero, x, idx, mask, 8);
+
+            acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(val + n * 4), xv));
+        }
+
+        _mm256_storeu_pd(sum, acc);
+    }
+
+    template <>
+    inline void sell_slice_spmv<8, float>(
+        int width, const int* col, const float* val, const float* x, float* sum)
+    {
+        __m256 zero = _mm256_setzero_ps();
+        __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        __m256 acc  = zero;
+
+        for(int n = 0; n < width; ++n)
+        {
+            __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(col + n * 8));
+            __m256  xv  = _mm256_mask_i32gather_ps(zero, x, idx, mask, 4);
+
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(val + n * 8), xv));
+        }
+
+        _mm256_storeu_ps(sum, acc);
+    }
+#endif
+
+    // SpMV of a SELL matrix, y = A * x (add == false) or y = y + scalar * A * x
+    // (add == true)
+    template <int C, typename ValueType>
+    static void sell_spmv(const MatrixSELL<ValueType, int>& mat,
+                          ValueType                         scalar,
+                          bool                              add,
+                          const ValueType*                  x,
+                          ValueType*                        y)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int s = 0; s < mat.nslice; ++s)
+        {
+            int offset = mat.slice_offset[s];
+            int width  = (mat.slice_offset[s + 1] - offset) / C;
+
+            ValueType sum[C];
+
+            sell_slice_spmv<C>(width,
+                               mat.col + SELL_IND(offset, 0, 0, C),
+                               mat.val + SELL_IND(offset, 0, 0, C),
+                               x,
+                               sum);
+
+            for(int r = 0; r < C; ++r)
+            {
+                int ai = mat.perm[s * C + r];
+
+                if(ai < 0)
+                {
+                    break;
+                }
+
+                if(add == true)
+                {
+                    y[ai] += scalar * sum[r];
+                }
+                else
+                {
+                    y[ai] = sum[r];
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::HostMatrixSELL()
+    {
+        // no default constructors
+        LOG_INFO("no default constructor");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::HostMatrixSELL(const Rocalution_Backend_Descriptor& local_backend)
+    {
+        log_debug(this, "HostMatrixSELL::HostMatrixSELL()", "constructor with local_backend");
+
+        this->mat_.slice_size   = sell_slice_size<ValueType>::value;
+        this->mat_.sigma        = SELL_SIGMA;
+        this->mat_.nslice       = 0;
+        this->mat_.slice_offset = NULL;
+        this->mat_.perm         = NULL;
+        this->mat_.row_length   = NULL;
+        this->mat_.col          = NULL;
+        this->mat_.val          = NULL;
+
+        this->set_backend(local_backend);
+    }
+
+    template <typename ValueType>
+    HostMatrixSELL<ValueType>::~HostMatrixSELL()
+    {
+        log_debug(this, "HostMatrixSELL::~HostMatrixSELL()", "destructor");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Info(void) const
+    {
+        LOG_INFO("HostMatrixSELL<ValueType>, C=" << this->mat_.slice_size
+                                                 << " sigma=" << this->mat_.sigma);
+    }
+
+    template <typename ValueType>
+    size_t HostMatrixSELL<ValueType>::GetMemoryUsage(void) const
+    {
+        if(this->nnz_ == 0)
+        {
+            return 0;
+        }
+
+        size_t nslice = this->mat_.nslice;
+        size_t nrow   = nslice * this->mat_.slice_size;
+
+        return (nslice + 1 + 2 * nrow) * sizeof(int)
+               + static_cast<size_t>(this->nnz_) * (sizeof(int) + sizeof(ValueType));
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Clear()
+    {
+        if(this->nnz_ > 0)
+        {
+            free_host(&this->mat_.slice_offset);
+            free_host(&this->mat_.perm);
+            free_host(&this->mat_.row_length);
+            free_host(&this->mat_.col);
+            free_host(&this->mat_.val);
+
+            this->mat_.nslice = 0;
+
+            this->nrow_ = 0;
+            this->ncol_ = 0;
+            this->nnz_  = 0;
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::AllocateSELL_(
+        int nnz, int nrow, int ncol, int nslice, int slice_size, int sigma)
+    {
+        assert(nnz >= 0);
+        assert(ncol >= 0);
+        assert(nrow >= 0);
+
+        if(this->nnz_ > 0)
+        {
+            this->Clear();
+        }
+
+        if(nnz > 0)
+        {
+            assert(nslice * slice_size >= nrow);
+
+            allocate_host(nslice + 1, &this->mat_.slice_offset);
+            allocate_host(nslice * slice_size, &this->mat_.perm);
+            allocate_host(nslice * slice_size, &this->mat_.row_length);
+            allocate_host(nnz, &this->mat_.col);
+            allocate_host(nnz, &this->mat_.val);
+
+            this->mat_.slice_size = slice_size;
+            this->mat_.sigma      = sigma;
+            this->mat_.nslice     = nslice;
+
+            this->nrow_ = nrow;
+            this->ncol_ = ncol;
+            this->nnz_  = nnz;
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::CopyFrom(const BaseMatrix<ValueType>& mat)
+    {
+        // copy only in the same format
+        assert(this->GetMatFormat() == mat.GetMatFormat());
+        assert(this->GetMatBlockDimension() == mat.GetMatBlockDimension());
+
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            this->AllocateSELL_(cast_mat->nnz_,
+                                cast_mat->nrow_,
+                                cast_mat->ncol_,
+                                cast_mat->mat_.nslice,
+                                cast_mat->mat_.slice_size,
+                                cast_mat->mat_.sigma);
+
+            assert((this->nnz_ == cast_mat->nnz_) && (this->nrow_ == cast_mat->nrow_)
+                   && (this->ncol_ == cast_mat->ncol_));
+
+            if(this->nnz_ > 0)
+            {
+                _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+                int nnz      = this->nnz_;
+                int nslice   = this->mat_.nslice;
+                int nrow_pad = this->mat_.nslice * this->mat_.slice_size;
+
+                for(int i = 0; i < nslice + 1; ++i)
+                {
+                    this->mat_.slice_offset[i] = cast_mat->mat_.slice_offset[i];
+                }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for(int i = 0; i < nrow_pad; ++i)
+                {
+                    this->mat_.perm[i]       = cast_mat->mat_.perm[i];
+                    this->mat_.row_length[i] = cast_mat->mat_.row_length[i];
+                }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for(int i = 0; i < nnz; ++i)
+                {
+                    this->mat_.val[i] = cast_mat->mat_.val[i];
+                    this->mat_.col[i] = cast_mat->mat_.col[i];
+                }
+            }
+        }
+        else
+        {
+            // Host matrix knows only host matrices
+            // -> dispatching
+            mat.CopyTo(this);
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::CopyTo(BaseMatrix<ValueType>* mat) const
+    {
+        mat->CopyFrom(*this);
+    }
+
+    template <typename ValueType>
+    bool HostMatrixSELL<ValueType>::ConvertFrom(const BaseMatrix<ValueType>& mat)
+    {
+        this->Clear();
+
+        // empty matrix is empty matrix
+        if(mat.GetNnz() == 0)
+        {
+            return true;
+        }
+
+        if(const HostMatrixSELL<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixSELL<ValueType>*>(&mat))
+        {
+            this->CopyFrom(*cast_mat);
+            return true;
+        }
+
+        if(const HostMatrixCSR<ValueType>* cast_mat
+           = dynamic_cast<const HostMatrixCSR<ValueType>*>(&mat))
+        {
+            this->Clear();
+            int nnz = 0;
+
+            int nthreads = _get_omp_backend_threads(
+                this->local_backend_, cast_mat->nnz_, OpenMPKernelConversion);
+
+            if(csr_to_sell(nthreads,
+                           cast_mat->nnz_,
+                           cast_mat->nrow_,
+                           cast_mat->ncol_,
+                           sell_slice_size<ValueType>::value,
+                           SELL_SIGMA,
+                           cast_mat->mat_,
+                           &this->mat_,
+                           &nnz)
+               == true)
+            {
+                this->nrow_ = cast_mat->nrow_;
+                this->ncol_ = cast_mat->ncol_;
+                this->nnz_  = nnz;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::Apply(const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            assert(in.GetSize() == this->ncol_);
+            assert(out->GetSize() == this->nrow_);
+            assert(this->mat_.slice_size == sell_slice_size<ValueType>::value);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+            sell_spmv<sell_slice_size<ValueType>::value>(
+                this->mat_, static_cast<ValueType>(1), false, cast_in->vec_, cast_out->vec_);
+        }
+    }
+
+    template <typename ValueType>
+    void HostMatrixSELL<ValueType>::ApplyAdd(const BaseVector<ValueType>& in,
+                                             ValueType                    scalar,
+                                             BaseVector<ValueType>*       out) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            assert(in.GetSize() == this->ncol_);
+            assert(out->GetSize() == this->nrow_);
+            assert(this->mat_.slice_size == sell_slice_size<ValueType>::value);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_, OpenMPKernelSpMV);
+
+            sell_spmv<sell_slice_size<ValueType>::value>(
+                this->mat_, scalar, true, cast_in->vec_, cast_out->vec_);
+        }
+    }
+
+    template class HostMatrixSELL<double>;
+    template class HostMatrixSELL<float>;
+#ifdef SUPPORT_COMPLEX
+    template class HostMatrixSELL<std::complex<double>>;
+    template class HostMatrixSELL<std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -103,7 +103,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, nrow);
+            _set_omp_backend_threads(this->local_backend_, nrow, OpenMPKernelSpMV);
 
             int idx = 0;
 
@@ -215,7 +215,7 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            _set_omp_backend_threads(this->local_backend_, nrow);
+            _set_omp_backend_threads(this->local_backend_, nrow, OpenMPKernelSpMV);
 
             int idx = 0;
 
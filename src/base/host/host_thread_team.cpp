@@ -0,0 +1,255 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_thread_team.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/log.hpp"
+
+namespace rocalution
+{
+
+    // Number of polls before an idle thread parks, if the cores are not oversubscribed
+    static const int HOST_TEAM_SPIN = 4096;
+
+    static inline void host_team_relax(void)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+
+    // The team is shared by all objects. It is only (re-)created by the backend setters, the
+    // mutex guards the pointer against concurrent host threads. Kernels hold a reference
+    // while they run, such that replacing the team does not terminate a running job.
+    static std::shared_ptr<HostThreadTeam> host_thread_team;
+    static std::mutex                      host_thread_team_mutex;
+
+    HostThreadTeam::HostThreadTeam(int nthreads)
+    {
+        log_debug(0, "HostThreadTeam::HostThreadTeam()", nthreads);
+
+        assert(nthreads > 0);
+
+        this->nthreads_ = nthreads;
+
+        // Do not spin, if the team oversubscribes the cores
+        unsigned int ncores = std::thread::hardware_concurrency();
+
+        this->spin_ = (ncores > 0 && static_cast<unsigned int>(nthreads) > ncores)
+                          ? 1
+                          : HOST_TEAM_SPIN;
+
+        this->func_   = NULL;
+        this->data_   = NULL;
+        this->nparts_ = 0;
+
+        this->generation_.store(0);
+        this->pending_.store(0);
+        this->busy_.store(false);
+        this->stop_.store(false);
+
+        for(int tid = 1; tid < nthreads; ++tid)
+        {
+            this->workers_.push_back(std::thread(&HostThreadTeam::Worker_, this, tid));
+        }
+    }
+
+    HostThreadTeam::~HostThreadTeam()
+    {
+        log_debug(0, "HostThreadTeam::~HostThreadTeam()");
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->stop_.store(true);
+        }
+
+        this->cond_.notify_all();
+
+        for(size_t i = 0; i < this->workers_.size(); ++i)
+        {
+            this->workers_[i].join();
+        }
+    }
+
+    int HostThreadTeam::GetNumThreads(void) const
+    {
+        return this->nthreads_;
+    }
+
+    bool HostThreadTeam::Run(int nparts, void (*func)(int, void*), void* data)
+    {
+        assert(nparts > 0);
+        assert(nparts <= this->nthreads_);
+        assert(func != NULL);
+
+        bool expected = false;
+
+        if(this->busy_.compare_exchange_strong(expected, true) == false)
+        {
+            return false;
+        }
+
+        this->func_   = func;
+        this->data_   = data;
+        this->nparts_ = nparts;
+
+        this->pending_.store(this->nthreads_ - 1, std::memory_order_relaxed);
+
+        // Publish the job, the lock avoids lost wake-ups of workers that are about to park
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->generation_.fetch_add(1, std::memory_order_release);
+        }
+
+        this->cond_.notify_all();
+
+        func(0, data);
+
+        // Wait for the workers
+        int spin = 0;
+
+        while(this->pending_.load(std::memory_order_acquire) > 0)
+        {
+            if(++spin < this->spin_)
+            {
+                host_team_relax();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        this->busy_.store(false, std::memory_order_release);
+
+        return true;
+    }
+
+    void HostThreadTeam::Worker_(int tid)
+    {
+        unsigned int generation = 0;
+
+        while(true)
+        {
+            // Spin for a while, then park until the next job is published
+            int spin = 0;
+
+            while(this->generation_.load(std::memory_order_acquire) == generation
+                  && this->stop_.load(std::memory_order_relaxed) == false)
+            {
+                if(++spin < this->spin_)
+                {
+                    host_team_relax();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(this->mutex_);
+
+                this->cond_.wait(lock, [&] {
+                    return this->generation_.load(std::memory_order_acquire) != generation
+                           || this->stop_.load(std::memory_order_relaxed) == true;
+                });
+            }
+
+            if(this->stop_.load(std::memory_order_relaxed) == true)
+            {
+                return;
+            }
+
+            generation = this->generation_.load(std::memory_order_acquire);
+
+            if(tid < this->nparts_)
+            {
+                this->func_(tid, this->data_);
+            }
+
+            this->pending_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    std::shared_ptr<HostThreadTeam>
+        _get_host_thread_team(const Rocalution_Backend_Descriptor& backend)
+    {
+        if(backend.OpenMP_team == false || backend.OpenMP_threads < 2)
+        {
+            return NULL;
+        }
+
+        std::lock_guard<std::mutex> lock(host_thread_team_mutex);
+
+        return host_thread_team;
+    }
+
+    void _set_host_thread_team(int nthreads)
+    {
+        std::shared_ptr<HostThreadTeam> team;
+
+        {
+            std::lock_guard<std::mutex> lock(host_thread_team_mutex);
+
+            if(nthreads > 1 && host_thread_team != NULL
+               && host_thread_team->GetNumThreads() == nthreads)
+            {
+                return;
+            }
+
+            team = host_thread_team;
+            host_thread_team.reset();
+        }
+
+        // Terminate the previous team outside of the lock, once its last job has finished
+        team.reset();
+
+        if(nthreads > 1)
+        {
+            team = std::make_shared<HostThreadTeam>(nthreads);
+
+            std::lock_guard<std::mutex> lock(host_thread_team_mutex);
+            host_thread_team = team;
+        }
+    }
+
+    void _free_host_thread_team(void)
+    {
+        _set_host_thread_team(0);
+    }
+
+    int _host_parallel_parts(const Rocalution_Backend_Descriptor& backend, int size, int kernel)
+    {
+        if(backend.OpenMP_team == true && backend.OpenMP_threads > 1)
+        {
+            assert(backend.OpenMP_team_chunk > 0);
+
+            return std::max(1, std::min(backend.OpenMP_threads, size / backend.OpenMP_team_chunk));
+        }
+
+        _set_omp_backend_threads(backend, size, kernel);
+
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+} // namespace rocalution
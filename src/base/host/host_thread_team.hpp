@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_THREAD_TEAM_HPP_
+#define ROCALUTION_HOST_THREAD_TEAM_HPP_
+
+#include "../../utils/allocate_free.hpp"
+#include "../backend_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    // Persistent team of host worker threads. After a job, the workers spin for a short
+    // while and then park on a condition variable, such that back-to-back kernels do not
+    // pay the fork/join of an OpenMP parallel region. The calling thread acts as thread 0.
+    class HostThreadTeam
+    {
+    public:
+        explicit HostThreadTeam(int nthreads);
+        ~HostThreadTeam();
+
+        int GetNumThreads(void) const;
+
+        // Execute func(part, data) for part = 0,...,nparts-1, one part per thread. Returns
+        // false, if the team is already busy (e.g. called from within a job)
+        bool Run(int nparts, void (*func)(int, void*), void* data);
+
+    private:
+        void Worker_(int tid);
+
+        int nthreads_;
+
+        // Number of polls before an idle thread parks (or yields)
+        int spin_;
+
+        std::vector<std::thread> workers_;
+
+        // Current job
+        void (*func_)(int, void*);
+        void* data_;
+        int   nparts_;
+
+        // Incremented by the calling thread to publish a new job
+        std::atomic<unsigned int> generation_;
+        // Number of workers that did not finish the current job yet
+        std::atomic<int> pending_;
+        // Set while a job is running
+        std::atomic<bool> busy_;
+        // Set to terminate the workers
+        std::atomic<bool> stop_;
+
+        // Parking of idle workers
+        std::mutex              mutex_;
+        std::condition_variable cond_;
+    };
+
+    // Return the host thread team, or NULL if the team is disabled for the backend. The team
+    // is kept alive as long as the returned pointer is held.
+    std::shared_ptr<HostThreadTeam>
+        _get_host_thread_team(const Rocalution_Backend_Descriptor& backend);
+
+    // (Re-)create the host thread team with nthreads threads, or terminate it if nthreads < 2.
+    // The team is never created from within a kernel.
+    void _set_host_thread_team(int nthreads);
+
+    // Terminate the host thread team
+    void _free_host_thread_team(void);
+
+    // Number of parts (threads) a host loop of the given size and kernel class is distributed
+    // to. If the thread team is disabled, this also sets the number of OpenMP threads.
+    int _host_parallel_parts(const Rocalution_Backend_Descriptor& backend, int size, int kernel);
+
+    // First index of part p, when size elements are split into nparts equal parts
+    inline int _host_part_begin(int size, int p, int nparts)
+    {
+        return static_cast<int>(static_cast<long long>(size) * p / nparts);
+    }
+
+    template <typename Func>
+    void _host_team_job(int p, void* data)
+    {
+        (*static_cast<const Func*>(data))(p);
+    }
+
+    // Execute func(p) for p = 0,...,nparts-1 in parallel, on the host thread team if it is
+    // enabled, in an OpenMP parallel region otherwise
+    template <typename Func>
+    void _host_parallel_run(const Rocalution_Backend_Descriptor& backend,
+                            int                                  nparts,
+                            const Func&                          func)
+    {
+        if(nparts == 1)
+        {
+            func(0);
+            return;
+        }
+
+        std::shared_ptr<HostThreadTeam> team = _get_host_thread_team(backend);
+
+        if(team != NULL && nparts <= team->GetNumThreads())
+        {
+            if(team->Run(nparts, _host_team_job<Func>, const_cast<Func*>(&func)) == true)
+            {
+                return;
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(nparts)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            func(p);
+        }
+    }
+
+    // Execute func(begin, end) on a static partition of [0, size)
+    template <typename Func>
+    void _host_parallel_for(const Rocalution_Backend_Descriptor& backend,
+                            int                                  size,
+                            const Func&                          func)
+    {
+        int nparts = _host_parallel_parts(backend, size, OpenMPKernelBLAS1);
+
+        _host_parallel_run(backend, nparts, [&](int p) {
+            func(_host_part_begin(size, p, nparts), _host_part_begin(size, p + 1, nparts));
+        });
+    }
+
+    // Set a host buffer to zero. In first-touch mode, the buffer is zeroed with the static
+    // partition of _host_parallel_for(), such that its pages are placed on the NUMA nodes
+    // of the threads that process them later on.
+    template <typename DataType>
+    void _host_set_to_zero(const Rocalution_Backend_Descriptor& backend, int size, DataType* ptr)
+    {
+        if(backend.OpenMP_first_touch == false)
+        {
+            set_to_zero_host(size, ptr);
+            return;
+        }
+
+        _host_parallel_for(backend, size, [&](int begin, int end) {
+            set_to_zero_host(end - begin, ptr + begin);
+        });
+    }
+
+    // Sum of func(begin, end) over a static partition of [0, size). The partial sums are
+    // added in a fixed order, thus the result does not depend on the thread timing.
+    template <typename ValueType, typename Func>
+    ValueType _host_parallel_sum(const Rocalution_Backend_Descriptor& backend,
+                                 int                                  size,
+                                 const Func&                          func)
+    {
+        // Pad the partial sums to separate cache lines
+        struct partial_sum
+        {
+            ValueType val;
+            char      pad[64];
+        };
+
+        int nparts = _host_parallel_parts(backend, size, OpenMPKernelReduction);
+
+        std::vector<partial_sum> partial(nparts);
+
+        _host_parallel_run(backend, nparts, [&](int p) {
+            partial[p].val = func(_host_part_begin(size, p, nparts),
+                                  _host_part_begin(size, p + 1, nparts));
+        });
+
+        ValueType sum = partial[0].val;
+
+        for(int p = 1; p < nparts; ++p)
+        {
+            sum += partial[p].val;
+        }
+
+        return sum;
+    }
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_THREAD_TEAM_HPP_
@@ -30,6 +30,7 @@
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
 #include "../base_vector.hpp"
+#include "host_thread_team.hpp"
 #include "rocalution/version.hpp"
 
 #include <complex>
@@ -38,6 +39,7 @@
 #include <math.h>
 #include <typeindex>
 #include <typeinfo>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -119,6 +121,17 @@ namespace rocalution
 
     template <typename ValueType>
     void HostVector<ValueType>::Allocate(int n)
+    {
+        this->AllocateUninitialized(n);
+
+        if(n > 0)
+        {
+            _host_set_to_zero(this->local_backend_, n, this->vec_);
+        }
+    }
+
+    template <typename ValueType>
+    void HostVector<ValueType>::AllocateUninitialized(int n)
     {
         assert(n >= 0);
 
@@ -131,8 +144,6 @@ namespace rocalution
         {
             allocate_host(n, &this->vec_);
 
-            set_to_zero_host(n, this->vec_);
-
             this->size_ = n;
         }
     }
@@ -166,15 +177,12 @@ namespace rocalution
     {
         if(this->size_ > 0)
         {
-            _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->size_; ++i)
-            {
-                this->vec_[i] = data[i];
-            }
+            _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+                for(int i = begin; i < end; ++i)
+                {
+                    this->vec_[i] = data[i];
+                }
+            });
         }
     }
 
@@ -183,15 +191,12 @@ namespace rocalution
     {
         if(this->size_ > 0)
         {
-            _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->size_; ++i)
-            {
-                data[i] = this->vec_[i];
-            }
+            _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+                for(int i = begin; i < end; ++i)
+                {
+                    data[i] = this->vec_[i];
+                }
+            });
         }
     }
 
@@ -222,7 +227,7 @@ namespace rocalution
                 if(this->size_ == 0)
                 {
                     // Allocate local vector
-                    this->Allocate(cast_vec->size_);
+                    this->AllocateUninitialized(cast_vec->size_);
 
                     // Check for boundary
                     assert(this->index_size_ == 0);
@@ -236,15 +241,12 @@ namespace rocalution
                 assert(cast_vec->size_ == this->size_);
                 assert(cast_vec->index_size_ == this->index_size_);
 
-                _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-                for(int i = 0; i < this->size_; ++i)
-                {
-                    this->vec_[i] = cast_vec->vec_[i];
-                }
+                _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+                    for(int i = begin; i < end; ++i)
+                    {
+                        this->vec_[i] = cast_vec->vec_[i];
+                    }
+                });
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -283,7 +285,7 @@ namespace rocalution
             if(this->size_ == 0)
             {
                 // Allocate local vector
-                this->Allocate(cast_vec->size_);
+                this->AllocateUninitialized(cast_vec->size_);
 
                 // Check for boundary
                 assert(this->index_size_ == 0);
@@ -297,15 +299,12 @@ namespace rocalution
             assert(cast_vec->size_ == this->size_);
             assert(cast_vec->index_size_ == this->index_size_);
 
-            _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->size_; ++i)
-            {
-                this->vec_[i] = static_cast<double>(cast_vec->vec_[i]);
-            }
+            _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+                for(int i = begin; i < end; ++i)
+                {
+                    this->vec_[i] = static_cast<double>(cast_vec->vec_[i]);
+                }
+            });
         }
         else
         {
@@ -329,7 +328,7 @@ namespace rocalution
             if(this->size_ == 0)
             {
                 // Allocate local vector
-                this->Allocate(cast_vec->size_);
+                this->AllocateUninitialized(cast_vec->size_);
 
                 // Check for boundary
                 assert(this->index_size_ == 0);
@@ -343,15 +342,12 @@ namespace rocalution
             assert(cast_vec->size_ == this->size_);
             assert(cast_vec->index_size_ == this->index_size_);
 
-            _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->size_; ++i)
-            {
-                this->vec_[i] = static_cast<float>(cast_vec->vec_[i]);
-            }
+            _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+                for(int i = begin; i < end; ++i)
+                {
+                    this->vec_[i] = static_cast<float>(cast_vec->vec_[i]);
+                }
+            });
         }
         else
         {
@@ -363,43 +359,34 @@ namespace rocalution
     template <typename ValueType>
     void HostVector<ValueType>::Zeros(void)
     {
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = static_cast<ValueType>(0);
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = static_cast<ValueType>(0);
+            }
+        });
     }
 
     template <typename ValueType>
     void HostVector<ValueType>::Ones(void)
     {
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = static_cast<ValueType>(1);
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = static_cast<ValueType>(1);
+            }
+        });
     }
 
     template <typename ValueType>
     void HostVector<ValueType>::SetValues(ValueType val)
     {
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = val;
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = val;
+            }
+        });
     }
 
     template <typename ValueType>
@@ -544,7 +531,7 @@ namespace rocalution
         int n;
         in.read((char*)&n, sizeof(int));
 
-        this->Allocate(n);
+        this->AllocateUninitialized(n);
 
         // We read always in double precision
         if(typeid(ValueType) == typeid(double))
@@ -653,15 +640,12 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = this->vec_[i] + alpha * cast_x->vec_[i];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = this->vec_[i] + alpha * cast_x->vec_[i];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -672,15 +656,12 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = alpha * this->vec_[i] + cast_x->vec_[i];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = alpha * this->vec_[i] + cast_x->vec_[i];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -693,15 +674,12 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = alpha * this->vec_[i] + beta * cast_x->vec_[i];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = alpha * this->vec_[i] + beta * cast_x->vec_[i];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -721,16 +699,13 @@ namespace rocalution
         assert(src_offset + size <= cast_x->size_);
         assert(dst_offset + size <= this->size_);
 
-        _set_omp_backend_threads(this->local_backend_, size);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < size; ++i)
-        {
-            this->vec_[i + dst_offset]
-                = alpha * this->vec_[i + dst_offset] + beta * cast_x->vec_[i + src_offset];
-        }
+        _host_parallel_for(this->local_backend_, size, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i + dst_offset]
+                    = alpha * this->vec_[i + dst_offset] + beta * cast_x->vec_[i + src_offset];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -748,30 +723,24 @@ namespace rocalution
         assert(this->size_ == cast_x->size_);
         assert(this->size_ == cast_y->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i]
-                = alpha * this->vec_[i] + beta * cast_x->vec_[i] + gamma * cast_y->vec_[i];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i]
+                    = alpha * this->vec_[i] + beta * cast_x->vec_[i] + gamma * cast_y->vec_[i];
+            }
+        });
     }
 
     template <typename ValueType>
     void HostVector<ValueType>::Scale(ValueType alpha)
     {
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] *= alpha;
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] *= alpha;
+            }
+        });
     }
 
     template <typename ValueType>
@@ -782,19 +751,17 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        ValueType dot = static_cast<ValueType>(0);
+        return _host_parallel_sum<ValueType>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                ValueType dot = static_cast<ValueType>(0);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot += this->vec_[i] * cast_x->vec_[i];
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    dot += this->vec_[i] * cast_x->vec_[i];
+                }
 
-        return dot;
+                return dot;
+            });
     }
 
     template <>
@@ -807,23 +774,21 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        float dot_real = 0.0f;
-        float dot_imag = 0.0f;
+        return _host_parallel_sum<std::complex<float>>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                float dot_real = 0.0f;
+                float dot_imag = 0.0f;
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot_real, dot_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
-                        + this->vec_[i].imag() * cast_x->vec_[i].imag();
-            dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
-                        - this->vec_[i].imag() * cast_x->vec_[i].real();
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
+                                + this->vec_[i].imag() * cast_x->vec_[i].imag();
+                    dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
+                                - this->vec_[i].imag() * cast_x->vec_[i].real();
+                }
 
-        return std::complex<float>(dot_real, dot_imag);
+                return std::complex<float>(dot_real, dot_imag);
+            });
     }
 
     template <>
@@ -836,23 +801,21 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        double dot_real = 0.0;
-        double dot_imag = 0.0;
+        return _host_parallel_sum<std::complex<double>>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                double dot_real = 0.0;
+                double dot_imag = 0.0;
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot_real, dot_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
-                        + this->vec_[i].imag() * cast_x->vec_[i].imag();
-            dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
-                        - this->vec_[i].imag() * cast_x->vec_[i].real();
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
+                                + this->vec_[i].imag() * cast_x->vec_[i].imag();
+                    dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
+                                - this->vec_[i].imag() * cast_x->vec_[i].real();
+                }
 
-        return std::complex<double>(dot_real, dot_imag);
+                return std::complex<double>(dot_real, dot_imag);
+            });
     }
 
     template <typename ValueType>
@@ -871,23 +834,21 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        float dot_real = 0.0f;
-        float dot_imag = 0.0f;
+        return _host_parallel_sum<std::complex<float>>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                float dot_real = 0.0f;
+                float dot_imag = 0.0f;
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot_real, dot_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
-                        - this->vec_[i].imag() * cast_x->vec_[i].imag();
-            dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
-                        + this->vec_[i].imag() * cast_x->vec_[i].real();
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
+                                - this->vec_[i].imag() * cast_x->vec_[i].imag();
+                    dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
+                                + this->vec_[i].imag() * cast_x->vec_[i].real();
+                }
 
-        return std::complex<float>(dot_real, dot_imag);
+                return std::complex<float>(dot_real, dot_imag);
+            });
     }
 
     template <>
@@ -900,81 +861,73 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        double dot_real = 0.0;
-        double dot_imag = 0.0;
+        return _host_parallel_sum<std::complex<double>>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                double dot_real = 0.0;
+                double dot_imag = 0.0;
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot_real, dot_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
-                        - this->vec_[i].imag() * cast_x->vec_[i].imag();
-            dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
-                        + this->vec_[i].imag() * cast_x->vec_[i].real();
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
+                                - this->vec_[i].imag() * cast_x->vec_[i].imag();
+                    dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
+                                + this->vec_[i].imag() * cast_x->vec_[i].real();
+                }
 
-        return std::complex<double>(dot_real, dot_imag);
+                return std::complex<double>(dot_real, dot_imag);
+            });
     }
 
     template <typename ValueType>
     ValueType HostVector<ValueType>::Asum(void) const
     {
-        ValueType asum = static_cast<ValueType>(0);
+        return _host_parallel_sum<ValueType>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                ValueType asum = static_cast<ValueType>(0);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : asum)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            asum += std::abs(this->vec_[i]);
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    asum += std::abs(this->vec_[i]);
+                }
 
-        return asum;
+                return asum;
+            });
     }
 
     template <>
     std::complex<float> HostVector<std::complex<float>>::Asum(void) const
     {
-        float asum_real = 0.0f;
-        float asum_imag = 0.0f;
+        return _host_parallel_sum<std::complex<float>>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                float asum_real = 0.0f;
+                float asum_imag = 0.0f;
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : asum_real, asum_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            asum_real += std::abs(this->vec_[i].real());
-            asum_imag += std::abs(this->vec_[i].imag());
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    asum_real += std::abs(this->vec_[i].real());
+                    asum_imag += std::abs(this->vec_[i].imag());
+                }
 
-        return std::complex<float>(asum_real, asum_imag);
+                return std::complex<float>(asum_real, asum_imag);
+            });
     }
 
     template <>
     std::complex<double> HostVector<std::complex<double>>::Asum(void) const
     {
-        double asum_real = 0.0;
-        double asum_imag = 0.0;
+        return _host_parallel_sum<std::complex<double>>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                double asum_real = 0.0;
+                double asum_imag = 0.0;
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : asum_real, asum_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            asum_real += std::abs(this->vec_[i].real());
-            asum_imag += std::abs(this->vec_[i].imag());
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    asum_real += std::abs(this->vec_[i].real());
+                    asum_imag += std::abs(this->vec_[i].imag());
+                }
 
-        return std::complex<double>(asum_real, asum_imag);
+                return std::complex<double>(asum_real, asum_imag);
+            });
     }
 
     template <typename ValueType>
@@ -983,7 +936,7 @@ namespace rocalution
         int index = 0;
         value     = static_cast<ValueType>(0);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
+        _set_omp_backend_threads(this->local_backend_, this->size_, OpenMPKernelReduction);
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -1010,38 +963,38 @@ namespace rocalution
     template <typename ValueType>
     ValueType HostVector<ValueType>::Norm(void) const
     {
-        ValueType norm2 = static_cast<ValueType>(0);
+        ValueType sum = _host_parallel_sum<ValueType>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                ValueType norm2 = static_cast<ValueType>(0);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
+                for(int i = begin; i < end; ++i)
+                {
+                    norm2 += this->vec_[i] * this->vec_[i];
+                }
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : norm2)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            norm2 += this->vec_[i] * this->vec_[i];
-        }
+                return norm2;
+            });
 
-        return sqrt(norm2);
+        return sqrt(sum);
     }
 
     template <>
     std::complex<float> HostVector<std::complex<float>>::Norm(void) const
     {
-        float norm2 = 0.0f;
+        float sum = _host_parallel_sum<float>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                float norm2 = 0.0f;
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
+                for(int i = begin; i < end; ++i)
+                {
+                    norm2 += this->vec_[i].real() * this->vec_[i].real()
+                             + this->vec_[i].imag() * this->vec_[i].imag();
+                }
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : norm2)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            norm2 += this->vec_[i].real() * this->vec_[i].real()
-                     + this->vec_[i].imag() * this->vec_[i].imag();
-        }
+                return norm2;
+            });
 
-        std::complex<float> res(sqrt(norm2), 0.0f);
+        std::complex<float> res(sqrt(sum), 0.0f);
 
         return res;
     }
@@ -1049,20 +1002,20 @@ namespace rocalution
     template <>
     std::complex<double> HostVector<std::complex<double>>::Norm(void) const
     {
-        double norm2 = 0.0;
+        double sum = _host_parallel_sum<double>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                double norm2 = 0.0;
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
+                for(int i = begin; i < end; ++i)
+                {
+                    norm2 += this->vec_[i].real() * this->vec_[i].real()
+                             + this->vec_[i].imag() * this->vec_[i].imag();
+                }
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : norm2)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            norm2 += this->vec_[i].real() * this->vec_[i].real()
-                     + this->vec_[i].imag() * this->vec_[i].imag();
-        }
+                return norm2;
+            });
 
-        std::complex<double> res(sqrt(norm2), 0.0);
+        std::complex<double> res(sqrt(sum), 0.0);
 
         return res;
     }
@@ -1077,59 +1030,53 @@ namespace rocalution
     template <typename ValueType>
     ValueType HostVector<ValueType>::Reduce(void) const
     {
-        ValueType reduce = static_cast<ValueType>(0);
-
-        _set_omp_backend_threads(this->local_backend_, this->size_);
+        return _host_parallel_sum<ValueType>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                ValueType reduce = static_cast<ValueType>(0);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : reduce)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            reduce += this->vec_[i];
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    reduce += this->vec_[i];
+                }
 
-        return reduce;
+                return reduce;
+            });
     }
 
     template <>
     std::complex<float> HostVector<std::complex<float>>::Reduce(void) const
     {
-        float reduce_real = 0.0f;
-        float reduce_imag = 0.0f;
-
-        _set_omp_backend_threads(this->local_backend_, this->size_);
+        return _host_parallel_sum<std::complex<float>>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                float reduce_real = 0.0f;
+                float reduce_imag = 0.0f;
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : reduce_real, reduce_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            reduce_real += this->vec_[i].real();
-            reduce_imag += this->vec_[i].imag();
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    reduce_real += this->vec_[i].real();
+                    reduce_imag += this->vec_[i].imag();
+                }
 
-        return std::complex<float>(reduce_real, reduce_imag);
+                return std::complex<float>(reduce_real, reduce_imag);
+            });
     }
 
     template <>
     std::complex<double> HostVector<std::complex<double>>::Reduce(void) const
     {
-        double reduce_real = 0.0;
-        double reduce_imag = 0.0;
-
-        _set_omp_backend_threads(this->local_backend_, this->size_);
+        return _host_parallel_sum<std::complex<double>>(
+            this->local_backend_, this->size_, [&](int begin, int end) {
+                double reduce_real = 0.0;
+                double reduce_imag = 0.0;
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : reduce_real, reduce_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            reduce_real += this->vec_[i].real();
-            reduce_imag += this->vec_[i].imag();
-        }
+                for(int i = begin; i < end; ++i)
+                {
+                    reduce_real += this->vec_[i].real();
+                    reduce_imag += this->vec_[i].imag();
+                }
 
-        return std::complex<double>(reduce_real, reduce_imag);
+                return std::complex<double>(reduce_real, reduce_imag);
+            });
     }
 
     template <typename ValueType>
@@ -1140,15 +1087,12 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = this->vec_[i] * cast_x->vec_[i];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = this->vec_[i] * cast_x->vec_[i];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -1163,15 +1107,12 @@ namespace rocalution
         assert(this->size_ == cast_x->size_);
         assert(this->size_ == cast_y->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = cast_y->vec_[i] * cast_x->vec_[i];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = cast_y->vec_[i] * cast_x->vec_[i];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -1191,15 +1132,12 @@ namespace rocalution
         assert(src_offset + size <= cast_src->size_);
         assert(dst_offset + size <= this->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < size; ++i)
-        {
-            this->vec_[i + dst_offset] = cast_src->vec_[i + src_offset];
-        }
+        _host_parallel_for(this->local_backend_, size, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i + dst_offset] = cast_src->vec_[i + src_offset];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -1211,20 +1149,17 @@ namespace rocalution
         assert(this->size_ == cast_perm->size_);
 
         HostVector<ValueType> vec_tmp(this->local_backend_);
-        vec_tmp.Allocate(this->size_);
+        vec_tmp.AllocateUninitialized(this->size_);
         vec_tmp.CopyFrom(*this);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            assert_dbg(cast_perm->vec_[i] >= 0);
-            assert_dbg(cast_perm->vec_[i] < this->size_);
-            this->vec_[cast_perm->vec_[i]] = vec_tmp.vec_[i];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                assert_dbg(cast_perm->vec_[i] >= 0);
+                assert_dbg(cast_perm->vec_[i] < this->size_);
+                this->vec_[cast_perm->vec_[i]] = vec_tmp.vec_[i];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -1236,20 +1171,17 @@ namespace rocalution
         assert(this->size_ == cast_perm->size_);
 
         HostVector<ValueType> vec_tmp(this->local_backend_);
-        vec_tmp.Allocate(this->size_);
+        vec_tmp.AllocateUninitialized(this->size_);
         vec_tmp.CopyFrom(*this);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            assert_dbg(cast_perm->vec_[i] >= 0);
-            assert_dbg(cast_perm->vec_[i] < this->size_);
-            this->vec_[i] = vec_tmp.vec_[cast_perm->vec_[i]];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                assert_dbg(cast_perm->vec_[i] >= 0);
+                assert_dbg(cast_perm->vec_[i] < this->size_);
+                this->vec_[i] = vec_tmp.vec_[cast_perm->vec_[i]];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -1266,15 +1198,12 @@ namespace rocalution
         assert(cast_vec->size_ == this->size_);
         assert(cast_perm->size_ == this->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[cast_perm->vec_[i]] = cast_vec->vec_[i];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[cast_perm->vec_[i]] = cast_vec->vec_[i];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -1291,15 +1220,12 @@ namespace rocalution
         assert(cast_vec->size_ == this->size_);
         assert(cast_perm->size_ == this->size_);
 
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = cast_vec->vec_[cast_perm->vec_[i]];
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = cast_vec->vec_[cast_perm->vec_[i]];
+            }
+        });
     }
 
     template <typename ValueType>
@@ -1356,6 +1282,449 @@ namespace rocalution
         return true;
     }
 
+    template <typename ValueType>
+    bool HostVector<ValueType>::CopyFromInterleaved(const BaseVector<ValueType>& src,
+                                                    int                          num_vectors,
+                                                    int                          index)
+    {
+        assert(this != &src);
+        assert(num_vectors > 0);
+        assert(index >= 0 && index < num_vectors);
+
+        const HostVector<ValueType>* cast_src = dynamic_cast<const HostVector<ValueType>*>(&src);
+
+        assert(cast_src != NULL);
+        assert(cast_src->size_ == this->size_ * num_vectors);
+
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = cast_src->vec_[i * num_vectors + index];
+            }
+        });
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::CopyToInterleaved(BaseVector<ValueType>* dst,
+                                                  int                    num_vectors,
+                                                  int                    index) const
+    {
+        assert(dst != NULL);
+        assert(this != dst);
+        assert(num_vectors > 0);
+        assert(index >= 0 && index < num_vectors);
+
+        HostVector<ValueType>* cast_dst = dynamic_cast<HostVector<ValueType>*>(dst);
+
+        assert(cast_dst != NULL);
+        assert(cast_dst->size_ == this->size_ * num_vectors);
+
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                cast_dst->vec_[i * num_vectors + index] = this->vec_[i];
+            }
+        });
+
+        return true;
+    }
+
+    // Conjugate for the block dot product, identity for non-complex types
+    template <typename ValueType>
+    static inline ValueType host_block_conj(const ValueType& val)
+    {
+        return val;
+    }
+
+    template <typename ValueType>
+    static inline std::complex<ValueType> host_block_conj(const std::complex<ValueType>& val)
+    {
+        return std::conj(val);
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::BlockDot(const BaseVector<ValueType>& x,
+                                         int                          num_vectors,
+                                         ValueType*                   result) const
+    {
+        assert(result != NULL);
+        assert(num_vectors > 0);
+
+        const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ % num_vectors == 0);
+
+        int k     = num_vectors;
+        int nrow  = this->size_ / k;
+        int nnz_k = k * k;
+
+        for(int i = 0; i < nnz_k; ++i)
+        {
+            result[i] = static_cast<ValueType>(0);
+        }
+
+        int nparts = _host_parallel_parts(this->local_backend_, this->size_, OpenMPKernelReduction);
+
+        // k x k accumulators of each part, padded to separate cache lines
+        int stride = nnz_k + 64 / sizeof(ValueType);
+
+        ValueType* sum = NULL;
+        allocate_host(nparts * stride, &sum);
+        set_to_zero_host(nparts * stride, sum);
+
+        _host_parallel_run(this->local_backend_, nparts, [&](int p) {
+            int        begin   = _host_part_begin(nrow, p, nparts);
+            int        end     = _host_part_begin(nrow, p + 1, nparts);
+            ValueType* sum_loc = &sum[p * stride];
+
+            for(int i = begin; i < end; ++i)
+            {
+                const ValueType* a = this->vec_ + i * k;
+                const ValueType* b = cast_x->vec_ + i * k;
+
+                for(int c = 0; c < k; ++c)
+                {
+                    for(int r = 0; r < k; ++r)
+                    {
+                        sum_loc[r + c * k] += host_block_conj(a[r]) * b[c];
+                    }
+                }
+            }
+        });
+
+        // Combine the parts in a fixed order
+        for(int p = 0; p < nparts; ++p)
+        {
+            for(int i = 0; i < nnz_k; ++i)
+            {
+                result[i] += sum[p * stride + i];
+            }
+        }
+
+        free_host(&sum);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::BlockAddScale(const BaseVector<ValueType>& x,
+                                              int                          num_vectors,
+                                              const ValueType*             scale)
+    {
+        assert(scale != NULL);
+        assert(num_vectors > 0);
+
+        const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ % num_vectors == 0);
+
+        int k    = num_vectors;
+        int nrow = this->size_ / k;
+
+        _host_parallel_for(this->local_backend_, nrow, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                ValueType*       y = this->vec_ + i * k;
+                const ValueType* b = cast_x->vec_ + i * k;
+
+                for(int c = 0; c < k; ++c)
+                {
+                    ValueType sum = static_cast<ValueType>(0);
+
+                    for(int r = 0; r < k; ++r)
+                    {
+                        sum += b[r] * scale[r + c * k];
+                    }
+
+                    y[c] += sum;
+                }
+            }
+        });
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::BlockScaleAdd(const ValueType*             scale,
+                                              const BaseVector<ValueType>& x,
+                                              int                          num_vectors)
+    {
+        assert(scale != NULL);
+        assert(num_vectors > 0);
+
+        const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(&x);
+
+        assert(cast_x != NULL);
+        assert(this->size_ == cast_x->size_);
+        assert(this->size_ % num_vectors == 0);
+
+        int k    = num_vectors;
+        int nrow = this->size_ / k;
+
+        int nparts = _host_parallel_parts(this->local_backend_, this->size_, OpenMPKernelBLAS1);
+
+        // Copy of the current row of each part, padded to separate cache lines
+        int stride = k + 64 / sizeof(ValueType);
+
+        ValueType* rows = NULL;
+        allocate_host(nparts * stride, &rows);
+
+        _host_parallel_run(this->local_backend_, nparts, [&](int p) {
+            int        begin = _host_part_begin(nrow, p, nparts);
+            int        end   = _host_part_begin(nrow, p + 1, nparts);
+            ValueType* row   = &rows[p * stride];
+
+            for(int i = begin; i < end; ++i)
+            {
+                ValueType*       y = this->vec_ + i * k;
+                const ValueType* b = cast_x->vec_ + i * k;
+
+                for(int c = 0; c < k; ++c)
+                {
+                    row[c] = y[c];
+                }
+
+                for(int c = 0; c < k; ++c)
+                {
+                    ValueType sum = b[c];
+
+                    for(int r = 0; r < k; ++r)
+                    {
+                        sum += row[r] * scale[r + c * k];
+                    }
+
+                    y[c] = sum;
+                }
+            }
+        });
+
+        free_host(&rows);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::BlockScale(const ValueType* scale, int num_vectors)
+    {
+        assert(scale != NULL);
+        assert(num_vectors > 0);
+        assert(this->size_ % num_vectors == 0);
+
+        int k    = num_vectors;
+        int nrow = this->size_ / k;
+
+        int nparts = _host_parallel_parts(this->local_backend_, this->size_, OpenMPKernelBLAS1);
+
+        // Copy of the current row of each part, padded to separate cache lines
+        int stride = k + 64 / sizeof(ValueType);
+
+        ValueType* rows = NULL;
+        allocate_host(nparts * stride, &rows);
+
+        _host_parallel_run(this->local_backend_, nparts, [&](int p) {
+            int        begin = _host_part_begin(nrow, p, nparts);
+            int        end   = _host_part_begin(nrow, p + 1, nparts);
+            ValueType* row   = &rows[p * stride];
+
+            for(int i = begin; i < end; ++i)
+            {
+                ValueType* y = this->vec_ + i * k;
+
+                for(int c = 0; c < k; ++c)
+                {
+                    row[c] = y[c];
+                }
+
+                for(int c = 0; c < k; ++c)
+                {
+                    ValueType sum = static_cast<ValueType>(0);
+
+                    for(int r = 0; r < k; ++r)
+                    {
+                        sum += row[r] * scale[r + c * k];
+                    }
+
+                    y[c] = sum;
+                }
+            }
+        });
+
+        free_host(&rows);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::FusedDot(int                                 num,
+                                         const BaseVector<ValueType>* const* x,
+                                         const BaseVector<ValueType>* const* y,
+                                         ValueType*                          result) const
+    {
+        assert(num > 0);
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(result != NULL);
+
+        std::vector<const ValueType*> vec_x(num);
+        std::vector<const ValueType*> vec_y(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            const HostVector<ValueType>* cast_x
+                = dynamic_cast<const HostVector<ValueType>*>(x[j]);
+            const HostVector<ValueType>* cast_y
+                = dynamic_cast<const HostVector<ValueType>*>(y[j]);
+
+            assert(cast_x != NULL);
+            assert(cast_y != NULL);
+            assert(cast_x->size_ == this->size_);
+            assert(cast_y->size_ == this->size_);
+
+            vec_x[j] = cast_x->vec_;
+            vec_y[j] = cast_y->vec_;
+
+            result[j] = static_cast<ValueType>(0);
+        }
+
+        int nparts = _host_parallel_parts(this->local_backend_, this->size_, OpenMPKernelReduction);
+
+        // Accumulators of each part, padded to separate cache lines
+        int stride = num + 64 / sizeof(ValueType);
+
+        ValueType* sum = NULL;
+        allocate_host(nparts * stride, &sum);
+        set_to_zero_host(nparts * stride, sum);
+
+        _host_parallel_run(this->local_backend_, nparts, [&](int p) {
+            int        begin   = _host_part_begin(this->size_, p, nparts);
+            int        end     = _host_part_begin(this->size_, p + 1, nparts);
+            ValueType* sum_loc = &sum[p * stride];
+
+            for(int i = begin; i < end; ++i)
+            {
+                for(int j = 0; j < num; ++j)
+                {
+                    sum_loc[j] += host_block_conj(vec_x[j][i]) * vec_y[j][i];
+                }
+            }
+        });
+
+        // Combine the parts in a fixed order
+        for(int p = 0; p < nparts; ++p)
+        {
+            for(int j = 0; j < num; ++j)
+            {
+                result[j] += sum[p * stride + j];
+            }
+        }
+
+        free_host(&sum);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::MultiDot(int                                 num,
+                                         const BaseVector<ValueType>* const* x,
+                                         ValueType*                          result) const
+    {
+        assert(num > 0);
+        assert(x != NULL);
+        assert(result != NULL);
+
+        // Fused dot products with y[j] = this, the entries of this vector are loaded once
+        // per row and reused from cache for all x[j]
+        std::vector<const BaseVector<ValueType>*> y(num, this);
+
+        return this->FusedDot(num, x, &y[0], result);
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::MultiAXPY(int                                 num,
+                                          const ValueType*                    alpha,
+                                          const BaseVector<ValueType>* const* x)
+    {
+        assert(num > 0);
+        assert(alpha != NULL);
+        assert(x != NULL);
+
+        std::vector<const ValueType*> vec_x(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            const HostVector<ValueType>* cast_x
+                = dynamic_cast<const HostVector<ValueType>*>(x[j]);
+
+            assert(cast_x != NULL);
+            assert(cast_x->size_ == this->size_);
+
+            vec_x[j] = cast_x->vec_;
+        }
+
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int j = 0; j < num; ++j)
+                {
+                    sum += alpha[j] * vec_x[j][i];
+                }
+
+                this->vec_[i] += sum;
+            }
+        });
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostVector<ValueType>::LinearCombination(int                                 num,
+                                                  const ValueType*                    alpha,
+                                                  const BaseVector<ValueType>* const* x)
+    {
+        assert(num > 0);
+        assert(alpha != NULL);
+        assert(x != NULL);
+
+        std::vector<const ValueType*> vec_x(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            const HostVector<ValueType>* cast_x
+                = dynamic_cast<const HostVector<ValueType>*>(x[j]);
+
+            assert(cast_x != NULL);
+            assert(cast_x->size_ == this->size_);
+
+            vec_x[j] = cast_x->vec_;
+        }
+
+        // Entry i of all operands is read before entry i of this vector is written, thus
+        // this vector can safely appear in the combination
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int j = 0; j < num; ++j)
+                {
+                    sum += alpha[j] * vec_x[j][i];
+                }
+
+                this->vec_[i] = sum;
+            }
+        });
+
+        return true;
+    }
+
     template <typename ValueType>
     void HostVector<ValueType>::SetIndexArray(int size, const int* index)
     {
@@ -1530,21 +1899,18 @@ namespace rocalution
     template <typename ValueType>
     void HostVector<ValueType>::Power(double power)
     {
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = pow(this->vec_[i], static_cast<ValueType>(power));
-        }
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
+            {
+                this->vec_[i] = pow(this->vec_[i], static_cast<ValueType>(power));
+            }
+        });
     }
 
     template <>
     void HostVector<std::complex<float>>::Power(double power)
     {
-        _set_omp_backend_threads(this->local_backend_, this->size_);
+        _set_omp_backend_threads(this->local_backend_, this->size_, OpenMPKernelBLAS1);
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -1558,21 +1924,18 @@ namespace rocalution
     template <>
     void HostVector<int>::Power(double power)
     {
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            int value = 1;
-            for(int j = 0; j < power; ++j)
+        _host_parallel_for(this->local_backend_, this->size_, [&](int begin, int end) {
+            for(int i = begin; i < end; ++i)
             {
-                value *= this->vec_[i];
-            }
+                int value = 1;
+                for(int j = 0; j < power; ++j)
+                {
+                    value *= this->vec_[i];
+                }
 
-            this->vec_[i] = value;
-        }
+                this->vec_[i] = value;
+            }
+        });
     }
 
     template class HostVector<bool>;
@@ -48,6 +48,7 @@ namespace rocalution
 
         virtual bool Check(void) const;
         virtual void Allocate(int n);
+        virtual void AllocateUninitialized(int n);
         virtual void SetDataPtr(ValueType** ptr, int size);
         virtual void LeaveDataPtr(ValueType** ptr);
         virtual void Clear(void);
@@ -78,6 +79,31 @@ namespace rocalution
         virtual bool Prolongation(const BaseVector<ValueType>& vec_coarse,
                                   const BaseVector<int>&       map);
 
+        virtual bool
+            CopyFromInterleaved(const BaseVector<ValueType>& src, int num_vectors, int index);
+        virtual bool
+            CopyToInterleaved(BaseVector<ValueType>* dst, int num_vectors, int index) const;
+        virtual bool
+            BlockDot(const BaseVector<ValueType>& x, int num_vectors, ValueType* result) const;
+        virtual bool
+            BlockAddScale(const BaseVector<ValueType>& x, int num_vectors, const ValueType* scale);
+        virtual bool
+            BlockScaleAdd(const ValueType* scale, const BaseVector<ValueType>& x, int num_vectors);
+        virtual bool BlockScale(const ValueType* scale, int num_vectors);
+        virtual bool FusedDot(int                                 num,
+                              const BaseVector<ValueType>* const* x,
+                              const BaseVector<ValueType>* const* y,
+                              ValueType*                          result) const;
+        virtual bool MultiDot(int                                 num,
+                              const BaseVector<ValueType>* const* x,
+                              ValueType*                          result) const;
+        virtual bool MultiAXPY(int                                 num,
+                               const ValueType*                    alpha,
+                               const BaseVector<ValueType>* const* x);
+        virtual bool LinearCombination(int                                 num,
+                                       const ValueType*                    alpha,
+                                       const BaseVector<ValueType>* const* x);
+
         /// Read vector from ASCII file
         void ReadFileASCII(const std::string& filename);
         /// Write vector to ASCII file
@@ -163,6 +189,7 @@ namespace rocalution
         friend class HostMatrixDIA<ValueType>;
         friend class HostMatrixELL<ValueType>;
         friend class HostMatrixHYB<ValueType>;
+        friend class HostMatrixSELL<ValueType>;
         friend class HostMatrixDENSE<ValueType>;
         friend class HostMatrixMCSR<ValueType>;
         friend class HostMatrixBCSR<ValueType>;
@@ -32,12 +32,14 @@
 #include "host/host_matrix_coo.hpp"
 #include "host/host_matrix_csr.hpp"
 #include "host/host_vector.hpp"
+#include "local_multi_vector.hpp"
 #include "local_vector.hpp"
 
 #include <algorithm>
 #include <complex>
 #include <sstream>
 #include <string.h>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -1529,6 +1531,12 @@ namespace rocalution
         // this->matrix_->Info();
     }
 
+    template <typename ValueType>
+    size_t LocalMatrix<ValueType>::GetMemoryUsage(void) const
+    {
+        return this->matrix_->GetMemoryUsage();
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::MoveToAccelerator(void)
     {
@@ -1547,6 +1555,16 @@ namespace rocalution
 
         if((_rocalution_available_accelerator()) && (this->matrix_ == this->matrix_host_))
         {
+            // SELL is a host format, the accelerator uses CSR instead
+            if(this->GetFormat() == SELL)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::MoveToAccelerator() SELL is not "
+                                 "supported on the accelerator, converting to CSR");
+
+                this->ConvertToCSR();
+            }
+
             this->matrix_accel_ = _rocalution_init_base_backend_matrix<ValueType>(
                 this->local_backend_, this->GetFormat(), this->GetBlockDimension());
             this->matrix_accel_->CopyFrom(*this->matrix_host_);
@@ -1605,6 +1623,16 @@ namespace rocalution
 
         if((_rocalution_available_accelerator()) && (this->matrix_ == this->matrix_host_))
         {
+            // SELL is a host format, the accelerator uses CSR instead
+            if(this->GetFormat() == SELL)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::MoveToAcceleratorAsync() SELL is not "
+                                 "supported on the accelerator, converting to CSR");
+
+                this->ConvertToCSR();
+            }
+
             this->matrix_accel_ = _rocalution_init_base_backend_matrix<ValueType>(
                 this->local_backend_, this->GetFormat(), this->GetBlockDimension());
             this->matrix_accel_->CopyFromAsync(*this->matrix_host_);
@@ -1735,6 +1763,12 @@ namespace rocalution
         this->ConvertTo(HYB);
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ConvertToSELL(void)
+    {
+        this->ConvertTo(SELL);
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::ConvertToDENSE(void)
     {
@@ -1748,7 +1782,17 @@ namespace rocalution
 
         assert((matrix_format == DENSE) || (matrix_format == CSR) || (matrix_format == MCSR)
                || (matrix_format == BCSR) || (matrix_format == COO) || (matrix_format == DIA)
-               || (matrix_format == ELL) || (matrix_format == HYB));
+               || (matrix_format == ELL) || (matrix_format == HYB) || (matrix_format == SELL));
+
+        // SELL is a host format, on the accelerator the matrix is kept in CSR format
+        if((matrix_format == SELL) && (this->is_accel_() == true))
+        {
+            LOG_VERBOSE_INFO(2,
+                             "*** warning: LocalMatrix::ConvertTo() SELL is not supported on the "
+                             "accelerator, using CSR");
+
+            matrix_format = CSR;
+        }
 
         LOG_VERBOSE_INFO(5,
                          "Converting " << _matrix_format_names[matrix_format] << " <- "
@@ -1885,16 +1929,13 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractDiagonal(LocalVector<ValueType>* vec_diag) const
+    void LocalMatrix<ValueType>::Apply(const LocalMultiVector<ValueType>& in,
+                                       LocalMultiVector<ValueType>*       out) const
     {
-        log_debug(this, "LocalMatrix::ExtractDiagonal()", vec_diag);
-
-        assert(vec_diag != NULL);
+        log_debug(this, "LocalMatrix::Apply()", (const void*&)in, out);
 
-        assert(
-            ((this->matrix_ == this->matrix_host_) && (vec_diag->vector_ == vec_diag->vector_host_))
-            || ((this->matrix_ == this->matrix_accel_)
-                && (vec_diag->vector_ == vec_diag->vector_accel_)));
+        assert(out != NULL);
+        assert(in.GetNumVectors() == out->GetNumVectors());
 
 #ifdef DEBUG_MODE
         this->Check();
@@ -1902,14 +1943,22 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            std::string vec_diag_name = "Diagonal elements of " + this->object_name_;
-            vec_diag->Allocate(vec_diag_name, std::min(this->GetLocalM(), this->GetLocalN()));
+            assert(in.GetSize() == this->GetN());
+            assert(out->GetSize() == this->GetM());
 
-            bool err = this->matrix_->ExtractDiagonal(vec_diag->vector_);
+            assert(((this->matrix_ == this->matrix_host_) && (in.is_host_() == true)
+                    && (out->is_host_() == true))
+                   || ((this->matrix_ == this->matrix_accel_) && (in.is_accel_() == true)
+                       && (out->is_accel_() == true)));
+
+            int num_vectors = in.GetNumVectors();
+
+            bool err = this->matrix_->ApplyMultiVector(
+                *in.data_.vector_, num_vectors, out->data_.vector_);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
+                LOG_INFO("Computation of LocalMatrix::Apply() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
@@ -1919,47 +1968,47 @@ namespace rocalution
                 LocalMatrix<ValueType> mat_host;
                 mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
                 mat_host.CopyFrom(*this);
+                mat_host.ConvertToCSR();
 
-                vec_diag->MoveToHost();
+                LocalVector<ValueType> in_host;
+                in_host.CopyFrom(in.data_);
 
-                mat_host.ConvertToCSR();
+                out->MoveToHost();
 
-                if(mat_host.matrix_->ExtractDiagonal(vec_diag->vector_) == false)
+                if(mat_host.matrix_->ApplyMultiVector(
+                       *in_host.vector_, num_vectors, out->data_.vector_) == false)
                 {
-                    LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
-                    this->Info();
+                    LOG_INFO("Computation of LocalMatrix::Apply() failed");
+                    mat_host.Info();
                     FATAL_ERROR(__FILE__, __LINE__);
                 }
 
                 if(this->GetFormat() != CSR)
                 {
                     LOG_VERBOSE_INFO(
-                        2,
-                        "*** warning: LocalMatrix::ExtractDiagonal() is performed in CSR format");
+                        2, "*** warning: LocalMatrix::Apply() is performed in CSR format");
                 }
 
                 if(this->is_accel_() == true)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ExtractDiagonal() is performed on the host");
+                        2, "*** warning: LocalMatrix::Apply() is performed on the host");
 
-                    vec_diag->MoveToAccelerator();
+                    out->MoveToAccelerator();
                 }
             }
         }
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractInverseDiagonal(LocalVector<ValueType>* vec_inv_diag) const
+    void LocalMatrix<ValueType>::ApplyAdd(const LocalMultiVector<ValueType>& in,
+                                          ValueType                          scalar,
+                                          LocalMultiVector<ValueType>*       out) const
     {
-        log_debug(this, "LocalMatrix::ExtractInverseDiagonal()", vec_inv_diag);
-
-        assert(vec_inv_diag != NULL);
+        log_debug(this, "LocalMatrix::ApplyAdd()", (const void*&)in, scalar, out);
 
-        assert(((this->matrix_ == this->matrix_host_)
-                && (vec_inv_diag->vector_ == vec_inv_diag->vector_host_))
-               || ((this->matrix_ == this->matrix_accel_)
-                   && (vec_inv_diag->vector_ == vec_inv_diag->vector_accel_)));
+        assert(out != NULL);
+        assert(in.GetNumVectors() == out->GetNumVectors());
 
 #ifdef DEBUG_MODE
         this->Check();
@@ -1967,16 +2016,22 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            std::string vec_inv_diag_name
-                = "Inverse of the diagonal elements of " + this->object_name_;
-            vec_inv_diag->Allocate(vec_inv_diag_name,
-                                   std::min(this->GetLocalM(), this->GetLocalN()));
+            assert(in.GetSize() == this->GetN());
+            assert(out->GetSize() == this->GetM());
 
-            bool err = this->matrix_->ExtractInverseDiagonal(vec_inv_diag->vector_);
+            assert(((this->matrix_ == this->matrix_host_) && (in.is_host_() == true)
+                    && (out->is_host_() == true))
+                   || ((this->matrix_ == this->matrix_accel_) && (in.is_accel_() == true)
+                       && (out->is_accel_() == true)));
+
+            int num_vectors = in.GetNumVectors();
+
+            bool err = this->matrix_->ApplyAddMultiVector(
+                *in.data_.vector_, num_vectors, scalar, out->data_.vector_);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::ExtractInverseDiagonal() failed");
+                LOG_INFO("Computation of LocalMatrix::ApplyAdd() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
@@ -1986,198 +2041,146 @@ namespace rocalution
                 LocalMatrix<ValueType> mat_host;
                 mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
                 mat_host.CopyFrom(*this);
+                mat_host.ConvertToCSR();
 
-                vec_inv_diag->MoveToHost();
+                LocalVector<ValueType> in_host;
+                in_host.CopyFrom(in.data_);
 
-                mat_host.ConvertToCSR();
+                out->MoveToHost();
 
-                if(mat_host.matrix_->ExtractInverseDiagonal(vec_inv_diag->vector_) == false)
+                if(mat_host.matrix_->ApplyAddMultiVector(
+                       *in_host.vector_, num_vectors, scalar, out->data_.vector_) == false)
                 {
-                    LOG_INFO("Computation of LocalMatrix::ExtractInverseDiagonal() failed");
-                    this->Info();
+                    LOG_INFO("Computation of LocalMatrix::ApplyAdd() failed");
+                    mat_host.Info();
                     FATAL_ERROR(__FILE__, __LINE__);
                 }
 
                 if(this->GetFormat() != CSR)
                 {
-                    LOG_VERBOSE_INFO(2,
-                                     "*** warning: LocalMatrix::ExtractInverseDiagonal() is "
-                                     "performed in CSR format");
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ApplyAdd() is performed in CSR format");
                 }
 
                 if(this->is_accel_() == true)
                 {
-                    LOG_VERBOSE_INFO(2,
-                                     "*** warning: LocalMatrix::ExtractInverseDiagonal() is "
-                                     "performed on the host");
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ApplyAdd() is performed on the host");
 
-                    vec_inv_diag->MoveToAccelerator();
+                    out->MoveToAccelerator();
                 }
             }
         }
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractSubMatrix(int                     row_offset,
-                                                  int                     col_offset,
-                                                  int                     row_size,
-                                                  int                     col_size,
-                                                  LocalMatrix<ValueType>* mat) const
+    ValueType LocalMatrix<ValueType>::ApplyDot(const LocalVector<ValueType>& in,
+                                               const LocalVector<ValueType>& x,
+                                               LocalVector<ValueType>*       out) const
     {
-        log_debug(this,
-                  "LocalMatrix::ExtractSubMatrix()",
-                  row_offset,
-                  col_offset,
-                  row_size,
-                  col_size,
-                  mat);
-
-        assert(this != mat);
-        assert(mat != NULL);
-        assert(row_size > 0);
-        assert(col_size > 0);
-        assert(static_cast<IndexType2>(row_offset) <= this->GetM());
-        assert(static_cast<IndexType2>(col_offset) <= this->GetN());
+        log_debug(this, "LocalMatrix::ApplyDot()", (const void*&)in, (const void*&)x, out);
 
-        assert(((this->matrix_ == this->matrix_host_) && (mat->matrix_ == mat->matrix_host_))
-               || ((this->matrix_ == this->matrix_accel_) && (mat->matrix_ == mat->matrix_accel_)));
+        assert(out != NULL);
 
 #ifdef DEBUG_MODE
         this->Check();
 #endif
 
-        mat->Clear();
-
         if(this->GetNnz() > 0)
         {
-            // Submatrix should be same format as full matrix
-            mat->ConvertTo(this->GetFormat(), this->GetBlockDimension());
+            assert(in.GetSize() == this->GetN());
+            assert(x.GetSize() == this->GetM());
+            assert(out->GetSize() == this->GetM());
 
-            bool err = false;
+            assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                    && (x.vector_ == x.vector_host_) && (out->vector_ == out->vector_host_))
+                   || ((this->matrix_ == this->matrix_accel_) && (in.vector_ == in.vector_accel_)
+                       && (x.vector_ == x.vector_accel_)
+                       && (out->vector_ == out->vector_accel_)));
 
-            // if the sub matrix has only 1 row
-            // it is computed on the host
-            if((this->is_host_() == true) || (row_size > 1))
-            {
-                err = this->matrix_->ExtractSubMatrix(
-                    row_offset, col_offset, row_size, col_size, mat->matrix_);
-            }
+            ValueType dot;
+
+            bool err = this->matrix_->ApplyDot(*in.vector_, *x.vector_, true, out->vector_, &dot);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::ExtractSubMatrix() failed");
+                LOG_INFO("Computation of LocalMatrix::ApplyDot() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
 
+            // Formats without a fused kernel compute the dot product separately
             if(err == false)
             {
-                LocalMatrix<ValueType> mat_host;
-                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
-                mat_host.CopyFrom(*this);
+                this->matrix_->Apply(*in.vector_, out->vector_);
 
-                mat->MoveToHost();
+                dot = x.Dot(*out);
+            }
 
-                mat_host.ConvertToCSR();
-                mat->ConvertToCSR();
+            return dot;
+        }
 
-                if(mat_host.matrix_->ExtractSubMatrix(
-                       row_offset, col_offset, row_size, col_size, mat->matrix_)
-                   == false)
-                {
-                    LOG_INFO("Computation of LocalMatrix::ExtractSubMatrix() failed");
-                    mat_host.Info();
-                    FATAL_ERROR(__FILE__, __LINE__);
-                }
+        return static_cast<ValueType>(0);
+    }
 
-                if(this->GetFormat() != CSR)
-                {
-                    if(row_size > 1)
-                    {
-                        LOG_VERBOSE_INFO(2,
-                                         "*** warning: LocalMatrix::ExtractSubMatrix() is "
-                                         "performed in CSR format");
-                    }
+    template <typename ValueType>
+    ValueType LocalMatrix<ValueType>::ApplyDotNonConj(const LocalVector<ValueType>& in,
+                                                      const LocalVector<ValueType>& x,
+                                                      LocalVector<ValueType>*       out) const
+    {
+        log_debug(this, "LocalMatrix::ApplyDotNonConj()", (const void*&)in, (const void*&)x, out);
 
-                    mat->ConvertTo(this->GetFormat(), this->GetBlockDimension());
-                }
+        assert(out != NULL);
 
-                if(this->is_accel_() == true)
-                {
-                    if(row_size > 1)
-                    {
-                        LOG_VERBOSE_INFO(2,
-                                         "*** warning: LocalMatrix::ExtractSubMatrix() is "
-                                         "performed on the host");
-                    }
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
 
-                    mat->MoveToAccelerator();
-                }
+        if(this->GetNnz() > 0)
+        {
+            assert(in.GetSize() == this->GetN());
+            assert(x.GetSize() == this->GetM());
+            assert(out->GetSize() == this->GetM());
 
-                if(row_size <= 1)
-                {
-                    LOG_VERBOSE_INFO(2,
-                                     "*** warning: LocalMatrix::ExtractSubMatrix() is performed on "
-                                     "the host due to size = 1");
-                }
-            }
+            assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                    && (x.vector_ == x.vector_host_) && (out->vector_ == out->vector_host_))
+                   || ((this->matrix_ == this->matrix_accel_) && (in.vector_ == in.vector_accel_)
+                       && (x.vector_ == x.vector_accel_)
+                       && (out->vector_ == out->vector_accel_)));
 
-            std::ostringstream row_begin;
-            std::ostringstream row_end;
-            std::ostringstream col_begin;
-            std::ostringstream col_end;
+            ValueType dot;
 
-            row_begin << row_offset;
-            row_end << row_offset + row_size - 1;
-            col_begin << col_offset;
-            col_end << col_offset + row_size - 1;
+            bool err = this->matrix_->ApplyDot(*in.vector_, *x.vector_, false, out->vector_, &dot);
 
-            std::string mat_name
-                = "Submatrix of " + this->object_name_ + " " + "["
-                  + row_begin
-                        .str() //static_cast<std::ostringstream*>(&(std::ostringstream() << row_offset))->str()
-                  + ","
-                  + col_begin
-                        .str() //static_cast<std::ostringstream*>(&(std::ostringstream() << col_offset))->str()
-                  + "]-" + "["
-                  + row_end.str() //static_cast<std::ostringstream*>(
-                  //    &(std::ostringstream() << row_offset + row_size - 1))
-                  //    ->str()
-                  + ","
-                  + col_end.str() //static_cast<std::ostringstream*>(
-                  //&(std::ostringstream() << col_offset + row_size - 1))
-                  //->str()
-                  + "]";
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ApplyDotNonConj() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
 
-            mat->object_name_ = mat_name;
+            // Formats without a fused kernel compute the dot product separately
+            if(err == false)
+            {
+                this->matrix_->Apply(*in.vector_, out->vector_);
+
+                dot = x.DotNonConj(*out);
+            }
+
+            return dot;
         }
 
-#ifdef DEBUG_MODE
-        mat->Check();
-#endif
+        return static_cast<ValueType>(0);
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractSubMatrices(int                       row_num_blocks,
-                                                    int                       col_num_blocks,
-                                                    const int*                row_offset,
-                                                    const int*                col_offset,
-                                                    LocalMatrix<ValueType>*** mat) const
+    ValueType LocalMatrix<ValueType>::ResidualNorm(const LocalVector<ValueType>& rhs,
+                                                   const LocalVector<ValueType>& in,
+                                                   LocalVector<ValueType>*       out) const
     {
-        log_debug(this,
-                  "LocalMatrix::ExtractSubMatrices()",
-                  row_num_blocks,
-                  col_num_blocks,
-                  row_offset,
-                  col_offset,
-                  mat);
+        log_debug(this, "LocalMatrix::ResidualNorm()", (const void*&)rhs, (const void*&)in, out);
 
-        assert(row_num_blocks > 0);
-        assert(col_num_blocks > 0);
-        assert(row_offset != NULL);
-        assert(col_offset != NULL);
-        assert(mat != NULL);
-        assert(*mat != NULL);
+        assert(out != NULL);
 
 #ifdef DEBUG_MODE
         this->Check();
@@ -2185,14 +2188,418 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            // implementation via ExtractSubMatrix() calls
-            // TODO OMP
-            //#pragma omp parallel for schedule(dynamic,1) collapse(2)
-            for(int i = 0; i < row_num_blocks; ++i)
-            {
-                for(int j = 0; j < col_num_blocks; ++j)
-                {
-                    this->ExtractSubMatrix(row_offset[i],
+            assert(rhs.GetSize() == this->GetM());
+            assert(in.GetSize() == this->GetN());
+            assert(out->GetSize() == this->GetM());
+
+            assert(((this->matrix_ == this->matrix_host_) && (rhs.vector_ == rhs.vector_host_)
+                    && (in.vector_ == in.vector_host_) && (out->vector_ == out->vector_host_))
+                   || ((this->matrix_ == this->matrix_accel_)
+                       && (rhs.vector_ == rhs.vector_accel_) && (in.vector_ == in.vector_accel_)
+                       && (out->vector_ == out->vector_accel_)));
+
+            ValueType norm;
+
+            bool err = this->matrix_->ResidualNorm(*rhs.vector_, *in.vector_, out->vector_, &norm);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ResidualNorm() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            // Formats without a fused kernel compute the norm separately
+            if(err == false)
+            {
+                this->matrix_->Apply(*in.vector_, out->vector_);
+                out->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+                norm = out->Norm();
+            }
+
+            return norm;
+        }
+
+        // Empty matrix, the residual is the right-hand side
+        out->CopyFrom(rhs);
+
+        return out->Norm();
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::MatrixPowers(const LocalVector<ValueType>& in,
+                                              int                           k,
+                                              const ValueType*              shift,
+                                              LocalVector<ValueType>**      out) const
+    {
+        log_debug(this, "LocalMatrix::MatrixPowers()", (const void*&)in, k, shift, out);
+
+        assert(k >= 0);
+        assert((k == 0) || (out != NULL));
+        assert(this->GetM() == this->GetN());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0 && k > 0)
+        {
+            assert(in.GetSize() == this->GetN());
+
+            std::vector<BaseVector<ValueType>*> out_vec(k);
+
+            for(int l = 0; l < k; ++l)
+            {
+                assert(out[l] != NULL);
+                assert(out[l] != &in);
+                assert(out[l]->GetSize() == this->GetM());
+
+                assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                        && (out[l]->vector_ == out[l]->vector_host_))
+                       || ((this->matrix_ == this->matrix_accel_)
+                           && (in.vector_ == in.vector_accel_)
+                           && (out[l]->vector_ == out[l]->vector_accel_)));
+
+                out_vec[l] = out[l]->vector_;
+            }
+
+            bool err = this->matrix_->MatrixPowers(*in.vector_, k, shift, &out_vec[0]);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::MatrixPowers() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            // Formats without a dedicated kernel apply the matrix k times
+            if(err == false)
+            {
+                for(int l = 0; l < k; ++l)
+                {
+                    const LocalVector<ValueType>* prev = (l == 0) ? &in : out[l - 1];
+
+                    this->matrix_->Apply(*prev->vector_, out[l]->vector_);
+
+                    if(shift != NULL)
+                    {
+                        out[l]->AddScale(*prev, -shift[l]);
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractDiagonal(LocalVector<ValueType>* vec_diag) const
+    {
+        log_debug(this, "LocalMatrix::ExtractDiagonal()", vec_diag);
+
+        assert(vec_diag != NULL);
+
+        assert(
+            ((this->matrix_ == this->matrix_host_) && (vec_diag->vector_ == vec_diag->vector_host_))
+            || ((this->matrix_ == this->matrix_accel_)
+                && (vec_diag->vector_ == vec_diag->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            std::string vec_diag_name = "Diagonal elements of " + this->object_name_;
+            vec_diag->Allocate(vec_diag_name, std::min(this->GetLocalM(), this->GetLocalN()));
+
+            bool err = this->matrix_->ExtractDiagonal(vec_diag->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                vec_diag->MoveToHost();
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->ExtractDiagonal(vec_diag->vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2,
+                        "*** warning: LocalMatrix::ExtractDiagonal() is performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ExtractDiagonal() is performed on the host");
+
+                    vec_diag->MoveToAccelerator();
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractInverseDiagonal(LocalVector<ValueType>* vec_inv_diag) const
+    {
+        log_debug(this, "LocalMatrix::ExtractInverseDiagonal()", vec_inv_diag);
+
+        assert(vec_inv_diag != NULL);
+
+        assert(((this->matrix_ == this->matrix_host_)
+                && (vec_inv_diag->vector_ == vec_inv_diag->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (vec_inv_diag->vector_ == vec_inv_diag->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            std::string vec_inv_diag_name
+                = "Inverse of the diagonal elements of " + this->object_name_;
+            vec_inv_diag->Allocate(vec_inv_diag_name,
+                                   std::min(this->GetLocalM(), this->GetLocalN()));
+
+            bool err = this->matrix_->ExtractInverseDiagonal(vec_inv_diag->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ExtractInverseDiagonal() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                vec_inv_diag->MoveToHost();
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->ExtractInverseDiagonal(vec_inv_diag->vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ExtractInverseDiagonal() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ExtractInverseDiagonal() is "
+                                     "performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ExtractInverseDiagonal() is "
+                                     "performed on the host");
+
+                    vec_inv_diag->MoveToAccelerator();
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractSubMatrix(int                     row_offset,
+                                                  int                     col_offset,
+                                                  int                     row_size,
+                                                  int                     col_size,
+                                                  LocalMatrix<ValueType>* mat) const
+    {
+        log_debug(this,
+                  "LocalMatrix::ExtractSubMatrix()",
+                  row_offset,
+                  col_offset,
+                  row_size,
+                  col_size,
+                  mat);
+
+        assert(this != mat);
+        assert(mat != NULL);
+        assert(row_size > 0);
+        assert(col_size > 0);
+        assert(static_cast<IndexType2>(row_offset) <= this->GetM());
+        assert(static_cast<IndexType2>(col_offset) <= this->GetN());
+
+        assert(((this->matrix_ == this->matrix_host_) && (mat->matrix_ == mat->matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (mat->matrix_ == mat->matrix_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        mat->Clear();
+
+        if(this->GetNnz() > 0)
+        {
+            // Submatrix should be same format as full matrix
+            mat->ConvertTo(this->GetFormat(), this->GetBlockDimension());
+
+            bool err = false;
+
+            // if the sub matrix has only 1 row
+            // it is computed on the host
+            if((this->is_host_() == true) || (row_size > 1))
+            {
+                err = this->matrix_->ExtractSubMatrix(
+                    row_offset, col_offset, row_size, col_size, mat->matrix_);
+            }
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ExtractSubMatrix() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                mat->MoveToHost();
+
+                mat_host.ConvertToCSR();
+                mat->ConvertToCSR();
+
+                if(mat_host.matrix_->ExtractSubMatrix(
+                       row_offset, col_offset, row_size, col_size, mat->matrix_)
+                   == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ExtractSubMatrix() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    if(row_size > 1)
+                    {
+                        LOG_VERBOSE_INFO(2,
+                                         "*** warning: LocalMatrix::ExtractSubMatrix() is "
+                                         "performed in CSR format");
+                    }
+
+                    mat->ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    if(row_size > 1)
+                    {
+                        LOG_VERBOSE_INFO(2,
+                                         "*** warning: LocalMatrix::ExtractSubMatrix() is "
+                                         "performed on the host");
+                    }
+
+                    mat->MoveToAccelerator();
+                }
+
+                if(row_size <= 1)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ExtractSubMatrix() is performed on "
+                                     "the host due to size = 1");
+                }
+            }
+
+            std::ostringstream row_begin;
+            std::ostringstream row_end;
+            std::ostringstream col_begin;
+            std::ostringstream col_end;
+
+            row_begin << row_offset;
+            row_end << row_offset + row_size - 1;
+            col_begin << col_offset;
+            col_end << col_offset + row_size - 1;
+
+            std::string mat_name
+                = "Submatrix of " + this->object_name_ + " " + "["
+                  + row_begin
+                        .str() //static_cast<std::ostringstream*>(&(std::ostringstream() << row_offset))->str()
+                  + ","
+                  + col_begin
+                        .str() //static_cast<std::ostringstream*>(&(std::ostringstream() << col_offset))->str()
+                  + "]-" + "["
+                  + row_end.str() //static_cast<std::ostringstream*>(
+                  //    &(std::ostringstream() << row_offset + row_size - 1))
+                  //    ->str()
+                  + ","
+                  + col_end.str() //static_cast<std::ostringstream*>(
+                  //&(std::ostringstream() << col_offset + row_size - 1))
+                  //->str()
+                  + "]";
+
+            mat->object_name_ = mat_name;
+        }
+
+#ifdef DEBUG_MODE
+        mat->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractSubMatrices(int                       row_num_blocks,
+                                                    int                       col_num_blocks,
+                                                    const int*                row_offset,
+                                                    const int*                col_offset,
+                                                    LocalMatrix<ValueType>*** mat) const
+    {
+        log_debug(this,
+                  "LocalMatrix::ExtractSubMatrices()",
+                  row_num_blocks,
+                  col_num_blocks,
+                  row_offset,
+                  col_offset,
+                  mat);
+
+        assert(row_num_blocks > 0);
+        assert(col_num_blocks > 0);
+        assert(row_offset != NULL);
+        assert(col_offset != NULL);
+        assert(mat != NULL);
+        assert(*mat != NULL);
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            // implementation via ExtractSubMatrix() calls
+            // TODO OMP
+            //#pragma omp parallel for schedule(dynamic,1) collapse(2)
+            for(int i = 0; i < row_num_blocks; ++i)
+            {
+                for(int j = 0; j < col_num_blocks; ++j)
+                {
+                    this->ExtractSubMatrix(row_offset[i],
                                            col_offset[j],
                                            row_offset[i + 1] - row_offset[i],
                                            col_offset[j + 1] - col_offset[j],
@@ -2203,15 +2610,101 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractU(LocalMatrix<ValueType>* U, bool diag) const
+    void LocalMatrix<ValueType>::ExtractU(LocalMatrix<ValueType>* U, bool diag) const
+    {
+        log_debug(this, "LocalMatrix::ExtractU()", U, diag);
+
+        assert(U != NULL);
+        assert(U != this);
+
+        assert(((this->matrix_ == this->matrix_host_) && (U->matrix_ == U->matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (U->matrix_ == U->matrix_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = false;
+
+            if(diag == true)
+            {
+                err = this->matrix_->ExtractUDiagonal(U->matrix_);
+            }
+            else
+            {
+                err = this->matrix_->ExtractU(U->matrix_);
+            }
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ExtractU() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                // Move to host
+                U->MoveToHost();
+
+                // Convert to CSR
+                mat_host.ConvertToCSR();
+
+                if(diag == true)
+                {
+                    err = mat_host.matrix_->ExtractUDiagonal(U->matrix_);
+                }
+                else
+                {
+                    err = mat_host.matrix_->ExtractU(U->matrix_);
+                }
+
+                if(err == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ExtractU() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ExtractU() is performed in CSR format");
+
+                    U->ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ExtractU() is performed on the host");
+
+                    U->MoveToAccelerator();
+                }
+            }
+        }
+
+#ifdef DEBUG_MODE
+        U->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractL(LocalMatrix<ValueType>* L, bool diag) const
     {
-        log_debug(this, "LocalMatrix::ExtractU()", U, diag);
+        log_debug(this, "LocalMatrix::ExtractL()", L, diag);
 
-        assert(U != NULL);
-        assert(U != this);
+        assert(L != NULL);
+        assert(L != this);
 
-        assert(((this->matrix_ == this->matrix_host_) && (U->matrix_ == U->matrix_host_))
-               || ((this->matrix_ == this->matrix_accel_) && (U->matrix_ == U->matrix_accel_)));
+        assert(((this->matrix_ == this->matrix_host_) && (L->matrix_ == L->matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (L->matrix_ == L->matrix_accel_)));
 
 #ifdef DEBUG_MODE
         this->Check();
@@ -2223,16 +2716,16 @@ namespace rocalution
 
             if(diag == true)
             {
-                err = this->matrix_->ExtractUDiagonal(U->matrix_);
+                err = this->matrix_->ExtractLDiagonal(L->matrix_);
             }
             else
             {
-                err = this->matrix_->ExtractU(U->matrix_);
+                err = this->matrix_->ExtractL(L->matrix_);
             }
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::ExtractU() failed");
+                LOG_INFO("Computation of LocalMatrix::ExtractL() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
@@ -2244,23 +2737,23 @@ namespace rocalution
                 mat_host.CopyFrom(*this);
 
                 // Move to host
-                U->MoveToHost();
+                L->MoveToHost();
 
                 // Convert to CSR
                 mat_host.ConvertToCSR();
 
                 if(diag == true)
                 {
-                    err = mat_host.matrix_->ExtractUDiagonal(U->matrix_);
+                    err = mat_host.matrix_->ExtractLDiagonal(L->matrix_);
                 }
                 else
                 {
-                    err = mat_host.matrix_->ExtractU(U->matrix_);
+                    err = mat_host.matrix_->ExtractL(L->matrix_);
                 }
 
                 if(err == false)
                 {
-                    LOG_INFO("Computation of LocalMatrix::ExtractU() failed");
+                    LOG_INFO("Computation of LocalMatrix::ExtractL() failed");
                     mat_host.Info();
                     FATAL_ERROR(__FILE__, __LINE__);
                 }
@@ -2268,36 +2761,62 @@ namespace rocalution
                 if(this->GetFormat() != CSR)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ExtractU() is performed in CSR format");
+                        2, "*** warning: LocalMatrix::ExtractL() is performed in CSR format");
 
-                    U->ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                    L->ConvertTo(this->GetFormat(), this->GetBlockDimension());
                 }
 
                 if(this->is_accel_() == true)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ExtractU() is performed on the host");
+                        2, "*** warning: LocalMatrix::ExtractL() is performed on the host");
 
-                    U->MoveToAccelerator();
+                    L->MoveToAccelerator();
                 }
             }
         }
 
 #ifdef DEBUG_MODE
-        U->Check();
+        L->Check();
 #endif
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractL(LocalMatrix<ValueType>* L, bool diag) const
+    void LocalMatrix<ValueType>::LUAnalyse(void)
     {
-        log_debug(this, "LocalMatrix::ExtractL()", L, diag);
+        log_debug(this, "LocalMatrix::LUAnalyse()");
 
-        assert(L != NULL);
-        assert(L != this);
+        if(this->GetNnz() > 0)
+        {
+            this->matrix_->LUAnalyse();
+        }
+    }
 
-        assert(((this->matrix_ == this->matrix_host_) && (L->matrix_ == L->matrix_host_))
-               || ((this->matrix_ == this->matrix_accel_) && (L->matrix_ == L->matrix_accel_)));
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::LUAnalyseClear(void)
+    {
+        log_debug(this, "LocalMatrix::LUAnalyseClear()");
+
+        if(this->GetNnz() > 0)
+        {
+            this->matrix_->LUAnalyseClear();
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::LUSolve(const LocalVector<ValueType>& in,
+                                         LocalVector<ValueType>*       out) const
+    {
+        log_debug(this, "LocalMatrix::LUSolve()", (const void*&)in, out);
+
+        assert(out != NULL);
+        assert(in.GetSize() == this->GetN());
+        assert(out->GetSize() == this->GetM());
+
+        assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                && (out->vector_ == out->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (in.vector_ == in.vector_accel_)
+                   && (out->vector_ == out->vector_accel_)));
 
 #ifdef DEBUG_MODE
         this->Check();
@@ -2305,20 +2824,106 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            bool err = false;
+            bool err = this->matrix_->LUSolve(*in.vector_, out->vector_);
 
-            if(diag == true)
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                err = this->matrix_->ExtractLDiagonal(L->matrix_);
+                LOG_INFO("Computation of LocalMatrix::LUSolve() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
             }
-            else
+
+            if(err == false)
             {
-                err = this->matrix_->ExtractL(L->matrix_);
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                LocalVector<ValueType> vec_host;
+                vec_host.CopyFrom(in);
+
+                out->MoveToHost();
+
+                // Try again
+                err = mat_host.matrix_->LUSolve(*vec_host.vector_, out->vector_);
+
+                if(err == false)
+                {
+                    mat_host.ConvertToCSR();
+
+                    if(mat_host.matrix_->LUSolve(*vec_host.vector_, out->vector_) == false)
+                    {
+                        LOG_INFO("Computation of LocalMatrix::LUSolve() failed");
+                        mat_host.Info();
+                        FATAL_ERROR(__FILE__, __LINE__);
+                    }
+
+                    if(this->GetFormat() != CSR)
+                    {
+                        LOG_VERBOSE_INFO(
+                            2, "*** warning: LocalMatrix::LUSolve() is performed in CSR format");
+                    }
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::LUSolve() is performed on the host");
+
+                    out->MoveToAccelerator();
+                }
             }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::LLAnalyse(void)
+    {
+        log_debug(this, "LocalMatrix::LLAnalyse()");
+
+        if(this->GetNnz() > 0)
+        {
+            this->matrix_->LLAnalyse();
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::LLAnalyseClear(void)
+    {
+        log_debug(this, "LocalMatrix::LLAnalyseClear()");
+
+        if(this->GetNnz() > 0)
+        {
+            this->matrix_->LLAnalyseClear();
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::LLSolve(const LocalVector<ValueType>& in,
+                                         LocalVector<ValueType>*       out) const
+    {
+        log_debug(this, "LocalMatrix::LLSolve()", (const void*&)in, out);
+
+        assert(out != NULL);
+        assert(in.GetSize() == this->GetN());
+        assert(out->GetSize() == this->GetM());
+
+        assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                && (out->vector_ == out->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (in.vector_ == in.vector_accel_)
+                   && (out->vector_ == out->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->LLSolve(*in.vector_, out->vector_);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::ExtractL() failed");
+                LOG_INFO("Computation of LocalMatrix::LLSolve() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
@@ -2329,24 +2934,91 @@ namespace rocalution
                 mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
                 mat_host.CopyFrom(*this);
 
-                // Move to host
-                L->MoveToHost();
+                LocalVector<ValueType> vec_host;
+                vec_host.CopyFrom(in);
+
+                out->MoveToHost();
 
-                // Convert to CSR
                 mat_host.ConvertToCSR();
 
-                if(diag == true)
+                if(mat_host.matrix_->LLSolve(*vec_host.vector_, out->vector_) == false)
                 {
-                    err = mat_host.matrix_->ExtractLDiagonal(L->matrix_);
+                    LOG_INFO("Computation of LocalMatrix::LLSolve() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
                 }
-                else
+
+                if(this->GetFormat() != CSR)
                 {
-                    err = mat_host.matrix_->ExtractL(L->matrix_);
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::LLSolve() is performed in CSR format");
                 }
 
-                if(err == false)
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::LLSolve() is performed on the host");
+
+                    out->MoveToAccelerator();
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::LLSolve(const LocalVector<ValueType>& in,
+                                         const LocalVector<ValueType>& inv_diag,
+                                         LocalVector<ValueType>*       out) const
+    {
+        log_debug(this, "LocalMatrix::LLSolve()", (const void*&)in, (const void*&)inv_diag, out);
+
+        assert(out != NULL);
+        assert(in.GetSize() == this->GetN());
+        assert(out->GetSize() == this->GetM());
+
+        assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                && (out->vector_ == out->vector_host_)
+                && (inv_diag.vector_ == inv_diag.vector_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (in.vector_ == in.vector_accel_)
+                   && (out->vector_ == out->vector_accel_)
+                   && (inv_diag.vector_ == inv_diag.vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->LLSolve(*in.vector_, *inv_diag.vector_, out->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::LLSolve() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                LocalVector<ValueType> vec_host;
+                vec_host.CopyFrom(in);
+
+                LocalVector<ValueType> inv_diag_host;
+                inv_diag_host.CopyFrom(inv_diag);
+
+                out->MoveToHost();
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->LLSolve(
+                       *vec_host.vector_, *inv_diag_host.vector_, out->vector_)
+                   == false)
                 {
-                    LOG_INFO("Computation of LocalMatrix::ExtractL() failed");
+                    LOG_INFO("Computation of LocalMatrix::LLSolve() failed");
                     mat_host.Info();
                     FATAL_ERROR(__FILE__, __LINE__);
                 }
@@ -2354,54 +3026,50 @@ namespace rocalution
                 if(this->GetFormat() != CSR)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ExtractL() is performed in CSR format");
-
-                    L->ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                        2, "*** warning: LocalMatrix::LLSolve() is performed in CSR format");
                 }
 
                 if(this->is_accel_() == true)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ExtractL() is performed on the host");
+                        2, "*** warning: LocalMatrix::LLSolve() is performed on the host");
 
-                    L->MoveToAccelerator();
+                    out->MoveToAccelerator();
                 }
             }
         }
-
-#ifdef DEBUG_MODE
-        L->Check();
-#endif
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::LUAnalyse(void)
+    void LocalMatrix<ValueType>::ItLUAnalyse(void)
     {
-        log_debug(this, "LocalMatrix::LUAnalyse()");
+        log_debug(this, "LocalMatrix::ItLUAnalyse()");
 
         if(this->GetNnz() > 0)
         {
-            this->matrix_->LUAnalyse();
+            this->matrix_->ItLUAnalyse();
         }
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::LUAnalyseClear(void)
+    void LocalMatrix<ValueType>::ItLUAnalyseClear(void)
     {
-        log_debug(this, "LocalMatrix::LUAnalyseClear()");
+        log_debug(this, "LocalMatrix::ItLUAnalyseClear()");
 
         if(this->GetNnz() > 0)
         {
-            this->matrix_->LUAnalyseClear();
+            this->matrix_->ItLUAnalyseClear();
         }
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::LUSolve(const LocalVector<ValueType>& in,
-                                         LocalVector<ValueType>*       out) const
+    void LocalMatrix<ValueType>::ItLUSolve(int                           max_iter,
+                                           const LocalVector<ValueType>& in,
+                                           LocalVector<ValueType>*       out) const
     {
-        log_debug(this, "LocalMatrix::LUSolve()", (const void*&)in, out);
+        log_debug(this, "LocalMatrix::ItLUSolve()", max_iter, (const void*&)in, out);
 
+        assert(max_iter > 0);
         assert(out != NULL);
         assert(in.GetSize() == this->GetN());
         assert(out->GetSize() == this->GetM());
@@ -2417,11 +3085,11 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            bool err = this->matrix_->LUSolve(*in.vector_, out->vector_);
+            bool err = this->matrix_->ItLUSolve(max_iter, *in.vector_, out->vector_);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::LUSolve() failed");
+                LOG_INFO("Computation of LocalMatrix::ItLUSolve() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
@@ -2437,31 +3105,26 @@ namespace rocalution
 
                 out->MoveToHost();
 
-                // Try again
-                err = mat_host.matrix_->LUSolve(*vec_host.vector_, out->vector_);
+                mat_host.ConvertToCSR();
 
-                if(err == false)
+                if(mat_host.matrix_->ItLUSolve(max_iter, *vec_host.vector_, out->vector_)
+                   == false)
                 {
-                    mat_host.ConvertToCSR();
-
-                    if(mat_host.matrix_->LUSolve(*vec_host.vector_, out->vector_) == false)
-                    {
-                        LOG_INFO("Computation of LocalMatrix::LUSolve() failed");
-                        mat_host.Info();
-                        FATAL_ERROR(__FILE__, __LINE__);
-                    }
+                    LOG_INFO("Computation of LocalMatrix::ItLUSolve() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
 
-                    if(this->GetFormat() != CSR)
-                    {
-                        LOG_VERBOSE_INFO(
-                            2, "*** warning: LocalMatrix::LUSolve() is performed in CSR format");
-                    }
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ItLUSolve() is performed in CSR format");
                 }
 
                 if(this->is_accel_() == true)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::LUSolve() is performed on the host");
+                        2, "*** warning: LocalMatrix::ItLUSolve() is performed on the host");
 
                     out->MoveToAccelerator();
                 }
@@ -2470,33 +3133,35 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::LLAnalyse(void)
+    void LocalMatrix<ValueType>::ItLLAnalyse(void)
     {
-        log_debug(this, "LocalMatrix::LLAnalyse()");
+        log_debug(this, "LocalMatrix::ItLLAnalyse()");
 
         if(this->GetNnz() > 0)
         {
-            this->matrix_->LLAnalyse();
+            this->matrix_->ItLLAnalyse();
         }
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::LLAnalyseClear(void)
+    void LocalMatrix<ValueType>::ItLLAnalyseClear(void)
     {
-        log_debug(this, "LocalMatrix::LLAnalyseClear()");
+        log_debug(this, "LocalMatrix::ItLLAnalyseClear()");
 
         if(this->GetNnz() > 0)
         {
-            this->matrix_->LLAnalyseClear();
+            this->matrix_->ItLLAnalyseClear();
         }
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::LLSolve(const LocalVector<ValueType>& in,
-                                         LocalVector<ValueType>*       out) const
+    void LocalMatrix<ValueType>::ItLLSolve(int                           max_iter,
+                                           const LocalVector<ValueType>& in,
+                                           LocalVector<ValueType>*       out) const
     {
-        log_debug(this, "LocalMatrix::LLSolve()", (const void*&)in, out);
+        log_debug(this, "LocalMatrix::ItLLSolve()", max_iter, (const void*&)in, out);
 
+        assert(max_iter > 0);
         assert(out != NULL);
         assert(in.GetSize() == this->GetN());
         assert(out->GetSize() == this->GetM());
@@ -2512,11 +3177,11 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            bool err = this->matrix_->LLSolve(*in.vector_, out->vector_);
+            bool err = this->matrix_->ItLLSolve(max_iter, *in.vector_, out->vector_);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::LLSolve() failed");
+                LOG_INFO("Computation of LocalMatrix::ItLLSolve() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
@@ -2534,9 +3199,10 @@ namespace rocalution
 
                 mat_host.ConvertToCSR();
 
-                if(mat_host.matrix_->LLSolve(*vec_host.vector_, out->vector_) == false)
+                if(mat_host.matrix_->ItLLSolve(max_iter, *vec_host.vector_, out->vector_)
+                   == false)
                 {
-                    LOG_INFO("Computation of LocalMatrix::LLSolve() failed");
+                    LOG_INFO("Computation of LocalMatrix::ItLLSolve() failed");
                     mat_host.Info();
                     FATAL_ERROR(__FILE__, __LINE__);
                 }
@@ -2544,13 +3210,13 @@ namespace rocalution
                 if(this->GetFormat() != CSR)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::LLSolve() is performed in CSR format");
+                        2, "*** warning: LocalMatrix::ItLLSolve() is performed in CSR format");
                 }
 
                 if(this->is_accel_() == true)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::LLSolve() is performed on the host");
+                        2, "*** warning: LocalMatrix::ItLLSolve() is performed on the host");
 
                     out->MoveToAccelerator();
                 }
@@ -2559,12 +3225,19 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::LLSolve(const LocalVector<ValueType>& in,
-                                         const LocalVector<ValueType>& inv_diag,
-                                         LocalVector<ValueType>*       out) const
+    void LocalMatrix<ValueType>::ItLLSolve(int                           max_iter,
+                                           const LocalVector<ValueType>& in,
+                                           const LocalVector<ValueType>& inv_diag,
+                                           LocalVector<ValueType>*       out) const
     {
-        log_debug(this, "LocalMatrix::LLSolve()", (const void*&)in, (const void*&)inv_diag, out);
+        log_debug(this,
+                  "LocalMatrix::ItLLSolve()",
+                  max_iter,
+                  (const void*&)in,
+                  (const void*&)inv_diag,
+                  out);
 
+        assert(max_iter > 0);
         assert(out != NULL);
         assert(in.GetSize() == this->GetN());
         assert(out->GetSize() == this->GetM());
@@ -2582,11 +3255,12 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            bool err = this->matrix_->LLSolve(*in.vector_, *inv_diag.vector_, out->vector_);
+            bool err = this->matrix_->ItLLSolve(
+                max_iter, *in.vector_, *inv_diag.vector_, out->vector_);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
             {
-                LOG_INFO("Computation of LocalMatrix::LLSolve() failed");
+                LOG_INFO("Computation of LocalMatrix::ItLLSolve() failed");
                 this->Info();
                 FATAL_ERROR(__FILE__, __LINE__);
             }
@@ -2607,11 +3281,11 @@ namespace rocalution
 
                 mat_host.ConvertToCSR();
 
-                if(mat_host.matrix_->LLSolve(
-                       *vec_host.vector_, *inv_diag_host.vector_, out->vector_)
+                if(mat_host.matrix_->ItLLSolve(
+                       max_iter, *vec_host.vector_, *inv_diag_host.vector_, out->vector_)
                    == false)
                 {
-                    LOG_INFO("Computation of LocalMatrix::LLSolve() failed");
+                    LOG_INFO("Computation of LocalMatrix::ItLLSolve() failed");
                     mat_host.Info();
                     FATAL_ERROR(__FILE__, __LINE__);
                 }
@@ -2619,13 +3293,13 @@ namespace rocalution
                 if(this->GetFormat() != CSR)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::LLSolve() is performed in CSR format");
+                        2, "*** warning: LocalMatrix::ItLLSolve() is performed in CSR format");
                 }
 
                 if(this->is_accel_() == true)
                 {
                     LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::LLSolve() is performed on the host");
+                        2, "*** warning: LocalMatrix::ItLLSolve() is performed on the host");
 
                     out->MoveToAccelerator();
                 }
@@ -2867,6 +3541,70 @@ namespace rocalution
             }
         }
 
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ItILU0Factorize(int max_iter)
+    {
+        log_debug(this, "LocalMatrix::ItILU0Factorize()", max_iter);
+
+        assert(max_iter > 0);
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->ItILU0Factorize(max_iter);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ItILU0Factorize() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                // Move to host
+                bool is_accel = this->is_accel_();
+                this->MoveToHost();
+
+                // Convert to CSR
+                unsigned int format   = this->GetFormat();
+                int          blockdim = this->GetBlockDimension();
+                this->ConvertToCSR();
+
+                if(this->matrix_->ItILU0Factorize(max_iter) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ItILU0Factorize() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(format != CSR)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ItILU0Factorize() is performed in "
+                                     "CSR format");
+
+                    this->ConvertTo(format, blockdim);
+                }
+
+                if(is_accel == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ItILU0Factorize() is performed on the host");
+
+                    this->MoveToAccelerator();
+                }
+            }
+        }
+
 #ifdef DEBUG_MODE
         this->Check();
 #endif
@@ -3139,6 +3877,77 @@ namespace rocalution
             }
         }
 
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ItICFactorize(int max_iter, LocalVector<ValueType>* inv_diag)
+    {
+        log_debug(this, "LocalMatrix::ItICFactorize()", max_iter, inv_diag);
+
+        assert(max_iter > 0);
+        assert(inv_diag != NULL);
+
+        assert(
+            ((this->matrix_ == this->matrix_host_) && (inv_diag->vector_ == inv_diag->vector_host_))
+            || ((this->matrix_ == this->matrix_accel_)
+                && (inv_diag->vector_ == inv_diag->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->ItICFactorize(max_iter, inv_diag->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ItICFactorize() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                // Move to host
+                bool is_accel = this->is_accel_();
+                this->MoveToHost();
+                inv_diag->MoveToHost();
+
+                // Convert to CSR
+                unsigned int format   = this->GetFormat();
+                int          blockdim = this->GetBlockDimension();
+                this->ConvertToCSR();
+
+                if(this->matrix_->ItICFactorize(max_iter, inv_diag->vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ItICFactorize() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(format != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ItICFactorize() is performed in CSR format");
+
+                    this->ConvertTo(format, blockdim);
+                }
+
+                if(is_accel == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ItICFactorize() is performed on the host");
+
+                    this->MoveToAccelerator();
+                    inv_diag->MoveToAccelerator();
+                }
+            }
+        }
+
 #ifdef DEBUG_MODE
         this->Check();
 #endif
@@ -3358,6 +4167,79 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::PartitionPermutation(int               num_parts,
+                                                      int&              size,
+                                                      LocalVector<int>* permutation) const
+    {
+        log_debug(this, "LocalMatrix::PartitionPermutation()", num_parts, size, permutation);
+
+        assert(num_parts > 0);
+        assert(permutation != NULL);
+        assert(this->GetM() == this->GetN());
+
+        assert(((this->matrix_ == this->matrix_host_)
+                && (permutation->vector_ == permutation->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (permutation->vector_ == permutation->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            std::string vec_perm_name = "PartitionPermutation permutation of " + this->object_name_;
+            permutation->Allocate(vec_perm_name, this->GetLocalM());
+
+            bool err = this->matrix_->PartitionPermutation(num_parts, size, permutation->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::PartitionPermutation() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat(), this->GetBlockDimension());
+                mat_host.CopyFrom(*this);
+
+                // Move to host
+                permutation->MoveToHost();
+
+                // Convert to CSR
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->PartitionPermutation(num_parts, size, permutation->vector_)
+                   == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::PartitionPermutation() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::PartitionPermutation() is "
+                                     "performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::PartitionPermutation() is "
+                                     "performed on the host");
+
+                    permutation->MoveToAccelerator();
+                }
+            }
+        }
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::Householder(int                     idx,
                                              ValueType&              beta,
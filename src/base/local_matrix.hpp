@@ -39,6 +39,8 @@ namespace rocalution
     template <typename ValueType>
     class LocalVector;
     template <typename ValueType>
+    class LocalMultiVector;
+    template <typename ValueType>
     class GlobalVector;
 
     template <typename ValueType>
@@ -55,7 +57,7 @@ namespace rocalution
   * \tparam ValueType - can be int, float, double, std::complex<float> and
   *                     std::complex<double>
   *
-  * A number of matrix formats are supported. These are CSR, BCSR, MCSR, COO, DIA, ELL, HYB, and DENSE.
+  * A number of matrix formats are supported. These are CSR, BCSR, MCSR, COO, DIA, ELL, HYB, SELL, and DENSE.
   * \note For CSR type matrices, the column indices must be sorted in increasing order. For COO matrices, the row
   * indices must be sorted in increasing order. The function \p Check can be used to check whether a matrix
   * contains valid data. For CSR and COO matrices, the function \p Sort can be used to sort the row or column
@@ -72,6 +74,8 @@ namespace rocalution
 
         ROCALUTION_EXPORT
         virtual void Info(void) const;
+        ROCALUTION_EXPORT
+        virtual size_t GetMemoryUsage(void) const;
 
         /** \brief Return the matrix format id (see matrix_formats.hpp) */
         ROCALUTION_EXPORT
@@ -455,9 +459,41 @@ namespace rocalution
         ROCALUTION_EXPORT
         void ZeroBlockPermutation(int& size, LocalVector<int>* permutation) const;
 
+        /** \brief Return a permutation that decouples nnz-balanced parts of the matrix
+      * \details
+      * The rows are split into \p num_parts parts of consecutive rows with a similar
+      * number of non-zero entries. All rows that couple to a previous part, or that are
+      * referenced by a previous part, are mapped to the last block of the matrix. After
+      * permutation, the interior rows of each part only depend on rows of the same part
+      * and the interface block, such that the parts can be factorized independently.
+      *
+      * @param[in]
+      * num_parts   number of parts
+      * @param[out]
+      * size        number of interior rows (size of the first block)
+      * @param[out]
+      * permutation permutation vector for the partition permutation
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalVector<int> perm;
+      *   int size;
+      *
+      *   mat.PartitionPermutation(8, size, &perm);
+      *   mat.Permute(perm);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void PartitionPermutation(int num_parts, int& size, LocalVector<int>* permutation) const;
+
         /** \brief Perform ILU(0) factorization */
         ROCALUTION_EXPORT
         void ILU0Factorize(void);
+        /** \brief Perform ILU(0) factorization by \p max_iter parallel fixed-point sweeps
+      * over all non-zero entries, see \cite Chow2015
+      */
+        ROCALUTION_EXPORT
+        void ItILU0Factorize(int max_iter);
         /** \brief Perform LU factorization */
         ROCALUTION_EXPORT
         void LUFactorize(void);
@@ -486,6 +522,11 @@ namespace rocalution
         /** \brief Perform IC(0) factorization */
         ROCALUTION_EXPORT
         void ICFactorize(LocalVector<ValueType>* inv_diag);
+        /** \brief Perform IC(0) factorization by \p max_iter parallel fixed-point sweeps
+      * over all non-zero entries, see \cite Chow2015
+      */
+        ROCALUTION_EXPORT
+        void ItICFactorize(int max_iter, LocalVector<ValueType>* inv_diag);
 
         /** \brief Analyse the structure (level-scheduling) */
         ROCALUTION_EXPORT
@@ -506,6 +547,44 @@ namespace rocalution
                      const LocalVector<ValueType>& inv_diag,
                      LocalVector<ValueType>*       out) const;
 
+        /** \brief Prepare the approximate LU solve by Jacobi sweeps (see ItLUSolve) */
+        ROCALUTION_EXPORT
+        void ItLUAnalyse(void);
+        /** \brief Delete the analysed data (see ItLUAnalyse) */
+        ROCALUTION_EXPORT
+        void ItLUAnalyseClear(void);
+        /** \brief Approximate LU out = in by \p max_iter Jacobi sweeps over each triangular
+      * factor, starting with a zero initial guess. The sweeps are fully parallel, but
+      * the solve is exact only if \p max_iter is at least the number of levels of the
+      * factors.
+      */
+        ROCALUTION_EXPORT
+        void ItLUSolve(int                           max_iter,
+                       const LocalVector<ValueType>& in,
+                       LocalVector<ValueType>*       out) const;
+
+        /** \brief Prepare the approximate LL^T solve by Jacobi sweeps (see ItLLSolve) */
+        ROCALUTION_EXPORT
+        void ItLLAnalyse(void);
+        /** \brief Delete the analysed data (see ItLLAnalyse) */
+        ROCALUTION_EXPORT
+        void ItLLAnalyseClear(void);
+        /** \brief Approximate LL^T out = in by \p max_iter Jacobi sweeps over each triangular
+      * factor, starting with a zero initial guess
+      */
+        ROCALUTION_EXPORT
+        void ItLLSolve(int                           max_iter,
+                       const LocalVector<ValueType>& in,
+                       LocalVector<ValueType>*       out) const;
+        /** \brief Approximate LL^T out = in by \p max_iter Jacobi sweeps over each triangular
+      * factor, starting with a zero initial guess
+      */
+        ROCALUTION_EXPORT
+        void ItLLSolve(int                           max_iter,
+                       const LocalVector<ValueType>& in,
+                       const LocalVector<ValueType>& inv_diag,
+                       LocalVector<ValueType>*       out) const;
+
         /** \brief Analyse the structure (level-scheduling) L-part
       * - diag_unit == true the diag is 1;
       * - diag_unit == false the diag is 0;
@@ -807,6 +886,16 @@ namespace rocalution
         /** \brief Convert the matrix to HYB structure */
         ROCALUTION_EXPORT
         void ConvertToHYB(void);
+        /** \brief Convert the matrix to SELL-C-sigma structure
+      * \details
+      * Slices of 8 consecutive rows are stored in ELL format, where the rows are sorted
+      * by their length within windows of 256 rows beforehand. Compared to ELL, only the
+      * rows of a slice are padded to the same length, while the matrix-vector product
+      * still processes the rows of a slice in SIMD lanes. SELL is a host format, on the
+      * accelerator the matrix is kept in CSR format.
+      */
+        ROCALUTION_EXPORT
+        void ConvertToSELL(void);
         /** \brief Convert the matrix to DENSE structure */
         ROCALUTION_EXPORT
         void ConvertToDENSE(void);
@@ -821,6 +910,88 @@ namespace rocalution
                               ValueType                     scalar,
                               LocalVector<ValueType>*       out) const;
 
+        /** \brief Apply the matrix to all vectors of a multi-vector, \f$out = this \cdot in\f$
+      * \details
+      * The matrix is read only once for all vectors, which is significantly faster than
+      * applying it to each vector separately.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalMultiVector<ValueType> X;
+      *   LocalMultiVector<ValueType> Y;
+      *
+      *   X.Allocate("X", mat.GetN(), 16);
+      *   Y.Allocate("Y", mat.GetM(), 16);
+      *
+      *   // Fill X
+      *   // ...
+      *
+      *   mat.Apply(X, &Y);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void Apply(const LocalMultiVector<ValueType>& in, LocalMultiVector<ValueType>* out) const;
+        /** \brief Apply and add the matrix to all vectors of a multi-vector,
+      * \f$out = out + scalar \cdot this \cdot in\f$
+      */
+        ROCALUTION_EXPORT
+        void ApplyAdd(const LocalMultiVector<ValueType>& in,
+                      ValueType                          scalar,
+                      LocalMultiVector<ValueType>*       out) const;
+
+        /** \brief Apply the matrix and compute a dot product with the result,
+      * \f$out = this \cdot in\f$, returns \f$x^H \cdot out\f$
+      * \details
+      * On the host, the CSR format accumulates the dot product in the same pass as the
+      * matrix-vector product, such that \p out is not read again.
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ApplyDot(const LocalVector<ValueType>& in,
+                                   const LocalVector<ValueType>& x,
+                                   LocalVector<ValueType>*       out) const;
+        /** \brief Apply the matrix and compute a non-conjugated dot product with the result,
+      * \f$out = this \cdot in\f$, returns \f$x^T \cdot out\f$
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ApplyDotNonConj(const LocalVector<ValueType>& in,
+                                          const LocalVector<ValueType>& x,
+                                          LocalVector<ValueType>*       out) const;
+        /** \brief Compute the residual and its L2 norm, \f$out = rhs - this \cdot in\f$,
+      * returns \f$\|out\|_2\f$
+      * \details
+      * On the host, the CSR format accumulates the norm in the same pass as the
+      * matrix-vector product.
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ResidualNorm(const LocalVector<ValueType>& rhs,
+                                       const LocalVector<ValueType>& in,
+                                       LocalVector<ValueType>*       out) const;
+
+        /** \brief Compute the (shifted) matrix powers,
+      * \f$out_0 = (this - shift_0 I) in\f$ and \f$out_l = (this - shift_l I) out_{l-1}\f$
+      * \details
+      * On the host, the CSR format uses a cache blocked kernel that computes all powers
+      * block by block, such that the matrix is streamed from memory roughly once instead
+      * of \p k times for matrices with moderate bandwidth. All other formats and backends
+      * apply the matrix \p k times.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   // Monomial Krylov basis [Ax, A^2x, A^3x, A^4x]
+      *   LocalVector<ValueType>* basis[4];
+      *
+      *   // Allocate basis
+      *   // ...
+      *
+      *   mat.MatrixPowers(x, 4, NULL, basis);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        virtual void MatrixPowers(const LocalVector<ValueType>& in,
+                                  int                           k,
+                                  const ValueType*              shift,
+                                  LocalVector<ValueType>**      out) const;
+
         /** \brief Perform symbolic computation (structure only) of \f$|this|^p\f$ */
         ROCALUTION_EXPORT
         void SymbolicPower(int p);
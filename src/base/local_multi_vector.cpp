@@ -0,0 +1,717 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "local_multi_vector.hpp"
+#include "../utils/def.hpp"
+#include "../utils/log.hpp"
+#include "../utils/math_functions.hpp"
+#include "backend_manager.hpp"
+#include "base_vector.hpp"
+
+#include <complex>
+#include <limits>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    // Machine precision of the underlying real type
+    template <typename ValueType>
+    static double multi_vector_eps(ValueType)
+    {
+        return std::numeric_limits<ValueType>::epsilon();
+    }
+
+    template <typename ValueType>
+    static double multi_vector_eps(std::complex<ValueType>)
+    {
+        return std::numeric_limits<ValueType>::epsilon();
+    }
+
+    // Cholesky factorization G = R^H R of the Hermitian positive semi-definite k x k matrix
+    // G, where R is upper triangular. Both are stored column-major. If the pivot of row j
+    // is (numerically) zero relative to G_jj, row j of R is set to zero and dep[j] is set.
+    // Returns the number of non-zero pivots.
+    template <typename ValueType>
+    static int
+        multi_vector_cholesky(int k, const ValueType* G, ValueType* R, std::vector<bool>& dep)
+    {
+        int rank = 0;
+
+        for(int i = 0; i < k * k; ++i)
+        {
+            R[i] = static_cast<ValueType>(0);
+        }
+
+        for(int j = 0; j < k; ++j)
+        {
+            ValueType diag = G[j + j * k];
+
+            for(int i = 0; i < j; ++i)
+            {
+                diag -= rocalution_conj(R[i + j * k]) * R[i + j * k];
+            }
+
+            double d   = static_cast<double>(std::real(diag));
+            double tol = 100.0 * k * multi_vector_eps(G[0]) * std::abs(G[j + j * k]);
+
+            dep[j] = (d <= tol);
+
+            if(dep[j] == true)
+            {
+                continue;
+            }
+
+            ++rank;
+
+            R[j + j * k] = static_cast<ValueType>(sqrt(d));
+
+            for(int c = j + 1; c < k; ++c)
+            {
+                ValueType val = G[j + c * k];
+
+                for(int i = 0; i < j; ++i)
+                {
+                    val -= rocalution_conj(R[i + j * k]) * R[i + c * k];
+                }
+
+                R[j + c * k] = val / R[j + j * k];
+            }
+        }
+
+        return rank;
+    }
+
+    // Inverse of the non-singular upper triangular k x k matrix R, stored column-major
+    template <typename ValueType>
+    static void multi_vector_inverse_upper(int k, const ValueType* R, ValueType* Rinv)
+    {
+        for(int c = 0; c < k; ++c)
+        {
+            for(int i = k - 1; i > c; --i)
+            {
+                Rinv[i + c * k] = static_cast<ValueType>(0);
+            }
+
+            for(int i = c; i >= 0; --i)
+            {
+                ValueType sum = (i == c) ? static_cast<ValueType>(1) : static_cast<ValueType>(0);
+
+                for(int j = i + 1; j <= c; ++j)
+                {
+                    sum -= R[i + j * k] * Rinv[j + c * k];
+                }
+
+                Rinv[i + c * k] = sum / R[i + i * k];
+            }
+        }
+    }
+
+    template <typename ValueType>
+    LocalMultiVector<ValueType>::LocalMultiVector()
+    {
+        log_debug(this, "LocalMultiVector::LocalMultiVector()");
+
+        this->object_name_ = "";
+        this->num_vectors_ = 0;
+    }
+
+    template <typename ValueType>
+    LocalMultiVector<ValueType>::~LocalMultiVector()
+    {
+        log_debug(this, "LocalMultiVector::~LocalMultiVector()");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    bool LocalMultiVector<ValueType>::is_host_(void) const
+    {
+        return this->data_.is_host_();
+    }
+
+    template <typename ValueType>
+    bool LocalMultiVector<ValueType>::is_accel_(void) const
+    {
+        return this->data_.is_accel_();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::MoveToAccelerator(void)
+    {
+        log_debug(this, "LocalMultiVector::MoveToAccelerator()");
+
+        this->data_.MoveToAccelerator();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::MoveToAcceleratorAsync(void)
+    {
+        log_debug(this, "LocalMultiVector::MoveToAcceleratorAsync()");
+
+        this->data_.MoveToAcceleratorAsync();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::MoveToHost(void)
+    {
+        log_debug(this, "LocalMultiVector::MoveToHost()");
+
+        this->data_.MoveToHost();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::MoveToHostAsync(void)
+    {
+        log_debug(this, "LocalMultiVector::MoveToHostAsync()");
+
+        this->data_.MoveToHostAsync();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Sync(void)
+    {
+        log_debug(this, "LocalMultiVector::Sync()");
+
+        this->data_.Sync();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Info(void) const
+    {
+        std::string current_backend_name;
+
+        if(this->is_host_() == true)
+        {
+            current_backend_name = _rocalution_host_name[0];
+        }
+        else
+        {
+            current_backend_name = _rocalution_backend_name[this->local_backend_.backend];
+        }
+
+        LOG_INFO("LocalMultiVector"
+                 << " name=" << this->object_name_ << ";"
+                 << " size=" << this->GetSize() << ";"
+                 << " vectors=" << this->num_vectors_ << ";"
+                 << " prec=" << 8 * sizeof(ValueType) << "bit;"
+                 << " host backend={" << _rocalution_host_name[0] << "};"
+                 << " accelerator backend={"
+                 << _rocalution_backend_name[this->local_backend_.backend] << "};"
+                 << " current=" << current_backend_name);
+    }
+
+    template <typename ValueType>
+    size_t LocalMultiVector<ValueType>::GetMemoryUsage(void) const
+    {
+        return this->data_.GetMemoryUsage();
+    }
+
+    template <typename ValueType>
+    IndexType2 LocalMultiVector<ValueType>::GetSize(void) const
+    {
+        if(this->num_vectors_ == 0)
+        {
+            return 0;
+        }
+
+        return this->data_.GetSize() / this->num_vectors_;
+    }
+
+    template <typename ValueType>
+    int LocalMultiVector<ValueType>::GetNumVectors(void) const
+    {
+        return this->num_vectors_;
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Allocate(std::string name, IndexType2 size, int num_vectors)
+    {
+        log_debug(this, "LocalMultiVector::Allocate()", name, size, num_vectors);
+
+        assert(size >= 0);
+        assert(num_vectors > 0);
+        assert(size * num_vectors <= std::numeric_limits<int>::max());
+
+        this->Clear();
+
+        this->object_name_ = name;
+        this->num_vectors_ = num_vectors;
+
+        this->data_.Allocate(name, size * num_vectors);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Clear(void)
+    {
+        log_debug(this, "LocalMultiVector::Clear()");
+
+        this->data_.Clear();
+        this->num_vectors_ = 0;
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Zeros(void)
+    {
+        log_debug(this, "LocalMultiVector::Zeros()");
+
+        this->data_.Zeros();
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::SetValues(ValueType val)
+    {
+        log_debug(this, "LocalMultiVector::SetValues()", val);
+
+        this->data_.SetValues(val);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::CopyFrom(const LocalMultiVector<ValueType>& src)
+    {
+        log_debug(this, "LocalMultiVector::CopyFrom()", (const void*&)src);
+
+        assert(this != &src);
+
+        if(this->GetSize() != src.GetSize() || this->num_vectors_ != src.num_vectors_)
+        {
+            this->Allocate(src.object_name_, src.GetSize(), src.num_vectors_);
+        }
+
+        this->data_.CopyFrom(src.data_);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::CopyFromVector(int index, const LocalVector<ValueType>& vec)
+    {
+        log_debug(this, "LocalMultiVector::CopyFromVector()", index, (const void*&)vec);
+
+        assert(index >= 0 && index < this->num_vectors_);
+        assert(vec.GetSize() == this->GetSize());
+        assert(vec.is_host_() == this->is_host_());
+
+        if(this->GetSize() > 0)
+        {
+            int  k   = this->num_vectors_;
+            bool err = vec.vector_->CopyToInterleaved(this->data_.vector_, k, index);
+
+            if((err == false) && (this->is_host_() == true))
+            {
+                LOG_INFO("Computation of LocalMultiVector::CopyFromVector() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalVector<ValueType> vec_host;
+                vec_host.CopyFrom(vec);
+                vec_host.MoveToHost();
+
+                this->MoveToHost();
+
+                if(vec_host.vector_->CopyToInterleaved(this->data_.vector_, k, index) == false)
+                {
+                    LOG_INFO("Computation of LocalMultiVector::CopyFromVector() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                LOG_VERBOSE_INFO(
+                    2, "*** warning: LocalMultiVector::CopyFromVector() is performed on the host");
+
+                this->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::CopyToVector(int index, LocalVector<ValueType>* vec) const
+    {
+        log_debug(this, "LocalMultiVector::CopyToVector()", index, vec);
+
+        assert(vec != NULL);
+        assert(index >= 0 && index < this->num_vectors_);
+        assert(vec->is_host_() == this->is_host_());
+
+        if(vec->GetSize() != this->GetSize())
+        {
+            vec->Allocate(this->object_name_, this->GetSize());
+        }
+
+        if(this->GetSize() > 0)
+        {
+            int  k   = this->num_vectors_;
+            bool err = vec->vector_->CopyFromInterleaved(*this->data_.vector_, k, index);
+
+            if((err == false) && (this->is_host_() == true))
+            {
+                LOG_INFO("Computation of LocalMultiVector::CopyToVector() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalVector<ValueType> data_host;
+                data_host.CopyFrom(this->data_);
+                data_host.MoveToHost();
+
+                vec->MoveToHost();
+
+                if(vec->vector_->CopyFromInterleaved(*data_host.vector_, k, index) == false)
+                {
+                    LOG_INFO("Computation of LocalMultiVector::CopyToVector() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                LOG_VERBOSE_INFO(
+                    2, "*** warning: LocalMultiVector::CopyToVector() is performed on the host");
+
+                vec->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Dot(const LocalMultiVector<ValueType>& x,
+                                          ValueType*                         result) const
+    {
+        log_debug(this, "LocalMultiVector::Dot()", (const void*&)x, result);
+
+        assert(result != NULL);
+        assert(this->num_vectors_ > 0);
+        assert(this->num_vectors_ == x.num_vectors_);
+        assert(this->GetSize() == x.GetSize());
+        assert(this->is_host_() == x.is_host_());
+
+        int  k   = this->num_vectors_;
+        bool err = this->data_.vector_->BlockDot(*x.data_.vector_, k, result);
+
+        if((err == false) && (this->is_host_() == true))
+        {
+            LOG_INFO("Computation of LocalMultiVector::Dot() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMultiVector<ValueType> this_host;
+            LocalMultiVector<ValueType> x_host;
+            this_host.CopyFrom(*this);
+            x_host.CopyFrom(x);
+            this_host.MoveToHost();
+            x_host.MoveToHost();
+
+            if(this_host.data_.vector_->BlockDot(*x_host.data_.vector_, k, result) == false)
+            {
+                LOG_INFO("Computation of LocalMultiVector::Dot() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            LOG_VERBOSE_INFO(2, "*** warning: LocalMultiVector::Dot() is performed on the host");
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::AddScale(const LocalMultiVector<ValueType>& x,
+                                               const ValueType*                   scale)
+    {
+        log_debug(this, "LocalMultiVector::AddScale()", (const void*&)x, scale);
+
+        assert(scale != NULL);
+        assert(this->num_vectors_ > 0);
+        assert(this->num_vectors_ == x.num_vectors_);
+        assert(this->GetSize() == x.GetSize());
+        assert(this->is_host_() == x.is_host_());
+
+        int  k   = this->num_vectors_;
+        bool err = this->data_.vector_->BlockAddScale(*x.data_.vector_, k, scale);
+
+        if((err == false) && (this->is_host_() == true))
+        {
+            LOG_INFO("Computation of LocalMultiVector::AddScale() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMultiVector<ValueType> x_host;
+            x_host.CopyFrom(x);
+            x_host.MoveToHost();
+
+            this->MoveToHost();
+
+            if(this->data_.vector_->BlockAddScale(*x_host.data_.vector_, k, scale) == false)
+            {
+                LOG_INFO("Computation of LocalMultiVector::AddScale() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            LOG_VERBOSE_INFO(2,
+                             "*** warning: LocalMultiVector::AddScale() is performed on the host");
+
+            this->MoveToAccelerator();
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::AddScale(const LocalMultiVector<ValueType>& x,
+                                               ValueType                          alpha)
+    {
+        log_debug(this, "LocalMultiVector::AddScale()", (const void*&)x, alpha);
+
+        assert(this->num_vectors_ == x.num_vectors_);
+        assert(this->GetSize() == x.GetSize());
+
+        this->data_.AddScale(x.data_, alpha);
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::ScaleAdd(const ValueType*                   scale,
+                                               const LocalMultiVector<ValueType>& x)
+    {
+        log_debug(this, "LocalMultiVector::ScaleAdd()", scale, (const void*&)x);
+
+        assert(scale != NULL);
+        assert(this->num_vectors_ > 0);
+        assert(this->num_vectors_ == x.num_vectors_);
+        assert(this->GetSize() == x.GetSize());
+        assert(this->is_host_() == x.is_host_());
+
+        int  k   = this->num_vectors_;
+        bool err = this->data_.vector_->BlockScaleAdd(scale, *x.data_.vector_, k);
+
+        if((err == false) && (this->is_host_() == true))
+        {
+            LOG_INFO("Computation of LocalMultiVector::ScaleAdd() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            LocalMultiVector<ValueType> x_host;
+            x_host.CopyFrom(x);
+            x_host.MoveToHost();
+
+            this->MoveToHost();
+
+            if(this->data_.vector_->BlockScaleAdd(scale, *x_host.data_.vector_, k) == false)
+            {
+                LOG_INFO("Computation of LocalMultiVector::ScaleAdd() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            LOG_VERBOSE_INFO(2,
+                             "*** warning: LocalMultiVector::ScaleAdd() is performed on the host");
+
+            this->MoveToAccelerator();
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMultiVector<ValueType>::Scale(const ValueType* scale)
+    {
+        log_debug(this, "LocalMultiVector::Scale()", scale);
+
+        assert(scale != NULL);
+        assert(this->num_vectors_ > 0);
+
+        int  k   = this->num_vectors_;
+        bool err = this->data_.vector_->BlockScale(scale, k);
+
+        if((err == false) && (this->is_host_() == true))
+        {
+            LOG_INFO("Computation of LocalMultiVector::Scale() failed");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(err == false)
+        {
+            this->MoveToHost();
+
+            if(this->data_.vector_->BlockScale(scale, k) == false)
+            {
+                LOG_INFO("Computation of LocalMultiVector::Scale() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            LOG_VERBOSE_INFO(2, "*** warning: LocalMultiVector::Scale() is performed on the host");
+
+            this->MoveToAccelerator();
+        }
+    }
+
+    template <typename ValueType>
+    int LocalMultiVector<ValueType>::Orthonormalize(ValueType* R, unsigned long long seed)
+    {
+        log_debug(this, "LocalMultiVector::Orthonormalize()", R, seed);
+
+        assert(R != NULL);
+        assert(this->num_vectors_ > 0);
+
+        int k = this->num_vectors_;
+
+        std::vector<ValueType> G(k * k);
+        std::vector<ValueType> S(k * k);
+        std::vector<ValueType> Sinv(k * k);
+        std::vector<bool>      dep(k);
+
+        // First Cholesky-QR pass, this^H this = R^H R, which also detects linearly
+        // dependent vectors
+        this->Dot(*this, &G[0]);
+        int rank = multi_vector_cholesky(k, &G[0], R, dep);
+
+        if(rank == k)
+        {
+            // this = this R^-1
+            multi_vector_inverse_upper(k, R, &Sinv[0]);
+            this->Scale(&Sinv[0]);
+
+            // Second Cholesky-QR pass
+            this->Dot(*this, &G[0]);
+
+            int rank2 = multi_vector_cholesky(k, &G[0], &S[0], dep);
+
+            if(rank2 < k)
+            {
+                // The vectors are too ill-conditioned for Cholesky-QR, restore them and
+                // treat the vectors detected in the second pass as linearly dependent
+                this->Scale(R);
+                rank = rank2;
+            }
+        }
+
+        if(rank == k)
+        {
+            multi_vector_inverse_upper(k, &S[0], &Sinv[0]);
+            this->Scale(&Sinv[0]);
+
+            // R = S R
+            for(int c = 0; c < k; ++c)
+            {
+                for(int i = 0; i <= c; ++i)
+                {
+                    ValueType sum = static_cast<ValueType>(0);
+
+                    for(int j = i; j <= c; ++j)
+                    {
+                        sum += S[i + j * k] * R[j + c * k];
+                    }
+
+                    G[i + c * k] = sum;
+                }
+            }
+
+            for(int c = 0; c < k; ++c)
+            {
+                for(int i = 0; i <= c; ++i)
+                {
+                    R[i + c * k] = G[i + c * k];
+                }
+            }
+
+            return rank;
+        }
+
+        // Replace the linearly dependent vectors by random vectors
+        LocalMultiVector<ValueType> orig;
+        orig.CloneBackend(*this);
+        orig.CopyFrom(*this);
+
+        LocalVector<ValueType> rnd;
+        rnd.CloneBackend(this->data_);
+        rnd.Allocate("random", this->GetSize());
+
+        // Cholesky-QR, applied twice. If the vectors are still too ill-conditioned,
+        // further vectors are replaced and the orthonormalization starts over
+        std::vector<bool> replaced(k, false);
+
+        rank     = k;
+        int pass = 0;
+        while(pass < 2)
+        {
+            if(rank < 0)
+            {
+                return -1;
+            }
+
+            for(int j = 0; j < k; ++j)
+            {
+                if(dep[j] == true && replaced[j] == false)
+                {
+                    rnd.SetRandomUniform(seed + j, -1.0, 1.0);
+                    this->CopyFromVector(j, rnd);
+
+                    replaced[j] = true;
+                    --rank;
+                }
+            }
+
+            this->Dot(*this, &G[0]);
+
+            if(multi_vector_cholesky(k, &G[0], &S[0], dep) < k)
+            {
+                // Random vectors that are dependent indicate a breakdown
+                for(int j = 0; j < k; ++j)
+                {
+                    if(dep[j] == true && replaced[j] == true)
+                    {
+                        rank = -1;
+                    }
+                }
+
+                pass = 0;
+                continue;
+            }
+
+            multi_vector_inverse_upper(k, &S[0], &Sinv[0]);
+            this->Scale(&Sinv[0]);
+
+            ++pass;
+        }
+
+        // R = this^H orig
+        this->Dot(orig, R);
+
+        return rank;
+    }
+
+    template class LocalMultiVector<double>;
+    template class LocalMultiVector<float>;
+#ifdef SUPPORT_COMPLEX
+    template class LocalMultiVector<std::complex<double>>;
+    template class LocalMultiVector<std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_LOCAL_MULTI_VECTOR_HPP_
+#define ROCALUTION_LOCAL_MULTI_VECTOR_HPP_
+
+#include "../utils/types.hpp"
+#include "base_rocalution.hpp"
+#include "local_vector.hpp"
+#include "rocalution/export.hpp"
+
+#include <string>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    class LocalMatrix;
+
+    /** \ingroup op_vec_module
+  * \class LocalMultiVector
+  * \brief LocalMultiVector class
+  * \details
+  * A LocalMultiVector holds a fixed number of vectors of the same size, e.g. a set of
+  * right-hand sides. The vectors are stored interleaved (row-major), i.e. element \p i
+  * of vector \p j is stored at position \p i * \p num_vectors + \p j. This allows
+  * sparse matrix - multi-vector products (see LocalMatrix::Apply()) that read the
+  * matrix only once for all vectors.
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> and
+  *                     std::complex<double>
+  */
+    template <typename ValueType>
+    class LocalMultiVector : public BaseRocalution<ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        LocalMultiVector();
+        ROCALUTION_EXPORT
+        virtual ~LocalMultiVector();
+
+        ROCALUTION_EXPORT
+        virtual void MoveToAccelerator(void);
+        ROCALUTION_EXPORT
+        virtual void MoveToAcceleratorAsync(void);
+        ROCALUTION_EXPORT
+        virtual void MoveToHost(void);
+        ROCALUTION_EXPORT
+        virtual void MoveToHostAsync(void);
+        ROCALUTION_EXPORT
+        virtual void Sync(void);
+
+        ROCALUTION_EXPORT
+        virtual void Info(void) const;
+        ROCALUTION_EXPORT
+        virtual size_t GetMemoryUsage(void) const;
+
+        /** \brief Return the size of each vector */
+        ROCALUTION_EXPORT
+        IndexType2 GetSize(void) const;
+        /** \brief Return the number of vectors */
+        ROCALUTION_EXPORT
+        int GetNumVectors(void) const;
+
+        /** \brief Allocate a local multi-vector with name, size and number of vectors
+      * \details
+      * @param[in]
+      * name        object name
+      * @param[in]
+      * size        number of elements of each vector
+      * @param[in]
+      * num_vectors number of vectors
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalMultiVector<ValueType> X;
+      *
+      *   // 16 right-hand sides of size 1000
+      *   X.Allocate("rhs", 1000, 16);
+      *   X.Clear();
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void Allocate(std::string name, IndexType2 size, int num_vectors);
+
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+        /** \brief Set all entries to zero */
+        ROCALUTION_EXPORT
+        void Zeros(void);
+        /** \brief Set all entries to \p val */
+        ROCALUTION_EXPORT
+        void SetValues(ValueType val);
+
+        /** \brief Copy the structure and values of another multi-vector */
+        ROCALUTION_EXPORT
+        void CopyFrom(const LocalMultiVector<ValueType>& src);
+
+        /** \brief Copy \p vec into the vector with index \p index
+      * \details
+      * @param[in]
+      * index   index of the vector, 0 <= \p index < GetNumVectors()
+      * @param[in]
+      * vec     vector of size GetSize()
+      */
+        ROCALUTION_EXPORT
+        void CopyFromVector(int index, const LocalVector<ValueType>& vec);
+        /** \brief Copy the vector with index \p index into \p vec
+      * \details
+      * @param[in]
+      * index   index of the vector, 0 <= \p index < GetNumVectors()
+      * @param[out]
+      * vec     vector of size GetSize()
+      */
+        ROCALUTION_EXPORT
+        void CopyToVector(int index, LocalVector<ValueType>* vec) const;
+
+        /** \brief Compute the block dot product with another multi-vector
+      * \details
+      * Computes all pairwise dot products \f$C = this^{H} x\f$ of the vectors of \p this
+      * and \p x. Both multi-vectors need to have the same size and number of vectors \p k.
+      * @param[in]
+      * x       multi-vector with \p k vectors
+      * @param[out]
+      * result  \p k x \p k matrix in column-major order, allocated by the caller, with
+      *         \p result[i + j * k] = \f$this_{i}^{H} x_{j}\f$
+      */
+        ROCALUTION_EXPORT
+        void Dot(const LocalMultiVector<ValueType>& x, ValueType* result) const;
+        /** \brief Perform multi-vector update of type this = this + x * scale
+      * \details
+      * @param[in]
+      * x       multi-vector with \p k vectors
+      * @param[in]
+      * scale   \p k x \p k matrix in column-major order
+      */
+        ROCALUTION_EXPORT
+        void AddScale(const LocalMultiVector<ValueType>& x, const ValueType* scale);
+        /** \brief Perform multi-vector update of type this = this + alpha * x */
+        ROCALUTION_EXPORT
+        void AddScale(const LocalMultiVector<ValueType>& x, ValueType alpha);
+        /** \brief Perform multi-vector update of type this = this * scale + x
+      * \details
+      * @param[in]
+      * scale   \p k x \p k matrix in column-major order
+      * @param[in]
+      * x       multi-vector with \p k vectors
+      */
+        ROCALUTION_EXPORT
+        void ScaleAdd(const ValueType* scale, const LocalMultiVector<ValueType>& x);
+        /** \brief Perform multi-vector update of type this = this * scale
+      * \details
+      * @param[in]
+      * scale   \p k x \p k matrix in column-major order
+      */
+        ROCALUTION_EXPORT
+        void Scale(const ValueType* scale);
+
+        /** \brief Orthonormalize the vectors
+      * \details
+      * Computes the QR factorization \f$this = QR\f$ using the Cholesky-QR algorithm,
+      * applied twice for stability, and overwrites \p this with \f$Q\f$. Vectors that
+      * are (numerically) linearly dependent on the previous ones are replaced by random
+      * vectors, such that \f$Q\f$ always has \p k orthonormal columns. \f$R\f$ is then
+      * given by \f$Q^{H}\f$ times the original vectors.
+      * @param[out]
+      * R       \p k x \p k matrix in column-major order, allocated by the caller
+      * @param[in]
+      * seed    seed of the random vectors
+      *
+      * \returns    number of linearly independent vectors, or -1 if the
+      *             orthonormalization failed
+      */
+        ROCALUTION_EXPORT
+        int Orthonormalize(ValueType* R, unsigned long long seed = 1234ULL);
+
+    protected:
+        virtual bool is_host_(void) const;
+        virtual bool is_accel_(void) const;
+
+    private:
+        // Interleaved storage of all vectors
+        LocalVector<ValueType> data_;
+
+        // Number of vectors
+        int num_vectors_;
+
+        friend class LocalMatrix<ValueType>;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_LOCAL_MULTI_VECTOR_HPP_
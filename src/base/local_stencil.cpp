@@ -98,6 +98,13 @@ namespace rocalution
         this->stencil_->Info();
     }
 
+    template <typename ValueType>
+    size_t LocalStencil<ValueType>::GetMemoryUsage(void) const
+    {
+        // Stencils are matrix-free
+        return 0;
+    }
+
     template <typename ValueType>
     void LocalStencil<ValueType>::Clear(void)
     {
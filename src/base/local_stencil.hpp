@@ -70,6 +70,8 @@ namespace rocalution
 
         ROCALUTION_EXPORT
         virtual void Info() const;
+        ROCALUTION_EXPORT
+        virtual size_t GetMemoryUsage(void) const;
 
         /** \brief Return the dimension of the stencil */
         ROCALUTION_EXPORT
@@ -34,6 +34,7 @@
 #include <complex>
 #include <sstream>
 #include <stdlib.h>
+#include <vector>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -86,6 +87,19 @@ namespace rocalution
     {
         log_debug(this, "LocalVector::Allocate()", name, size);
 
+        this->AllocateUninitialized(name, size);
+
+        if(size > 0)
+        {
+            this->vector_->Zeros();
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::AllocateUninitialized(std::string name, IndexType2 size)
+    {
+        log_debug(this, "LocalVector::AllocateUninitialized()", name, size);
+
         assert(size <= std::numeric_limits<int>::max());
         assert(size >= 0);
 
@@ -102,7 +116,7 @@ namespace rocalution
 
                 this->vector_host_ = new HostVector<ValueType>(backend);
                 assert(this->vector_host_ != NULL);
-                this->vector_host_->Allocate(IndexTypeToInt(size));
+                this->vector_host_->AllocateUninitialized(IndexTypeToInt(size));
                 this->vector_ = this->vector_host_;
             }
             else
@@ -114,7 +128,7 @@ namespace rocalution
 
                 this->vector_accel_ = _rocalution_init_base_backend_vector<ValueType>(backend);
                 assert(this->vector_accel_ != NULL);
-                this->vector_accel_->Allocate(IndexTypeToInt(size));
+                this->vector_accel_->AllocateUninitialized(IndexTypeToInt(size));
                 this->vector_ = this->vector_accel_;
             }
         }
@@ -509,6 +523,12 @@ namespace rocalution
                  << " current=" << current_backend_name);
     }
 
+    template <typename ValueType>
+    size_t LocalVector<ValueType>::GetMemoryUsage(void) const
+    {
+        return this->vector_->GetMemoryUsage();
+    }
+
     template <typename ValueType>
     void LocalVector<ValueType>::ReadFileASCII(const std::string& filename)
     {
@@ -744,6 +764,204 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalVector<ValueType>::FusedDot(int                                  num,
+                                          const LocalVector<ValueType>* const* x,
+                                          const LocalVector<ValueType>* const* y,
+                                          ValueType*                           result) const
+    {
+        log_debug(this, "LocalVector::FusedDot()", num, x, y, result);
+
+        assert(num > 0);
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(result != NULL);
+
+        std::vector<const BaseVector<ValueType>*> vec_x(num);
+        std::vector<const BaseVector<ValueType>*> vec_y(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            assert(x[j] != NULL);
+            assert(y[j] != NULL);
+            assert(x[j]->GetSize() == this->GetSize());
+            assert(y[j]->GetSize() == this->GetSize());
+            assert(x[j]->is_host_() == this->is_host_());
+            assert(y[j]->is_host_() == this->is_host_());
+
+            vec_x[j] = x[j]->vector_;
+            vec_y[j] = y[j]->vector_;
+
+            result[j] = static_cast<ValueType>(0);
+        }
+
+        if(this->GetSize() > 0)
+        {
+            bool err = this->vector_->FusedDot(num, &vec_x[0], &vec_y[0], result);
+
+            // Fall back to separate dot products, if the backend does not provide a fused
+            // kernel
+            if(err == false)
+            {
+                for(int j = 0; j < num; ++j)
+                {
+                    result[j] = vec_x[j]->Dot(*vec_y[j]);
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::FusedDotAsync(int                                  num,
+                                               const LocalVector<ValueType>* const* x,
+                                               const LocalVector<ValueType>* const* y,
+                                               ValueType*                           result) const
+    {
+        log_debug(this, "LocalVector::FusedDotAsync()", num, x, y, result);
+
+        // There is no global reduction, the results are available immediately
+        this->FusedDot(num, x, y, result);
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::MultiDot(int                                  num,
+                                          const LocalVector<ValueType>* const* x,
+                                          ValueType*                           result) const
+    {
+        log_debug(this, "LocalVector::MultiDot()", num, x, result);
+
+        assert(num > 0);
+        assert(x != NULL);
+        assert(result != NULL);
+
+        std::vector<const BaseVector<ValueType>*> vec_x(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            assert(x[j] != NULL);
+            assert(x[j]->GetSize() == this->GetSize());
+            assert(x[j]->is_host_() == this->is_host_());
+
+            vec_x[j] = x[j]->vector_;
+
+            result[j] = static_cast<ValueType>(0);
+        }
+
+        if(this->GetSize() > 0)
+        {
+            bool err = this->vector_->MultiDot(num, &vec_x[0], result);
+
+            // Fall back to separate dot products, if the backend does not provide a fused
+            // kernel
+            if(err == false)
+            {
+                for(int j = 0; j < num; ++j)
+                {
+                    result[j] = vec_x[j]->Dot(*this->vector_);
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::MultiAXPY(int                                  num,
+                                           const ValueType*                     alpha,
+                                           const LocalVector<ValueType>* const* x)
+    {
+        log_debug(this, "LocalVector::MultiAXPY()", num, alpha, x);
+
+        assert(num > 0);
+        assert(alpha != NULL);
+        assert(x != NULL);
+
+        std::vector<const BaseVector<ValueType>*> vec_x(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            assert(x[j] != NULL);
+            assert(x[j]->GetSize() == this->GetSize());
+            assert(x[j]->is_host_() == this->is_host_());
+
+            vec_x[j] = x[j]->vector_;
+        }
+
+        if(this->GetSize() > 0)
+        {
+            bool err = this->vector_->MultiAXPY(num, alpha, &vec_x[0]);
+
+            // Fall back to separate updates, if the backend does not provide a fused kernel
+            if(err == false)
+            {
+                for(int j = 0; j < num; ++j)
+                {
+                    this->vector_->AddScale(*vec_x[j], alpha[j]);
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::LinearCombination(int                                  num,
+                                                   const ValueType*                     alpha,
+                                                   const LocalVector<ValueType>* const* x)
+    {
+        log_debug(this, "LocalVector::LinearCombination()", num, alpha, x);
+
+        assert(num > 0);
+        assert(alpha != NULL);
+        assert(x != NULL);
+
+        std::vector<const BaseVector<ValueType>*> vec_x(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            assert(x[j] != NULL);
+            assert(x[j]->GetSize() == this->GetSize());
+            assert(x[j]->is_host_() == this->is_host_());
+
+            vec_x[j] = x[j]->vector_;
+        }
+
+        if(this->GetSize() > 0)
+        {
+            bool err = this->vector_->LinearCombination(num, alpha, &vec_x[0]);
+
+            // Fall back to separate updates, if the backend does not provide a fused kernel
+            if(err == false)
+            {
+                // Terms containing this vector have to be processed first
+                bool      alias = false;
+                ValueType self  = static_cast<ValueType>(0);
+
+                for(int j = 0; j < num; ++j)
+                {
+                    if(x[j] == this)
+                    {
+                        alias = true;
+                        self += alpha[j];
+                    }
+                }
+
+                if(alias == true)
+                {
+                    this->vector_->Scale(self);
+                }
+                else
+                {
+                    this->vector_->Zeros();
+                }
+
+                for(int j = 0; j < num; ++j)
+                {
+                    if(x[j] != this)
+                    {
+                        this->vector_->AddScale(*vec_x[j], alpha[j]);
+                    }
+                }
+            }
+        }
+    }
+
     template <typename ValueType>
     ValueType LocalVector<ValueType>::Norm(void) const
     {
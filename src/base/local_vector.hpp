@@ -25,6 +25,7 @@
 #define ROCALUTION_LOCAL_VECTOR_HPP_
 
 #include "../utils/types.hpp"
+#include "local_vector_expression.hpp"
 #include "rocalution/export.hpp"
 #include "vector.hpp"
 
@@ -44,6 +45,9 @@ namespace rocalution
     template <typename ValueType>
     class LocalStencil;
 
+    template <typename ValueType>
+    class LocalMultiVector;
+
     /** \ingroup op_vec_module
   * \class LocalVector
   * \brief LocalVector class
@@ -78,6 +82,8 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Info(void) const;
         ROCALUTION_EXPORT
+        virtual size_t GetMemoryUsage(void) const;
+        ROCALUTION_EXPORT
         virtual IndexType2 GetSize(void) const;
 
         /** \private */
@@ -111,6 +117,31 @@ namespace rocalution
         ROCALUTION_EXPORT
         void Allocate(std::string name, IndexType2 size);
 
+        /** \brief Allocate a local vector with name and size, without initialization
+      * \details
+      * Same as Allocate(), but the values of the vector are not set to zero. This saves
+      * a full pass over the memory, if all values are overwritten afterwards anyway, e.g.
+      * by CopyFrom() or as the output of a matrix-vector product.
+      *
+      * \note
+      * The values of the vector are undefined until they are written.
+      *
+      * @param[in]
+      * name    object name
+      * @param[in]
+      * size    number of elements in the vector
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalVector<ValueType> vec;
+      *
+      *   vec.AllocateUninitialized("my vector", mat.GetM());
+      *   mat.Apply(x, &vec);
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void AllocateUninitialized(std::string name, IndexType2 size);
+
         /** \brief Initialize a LocalVector on the host with externally allocated data
       * \details
       * \p SetDataPtr has direct access to the raw data via pointers. Already allocated
@@ -316,6 +347,67 @@ namespace rocalution
         virtual ValueType Dot(const LocalVector<ValueType>& x) const;
         ROCALUTION_EXPORT
         virtual ValueType DotNonConj(const LocalVector<ValueType>& x) const;
+        ROCALUTION_EXPORT
+        virtual void FusedDot(int                                  num,
+                              const LocalVector<ValueType>* const* x,
+                              const LocalVector<ValueType>* const* y,
+                              ValueType*                           result) const;
+        ROCALUTION_EXPORT
+        virtual void FusedDotAsync(int                                  num,
+                                   const LocalVector<ValueType>* const* x,
+                                   const LocalVector<ValueType>* const* y,
+                                   ValueType*                           result) const;
+        ROCALUTION_EXPORT
+        virtual void MultiDot(int                                  num,
+                              const LocalVector<ValueType>* const* x,
+                              ValueType*                           result) const;
+        ROCALUTION_EXPORT
+        virtual void MultiAXPY(int                                  num,
+                               const ValueType*                     alpha,
+                               const LocalVector<ValueType>* const* x);
+        /** \brief Perform vector update of type this = sum(alpha[i] * x[i]) in a single
+      * pass, this vector can be one of the x[i]
+      */
+        ROCALUTION_EXPORT
+        void LinearCombination(int                                  num,
+                               const ValueType*                     alpha,
+                               const LocalVector<ValueType>* const* x);
+
+        /** \brief Evaluate a LocalVectorExpression in a single pass
+      * \details
+      * The expression is evaluated by LinearCombination(), e.g.
+      * \code{.cpp}
+      *   x = 2.0 * y - z + 0.5 * w;
+      * \endcode
+      */
+        template <int N>
+        LocalVector<ValueType>& operator=(const LocalVectorExpression<ValueType, N>& expr)
+        {
+            this->LinearCombination(N, expr.alpha, expr.x);
+
+            return *this;
+        }
+
+        /** \brief Add a LocalVectorExpression in a single pass, using MultiAXPY() */
+        template <int N>
+        LocalVector<ValueType>& operator+=(const LocalVectorExpression<ValueType, N>& expr)
+        {
+            this->MultiAXPY(N, expr.alpha, expr.x);
+
+            return *this;
+        }
+
+        /** \brief Subtract a LocalVectorExpression in a single pass, using MultiAXPY() */
+        template <int N>
+        LocalVector<ValueType>& operator-=(const LocalVectorExpression<ValueType, N>& expr)
+        {
+            LocalVectorExpression<ValueType, N> neg = -expr;
+
+            this->MultiAXPY(N, neg.alpha, neg.x);
+
+            return *this;
+        }
+
         ROCALUTION_EXPORT
         virtual ValueType Norm(void) const;
         ROCALUTION_EXPORT
@@ -390,6 +482,7 @@ namespace rocalution
         friend class GlobalVector<ValueType>;
         friend class LocalMatrix<ValueType>;
         friend class GlobalMatrix<ValueType>;
+        friend class LocalMultiVector<ValueType>;
     };
 
 } // namespace rocalution
@@ -0,0 +1,215 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_LOCAL_VECTOR_EXPRESSION_HPP_
+#define ROCALUTION_LOCAL_VECTOR_EXPRESSION_HPP_
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    class LocalVector;
+
+    /** \ingroup op_vec_module
+  * \class LocalVectorExpression
+  * \brief Lazy linear combination of LocalVectors
+  * \details
+  * A LocalVectorExpression holds the coefficients and operands of a linear combination
+  * \f$\sum_{i=0}^{N-1} \alpha_{i} x_{i}\f$. It is created by the arithmetic operators of
+  * LocalVector and is not evaluated until it is assigned to a LocalVector. All terms
+  * are then evaluated by LocalVector::LinearCombination() in a single pass over the
+  * data, instead of one pass (and one parallel region) per BLAS-1 operation.
+  *
+  * \code{.cpp}
+  *   LocalVector<ValueType> x, y, z, w;
+  *
+  *   // Single pass, equivalent to x = 2 * y - z + 0.5 * w
+  *   x = 2.0 * y - z + 0.5 * w;
+  *
+  *   // Single pass, x may appear on the right hand side
+  *   x = x + alpha * y;
+  *
+  *   // Single pass using LocalVector::MultiAXPY()
+  *   x += alpha * y + beta * z;
+  * \endcode
+  *
+  * \tparam ValueType - can be int, float, double, std::complex<float> and
+  *                     std::complex<double>
+  * \tparam N         - number of terms
+  */
+    template <typename ValueType, int N>
+    class LocalVectorExpression
+    {
+    public:
+        typedef ValueType value_type;
+
+        /** \brief Coefficients of the terms */
+        ValueType alpha[N];
+        /** \brief Operands of the terms */
+        const LocalVector<ValueType>* x[N];
+    };
+
+    /** \brief Build the expression alpha * x */
+    template <typename ValueType>
+    LocalVectorExpression<ValueType, 1>
+        operator*(typename LocalVectorExpression<ValueType, 1>::value_type alpha,
+                  const LocalVector<ValueType>&                            x)
+    {
+        LocalVectorExpression<ValueType, 1> expr;
+
+        expr.alpha[0] = alpha;
+        expr.x[0]     = &x;
+
+        return expr;
+    }
+
+    /** \brief Build the expression x * alpha */
+    template <typename ValueType>
+    LocalVectorExpression<ValueType, 1>
+        operator*(const LocalVector<ValueType>&                            x,
+                  typename LocalVectorExpression<ValueType, 1>::value_type alpha)
+    {
+        return alpha * x;
+    }
+
+    /** \brief Scale all terms of an expression by alpha */
+    template <typename ValueType, int N>
+    LocalVectorExpression<ValueType, N>
+        operator*(typename LocalVectorExpression<ValueType, N>::value_type alpha,
+                  const LocalVectorExpression<ValueType, N>&               expr)
+    {
+        LocalVectorExpression<ValueType, N> res;
+
+        for(int i = 0; i < N; ++i)
+        {
+            res.alpha[i] = alpha * expr.alpha[i];
+            res.x[i]     = expr.x[i];
+        }
+
+        return res;
+    }
+
+    /** \brief Scale all terms of an expression by alpha */
+    template <typename ValueType, int N>
+    LocalVectorExpression<ValueType, N>
+        operator*(const LocalVectorExpression<ValueType, N>&               expr,
+                  typename LocalVectorExpression<ValueType, N>::value_type alpha)
+    {
+        return alpha * expr;
+    }
+
+    /** \brief Negate all terms of an expression */
+    template <typename ValueType, int N>
+    LocalVectorExpression<ValueType, N> operator-(const LocalVectorExpression<ValueType, N>& expr)
+    {
+        return static_cast<ValueType>(-1) * expr;
+    }
+
+    /** \brief Build the expression -x */
+    template <typename ValueType>
+    LocalVectorExpression<ValueType, 1> operator-(const LocalVector<ValueType>& x)
+    {
+        return static_cast<ValueType>(-1) * x;
+    }
+
+    /** \brief Concatenate the terms of two expressions */
+    template <typename ValueType, int N, int M>
+    LocalVectorExpression<ValueType, N + M> operator+(const LocalVectorExpression<ValueType, N>& a,
+                                                      const LocalVectorExpression<ValueType, M>& b)
+    {
+        LocalVectorExpression<ValueType, N + M> res;
+
+        for(int i = 0; i < N; ++i)
+        {
+            res.alpha[i] = a.alpha[i];
+            res.x[i]     = a.x[i];
+        }
+
+        for(int i = 0; i < M; ++i)
+        {
+            res.alpha[N + i] = b.alpha[i];
+            res.x[N + i]     = b.x[i];
+        }
+
+        return res;
+    }
+
+    /** \brief Concatenate the terms of two expressions, negating the second one */
+    template <typename ValueType, int N, int M>
+    LocalVectorExpression<ValueType, N + M> operator-(const LocalVectorExpression<ValueType, N>& a,
+                                                      const LocalVectorExpression<ValueType, M>& b)
+    {
+        return a + (-b);
+    }
+
+    /** \brief Build the expression a + x */
+    template <typename ValueType, int N>
+    LocalVectorExpression<ValueType, N + 1> operator+(const LocalVectorExpression<ValueType, N>& a,
+                                                      const LocalVector<ValueType>&              x)
+    {
+        return a + static_cast<ValueType>(1) * x;
+    }
+
+    /** \brief Build the expression x + a */
+    template <typename ValueType, int N>
+    LocalVectorExpression<ValueType, N + 1> operator+(const LocalVector<ValueType>&              x,
+                                                      const LocalVectorExpression<ValueType, N>& a)
+    {
+        return static_cast<ValueType>(1) * x + a;
+    }
+
+    /** \brief Build the expression a - x */
+    template <typename ValueType, int N>
+    LocalVectorExpression<ValueType, N + 1> operator-(const LocalVectorExpression<ValueType, N>& a,
+                                                      const LocalVector<ValueType>&              x)
+    {
+        return a + static_cast<ValueType>(-1) * x;
+    }
+
+    /** \brief Build the expression x - a */
+    template <typename ValueType, int N>
+    LocalVectorExpression<ValueType, N + 1> operator-(const LocalVector<ValueType>&              x,
+                                                      const LocalVectorExpression<ValueType, N>& a)
+    {
+        return static_cast<ValueType>(1) * x + (-a);
+    }
+
+    /** \brief Build the expression x + y */
+    template <typename ValueType>
+    LocalVectorExpression<ValueType, 2> operator+(const LocalVector<ValueType>& x,
+                                                  const LocalVector<ValueType>& y)
+    {
+        return static_cast<ValueType>(1) * x + static_cast<ValueType>(1) * y;
+    }
+
+    /** \brief Build the expression x - y */
+    template <typename ValueType>
+    LocalVectorExpression<ValueType, 2> operator-(const LocalVector<ValueType>& x,
+                                                  const LocalVector<ValueType>& y)
+    {
+        return static_cast<ValueType>(1) * x + static_cast<ValueType>(-1) * y;
+    }
+
+} // namespace rocalution
+
+#endif // ROCALUTION_LOCAL_VECTOR_EXPRESSION_HPP_
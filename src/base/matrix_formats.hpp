@@ -30,8 +30,8 @@ namespace rocalution
 {
 
     // Matrix Names
-    const std::string _matrix_format_names[8]
-        = {"DENSE", "CSR", "MCSR", "BCSR", "COO", "DIA", "ELL", "HYB"};
+    const std::string _matrix_format_names[9]
+        = {"DENSE", "CSR", "MCSR", "BCSR", "COO", "DIA", "ELL", "HYB", "SELL"};
 
     // Matrix Enumeration
     enum _matrix_format
@@ -43,7 +43,8 @@ namespace rocalution
         COO   = 4,
         DIA   = 5,
         ELL   = 6,
-        HYB   = 7
+        HYB   = 7,
+        SELL  = 8
     };
 
     // Sparse Matrix - Sparse Compressed Row Format CSR
@@ -139,6 +140,35 @@ namespace rocalution
         ValueType* val;
     };
 
+    // Sparse Matrix - Sliced ELL Format SELL-C-sigma (see SELL_IND for indexing)
+    // Consecutive slices of slice_size rows are stored in ELL format, padded to the longest
+    // row of each slice. Within windows of sigma rows, the rows are sorted by their length.
+    template <typename ValueType, typename IndexType, typename Index = IndexType>
+    struct MatrixSELL
+    {
+        // Number of rows per slice (C)
+        Index slice_size;
+        // Sorting scope (sigma)
+        Index sigma;
+        // Number of slices
+        Index nslice;
+
+        // Slice offsets (slice ptr)
+        IndexType* slice_offset;
+
+        // Original row of each slice row, -1 for padding rows
+        IndexType* perm;
+
+        // Number of non-padding elements of each slice row
+        IndexType* row_length;
+
+        // Column index
+        IndexType* col;
+
+        // Values
+        ValueType* val;
+    };
+
     // Sparse Matrix - Hybrid Format HYB (Contains ELL and COO Matrices)
     template <typename ValueType, typename IndexType, typename Index = IndexType>
     struct MatrixHYB
@@ -138,6 +138,140 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    ValueType Operator<ValueType>::ApplyDot(const LocalVector<ValueType>& in,
+                                            const LocalVector<ValueType>& x,
+                                            LocalVector<ValueType>*       out) const
+    {
+        log_debug(this, "Operator::ApplyDot()", (const void*&)in, (const void*&)x, out);
+
+        assert(out != NULL);
+
+        this->Apply(in, out);
+
+        return x.Dot(*out);
+    }
+
+    template <typename ValueType>
+    ValueType Operator<ValueType>::ApplyDotNonConj(const LocalVector<ValueType>& in,
+                                                   const LocalVector<ValueType>& x,
+                                                   LocalVector<ValueType>*       out) const
+    {
+        log_debug(this, "Operator::ApplyDotNonConj()", (const void*&)in, (const void*&)x, out);
+
+        assert(out != NULL);
+
+        this->Apply(in, out);
+
+        return x.DotNonConj(*out);
+    }
+
+    template <typename ValueType>
+    ValueType Operator<ValueType>::ResidualNorm(const LocalVector<ValueType>& rhs,
+                                                const LocalVector<ValueType>& in,
+                                                LocalVector<ValueType>*       out) const
+    {
+        log_debug(this, "Operator::ResidualNorm()", (const void*&)rhs, (const void*&)in, out);
+
+        assert(out != NULL);
+
+        this->Apply(in, out);
+        out->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        return out->Norm();
+    }
+
+    template <typename ValueType>
+    ValueType Operator<ValueType>::ApplyDot(const GlobalVector<ValueType>& in,
+                                            const GlobalVector<ValueType>& x,
+                                            GlobalVector<ValueType>*       out) const
+    {
+        log_debug(this, "Operator::ApplyDot()", (const void*&)in, (const void*&)x, out);
+
+        assert(out != NULL);
+
+        this->Apply(in, out);
+
+        return x.Dot(*out);
+    }
+
+    template <typename ValueType>
+    ValueType Operator<ValueType>::ApplyDotNonConj(const GlobalVector<ValueType>& in,
+                                                   const GlobalVector<ValueType>& x,
+                                                   GlobalVector<ValueType>*       out) const
+    {
+        log_debug(this, "Operator::ApplyDotNonConj()", (const void*&)in, (const void*&)x, out);
+
+        assert(out != NULL);
+
+        this->Apply(in, out);
+
+        return x.DotNonConj(*out);
+    }
+
+    template <typename ValueType>
+    ValueType Operator<ValueType>::ResidualNorm(const GlobalVector<ValueType>& rhs,
+                                                const GlobalVector<ValueType>& in,
+                                                GlobalVector<ValueType>*       out) const
+    {
+        log_debug(this, "Operator::ResidualNorm()", (const void*&)rhs, (const void*&)in, out);
+
+        assert(out != NULL);
+
+        this->Apply(in, out);
+        out->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        return out->Norm();
+    }
+
+    template <typename ValueType>
+    void Operator<ValueType>::MatrixPowers(const LocalVector<ValueType>& in,
+                                           int                           k,
+                                           const ValueType*              shift,
+                                           LocalVector<ValueType>**      out) const
+    {
+        log_debug(this, "Operator::MatrixPowers()", (const void*&)in, k, shift, out);
+
+        assert(k >= 0);
+        assert((k == 0) || (out != NULL));
+
+        for(int l = 0; l < k; ++l)
+        {
+            const LocalVector<ValueType>* prev = (l == 0) ? &in : out[l - 1];
+
+            this->Apply(*prev, out[l]);
+
+            if(shift != NULL)
+            {
+                out[l]->AddScale(*prev, -shift[l]);
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void Operator<ValueType>::MatrixPowers(const GlobalVector<ValueType>& in,
+                                           int                            k,
+                                           const ValueType*               shift,
+                                           GlobalVector<ValueType>**      out) const
+    {
+        log_debug(this, "Operator::MatrixPowers()", (const void*&)in, k, shift, out);
+
+        assert(k >= 0);
+        assert((k == 0) || (out != NULL));
+
+        for(int l = 0; l < k; ++l)
+        {
+            const GlobalVector<ValueType>* prev = (l == 0) ? &in : out[l - 1];
+
+            this->Apply(*prev, out[l]);
+
+            if(shift != NULL)
+            {
+                out[l]->AddScale(*prev, -shift[l]);
+            }
+        }
+    }
+
     template class Operator<double>;
     template class Operator<float>;
 #ifdef SUPPORT_COMPLEX
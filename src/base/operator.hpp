@@ -113,6 +113,89 @@ namespace rocalution
         virtual void ApplyAdd(const GlobalVector<ValueType>& in,
                               ValueType                      scalar,
                               GlobalVector<ValueType>*       out) const;
+
+        /** \brief Apply the operator and compute a dot product with the result in a single
+      * pass, \f$out = Operator(in)\f$, returns \f$x^H \cdot out\f$, where in, x and out are
+      * local vectors
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ApplyDot(const LocalVector<ValueType>& in,
+                                   const LocalVector<ValueType>& x,
+                                   LocalVector<ValueType>*       out) const;
+        /** \brief Apply the operator and compute a non-conjugated dot product with the result
+      * in a single pass, \f$out = Operator(in)\f$, returns \f$x^T \cdot out\f$, where in,
+      * x and out are local vectors
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ApplyDotNonConj(const LocalVector<ValueType>& in,
+                                          const LocalVector<ValueType>& x,
+                                          LocalVector<ValueType>*       out) const;
+        /** \brief Compute the residual and its L2 norm in a single pass,
+      * \f$out = rhs - Operator(in)\f$, returns \f$\|out\|_2\f$, where rhs, in and out are
+      * local vectors
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ResidualNorm(const LocalVector<ValueType>& rhs,
+                                       const LocalVector<ValueType>& in,
+                                       LocalVector<ValueType>*       out) const;
+
+        /** \brief Apply the operator and compute a dot product with the result,
+      * \f$out = Operator(in)\f$, returns \f$x^H \cdot out\f$, where in, x and out are
+      * global vectors
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ApplyDot(const GlobalVector<ValueType>& in,
+                                   const GlobalVector<ValueType>& x,
+                                   GlobalVector<ValueType>*       out) const;
+        /** \brief Apply the operator and compute a non-conjugated dot product with the
+      * result, \f$out = Operator(in)\f$, returns \f$x^T \cdot out\f$, where in, x and out
+      * are global vectors
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ApplyDotNonConj(const GlobalVector<ValueType>& in,
+                                          const GlobalVector<ValueType>& x,
+                                          GlobalVector<ValueType>*       out) const;
+        /** \brief Compute the residual and its L2 norm, \f$out = rhs - Operator(in)\f$,
+      * returns \f$\|out\|_2\f$, where rhs, in and out are global vectors
+      */
+        ROCALUTION_EXPORT
+        virtual ValueType ResidualNorm(const GlobalVector<ValueType>& rhs,
+                                       const GlobalVector<ValueType>& in,
+                                       GlobalVector<ValueType>*       out) const;
+
+        /** \brief Compute the (shifted) powers of the operator applied to a local vector,
+      * \f$out_0 = (Operator - shift_0 I) in\f$ and
+      * \f$out_l = (Operator - shift_l I) out_{l-1}\f$ for \f$l = 1,\ldots,k-1\f$
+      * \details
+      * Without shifts (\p shift is NULL), the monomial basis
+      * \f$[Operator \cdot in, \ldots, Operator^k \cdot in]\f$ is computed. Shifts can be
+      * used to generate Newton or Chebyshev type bases. The default implementation applies
+      * the operator \p k times.
+      *
+      * @param[in]
+      * in      input vector.
+      * @param[in]
+      * k       number of powers.
+      * @param[in]
+      * shift   array of \p k shifts, or NULL.
+      * @param[out]
+      * out     array of \p k output vectors.
+      */
+        ROCALUTION_EXPORT
+        virtual void MatrixPowers(const LocalVector<ValueType>& in,
+                                  int                           k,
+                                  const ValueType*              shift,
+                                  LocalVector<ValueType>**      out) const;
+
+        /** \brief Compute the (shifted) powers of the operator applied to a global vector,
+      * \f$out_0 = (Operator - shift_0 I) in\f$ and
+      * \f$out_l = (Operator - shift_l I) out_{l-1}\f$ for \f$l = 1,\ldots,k-1\f$
+      */
+        ROCALUTION_EXPORT
+        virtual void MatrixPowers(const GlobalVector<ValueType>& in,
+                                  int                            k,
+                                  const ValueType*               shift,
+                                  GlobalVector<ValueType>**      out) const;
     };
 
 } // namespace rocalution
@@ -264,6 +264,111 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Vector<ValueType>::FusedDot(int                                  num,
+                                     const LocalVector<ValueType>* const* x,
+                                     const LocalVector<ValueType>* const* y,
+                                     ValueType*                           result) const
+    {
+        LOG_INFO("Vector<ValueType>::FusedDot(int num, const LocalVector<ValueType>* const* x, "
+                 "const LocalVector<ValueType>* const* y, ValueType* result) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::FusedDot(int                                   num,
+                                     const GlobalVector<ValueType>* const* x,
+                                     const GlobalVector<ValueType>* const* y,
+                                     ValueType*                            result) const
+    {
+        LOG_INFO("Vector<ValueType>::FusedDot(int num, const GlobalVector<ValueType>* const* x, "
+                 "const GlobalVector<ValueType>* const* y, ValueType* result) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::FusedDotAsync(int                                  num,
+                                          const LocalVector<ValueType>* const* x,
+                                          const LocalVector<ValueType>* const* y,
+                                          ValueType*                           result) const
+    {
+        LOG_INFO("Vector<ValueType>::FusedDotAsync(int num, const LocalVector<ValueType>* const* "
+                 "x, const LocalVector<ValueType>* const* y, ValueType* result) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::FusedDotAsync(int                                   num,
+                                          const GlobalVector<ValueType>* const* x,
+                                          const GlobalVector<ValueType>* const* y,
+                                          ValueType*                            result) const
+    {
+        LOG_INFO("Vector<ValueType>::FusedDotAsync(int num, const GlobalVector<ValueType>* const* "
+                 "x, const GlobalVector<ValueType>* const* y, ValueType* result) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::FusedDotSync(void) const
+    {
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MultiDot(int                                  num,
+                                     const LocalVector<ValueType>* const* x,
+                                     ValueType*                           result) const
+    {
+        LOG_INFO("Vector<ValueType>::MultiDot(int num, const LocalVector<ValueType>* const* x, "
+                 "ValueType* result) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MultiDot(int                                   num,
+                                     const GlobalVector<ValueType>* const* x,
+                                     ValueType*                            result) const
+    {
+        LOG_INFO("Vector<ValueType>::MultiDot(int num, const GlobalVector<ValueType>* const* x, "
+                 "ValueType* result) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MultiAXPY(int                                  num,
+                                      const ValueType*                     alpha,
+                                      const LocalVector<ValueType>* const* x)
+    {
+        LOG_INFO("Vector<ValueType>::MultiAXPY(int num, const ValueType* alpha, "
+                 "const LocalVector<ValueType>* const* x)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MultiAXPY(int                                   num,
+                                      const ValueType*                      alpha,
+                                      const GlobalVector<ValueType>* const* x)
+    {
+        LOG_INFO("Vector<ValueType>::MultiAXPY(int num, const ValueType* alpha, "
+                 "const GlobalVector<ValueType>* const* x)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     void Vector<ValueType>::PointWiseMult(const LocalVector<ValueType>& x)
     {
@@ -343,6 +343,21 @@ namespace rocalution
                                const GlobalVector<ValueType>& y,
                                ValueType                      gamma);
 
+        /** \brief Perform vector update of type this = this + sum(alpha[i] * x[i]) in a
+      * single pass
+      */
+        ROCALUTION_EXPORT
+        virtual void MultiAXPY(int                                  num,
+                               const ValueType*                     alpha,
+                               const LocalVector<ValueType>* const* x);
+        /** \brief Perform vector update of type this = this + sum(alpha[i] * x[i]) in a
+      * single pass
+      */
+        ROCALUTION_EXPORT
+        virtual void MultiAXPY(int                                   num,
+                               const ValueType*                      alpha,
+                               const GlobalVector<ValueType>* const* x);
+
         /** \brief Perform vector scaling this = alpha * this */
         virtual void Scale(ValueType alpha) = 0;
 
@@ -360,6 +375,80 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
 
+        /** \brief Compute num dot (scalar) products in a single pass,
+      * result[i] = x[i]^T y[i]
+      * \details
+      * All vectors need to have the same size and backend as this vector. The dot
+      * products are reduced at once, e.g. a GlobalVector requires a single global
+      * reduction for all of them.
+      */
+        ROCALUTION_EXPORT
+        virtual void FusedDot(int                                  num,
+                              const LocalVector<ValueType>* const* x,
+                              const LocalVector<ValueType>* const* y,
+                              ValueType*                           result) const;
+        /** \brief Compute num dot (scalar) products in a single pass,
+      * result[i] = x[i]^T y[i]
+      */
+        ROCALUTION_EXPORT
+        virtual void FusedDot(int                                   num,
+                              const GlobalVector<ValueType>* const* x,
+                              const GlobalVector<ValueType>* const* y,
+                              ValueType*                            result) const;
+        /** \brief Start the computation of num dot (scalar) products in a single pass,
+      * result[i] = x[i]^T y[i]
+      * \details
+      * Same as FusedDot(), but the global reduction of a GlobalVector is non-blocking.
+      * The results are available after FusedDotSync(), result has to stay valid until
+      * then. Any computation that does not depend on the results can be performed in
+      * between to hide the latency of the reduction. For a LocalVector, the results are
+      * available immediately.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   const GlobalVector<ValueType>* x[2] = {&r, &w};
+      *   const GlobalVector<ValueType>* y[2] = {&r, &r};
+      *   ValueType dot[2];
+      *
+      *   r.FusedDotAsync(2, x, y, dot);
+      *   mat.Apply(w, &n);
+      *   r.FusedDotSync();
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        virtual void FusedDotAsync(int                                  num,
+                                   const LocalVector<ValueType>* const* x,
+                                   const LocalVector<ValueType>* const* y,
+                                   ValueType*                           result) const;
+        /** \brief Start the computation of num dot (scalar) products in a single pass,
+      * result[i] = x[i]^T y[i]
+      */
+        ROCALUTION_EXPORT
+        virtual void FusedDotAsync(int                                   num,
+                                   const GlobalVector<ValueType>* const* x,
+                                   const GlobalVector<ValueType>* const* y,
+                                   ValueType*                            result) const;
+        /** \brief Wait for the results of FusedDotAsync() */
+        ROCALUTION_EXPORT
+        virtual void FusedDotSync(void) const;
+        /** \brief Compute the dot (scalar) products of num vectors with this vector in a
+      * single pass, result[i] = x[i]^T this
+      * \details
+      * This vector is read only once and all dot products are reduced at once, e.g. a
+      * GlobalVector requires a single global reduction for all of them.
+      */
+        ROCALUTION_EXPORT
+        virtual void MultiDot(int                                  num,
+                              const LocalVector<ValueType>* const* x,
+                              ValueType*                           result) const;
+        /** \brief Compute the dot (scalar) products of num vectors with this vector in a
+      * single pass, result[i] = x[i]^T this
+      */
+        ROCALUTION_EXPORT
+        virtual void MultiDot(int                                   num,
+                              const GlobalVector<ValueType>* const* x,
+                              ValueType*                            result) const;
+
         /** \brief Compute \f$L_2\f$ norm of the vector, return = srqt(this^T this) */
         virtual ValueType Norm(void) const = 0;
 
@@ -41,7 +41,9 @@
 #include "base/matrix_formats.hpp"
 
 #include "base/global_vector.hpp"
+#include "base/local_multi_vector.hpp"
 #include "base/local_vector.hpp"
+#include "base/local_vector_expression.hpp"
 
 #include "base/local_stencil.hpp"
 #include "base/stencil_types.hpp"
@@ -53,13 +55,18 @@
 #include "solvers/iter_ctrl.hpp"
 #include "solvers/krylov/bicgstab.hpp"
 #include "solvers/krylov/bicgstabl.hpp"
+#include "solvers/krylov/block_cg.hpp"
+#include "solvers/krylov/block_gmres.hpp"
 #include "solvers/krylov/cg.hpp"
 #include "solvers/krylov/cr.hpp"
 #include "solvers/krylov/fcg.hpp"
 #include "solvers/krylov/fgmres.hpp"
 #include "solvers/krylov/gmres.hpp"
 #include "solvers/krylov/idr.hpp"
+#include "solvers/krylov/pipelined_cg.hpp"
 #include "solvers/krylov/qmrcgstab.hpp"
+#include "solvers/krylov/sstep_cg.hpp"
+#include "solvers/krylov/sstep_gmres.hpp"
 #include "solvers/mixed_precision.hpp"
 #include "solvers/multigrid/base_amg.hpp"
 #include "solvers/multigrid/base_multigrid.hpp"
@@ -267,12 +267,8 @@ namespace rocalution
         ValueType rho;
         ValueType rho_old;
 
-        // Inital residual r0 = b - Ax
-        op->Apply(*x, r0);
-        r0->ScaleAdd(static_cast<ValueType>(-1), rhs);
-
-        // Initial residual norm for |b-Ax0|
-        ValueType res_norm = this->Norm_(*r0);
+        // Initial residual r0 = b - Ax and its norm |b-Ax0|
+        ValueType res_norm = this->ResidualNorm_(rhs, *x, r0);
         //    ValueType res_norm = this->Norm_(rhs);
 
         if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
@@ -292,20 +288,17 @@ namespace rocalution
 
         while(true)
         {
-            // q = Ap
-            op->Apply(*p, q);
-
-            // alpha = rho / <r0,q>
-            alpha = rho / r0->Dot(*q);
+            // q = Ap and alpha = rho / <r0,q>
+            alpha = rho / op->ApplyDot(*p, *r0, q);
 
             // r = r - alpha * q
             r->AddScale(*q, -alpha);
 
-            // t = Ar
-            op->Apply(*r, t);
+            // t = Ar and <r,t>
+            ValueType rt = op->ApplyDot(*r, *r, t);
 
             // omega = <t,r> / <t,t>
-            omega = t->Dot(*r) / t->Dot(*t);
+            omega = rocalution_conj(rt) / t->Dot(*t);
 
             if((std::abs(omega) == std::numeric_limits<ValueType>::infinity()) || (omega != omega)
                || (omega == static_cast<ValueType>(0)))
@@ -389,12 +382,8 @@ namespace rocalution
         ValueType rho;
         ValueType rho_old;
 
-        // Initial residual = b - Ax
-        op->Apply(*x, r0);
-        r0->ScaleAdd(static_cast<ValueType>(-1), rhs);
-
-        // Initial residual norm for |b-Ax0|
-        ValueType res_norm = this->Norm_(*r0);
+        // Initial residual = b - Ax and its norm |b-Ax0|
+        ValueType res_norm = this->ResidualNorm_(rhs, *x, r0);
         //    ValueType res_norm = this->Norm_(rhs);
 
         if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
@@ -415,11 +404,8 @@ namespace rocalution
 
         while(true)
         {
-            // q = Az
-            op->Apply(*z, q);
-
-            // alpha = rho / <r0,q>
-            alpha = rho / r0->Dot(*q);
+            // q = Az and alpha = rho / <r0,q>
+            alpha = rho / op->ApplyDot(*z, *r0, q);
 
             // r = r - alpha * q
             r->AddScale(*q, -alpha);
@@ -427,11 +413,11 @@ namespace rocalution
             // Mv = r
             this->precond_->SolveZeroSol(*r, v);
 
-            // t = Av
-            op->Apply(*v, t);
+            // t = Av and <r,t>
+            ValueType rt = op->ApplyDot(*v, *r, t);
 
             // omega = (t,r) / (t,t)
-            omega = t->Dot(*r) / t->Dot(*t);
+            omega = rocalution_conj(rt) / t->Dot(*t);
 
             if((std::abs(omega) == std::numeric_limits<ValueType>::infinity()) || (omega != omega)
                || (omega == static_cast<ValueType>(0)))
@@ -146,6 +146,7 @@ namespace rocalution
         this->gamma1_ = new ValueType[this->l_];
         this->gamma2_ = new ValueType[this->l_];
         this->sigma_  = new ValueType[this->l_];
+        this->a_      = new ValueType[this->l_ + 1];
 
         this->tau_ = new ValueType*[this->l_];
         for(int i = 0; i < this->l_; ++i)
@@ -181,6 +182,7 @@ namespace rocalution
             delete[] this->gamma1_;
             delete[] this->gamma2_;
             delete[] this->sigma_;
+            delete[] this->a_;
 
             for(int i = 0; i < this->l_; ++i)
             {
@@ -317,6 +319,7 @@ namespace rocalution
         ValueType*  gamma2 = this->gamma2_;
         ValueType*  sigma  = this->sigma_;
         ValueType** tau    = this->tau_;
+        ValueType*  a      = this->a_;
 
         // inital residual r0 = b - Ax
         op->Apply(*x, r0);
@@ -418,11 +421,12 @@ namespace rocalution
                     r[j + 1]->AddScale(*r[i + 1], -tau[i][j]);
                 }
 
-                // sigma_j = (r_j+1, r_j+1)
-                sigma[j] = r[j + 1]->Dot(*r[j + 1]);
+                // sigma_j = (r_j+1, r_j+1), gamma'_j = (r_0, r_j+1) / sigma_j
+                const VectorType* w[2] = {r[j + 1], r[0]};
+                r[j + 1]->MultiDot(2, w, a);
 
-                // gamma' = (r_0, r_j+1) / sigma_j
-                gamma1[j] = r[0]->Dot(*r[j + 1]) / sigma[j];
+                sigma[j]  = a[0];
+                gamma1[j] = a[1] / sigma[j];
             }
 
             // omega = gamma'_l-1; gamma_l-1 = gamma'_l-1
@@ -451,27 +455,31 @@ namespace rocalution
 
             // Update
 
-            // x = x + gamma_0 * r_0
-            x->AddScale(*r[0], gamma0[0]);
-
-            // r_0 = r_0 - gamma'_l-1 * r_l
-            r[0]->AddScale(*r[l], -gamma1[l - 1]);
+            // x = x + gamma_0 * r_0 + sum(gamma''_j-1 * r_j) (j=1,...,l-1)
+            a[0] = gamma0[0];
+            for(int j = 1; j < l; ++j)
+            {
+                a[j] = gamma2[j - 1];
+            }
 
-            // u_0 = u_0 - gamma_l-1 * u_l
-            u[0]->AddScale(*u[l], -gamma0[l - 1]);
+            x->MultiAXPY(l, a, r);
 
-            for(int j = 1; j < l; ++j)
+            // r_0 = r_0 - sum(gamma'_j-1 * r_j) (j=1,...,l)
+            for(int j = 0; j < l; ++j)
             {
-                // u_0 = u_0 - gamma_j-1 * u_j
-                u[0]->AddScale(*u[j], -gamma0[j - 1]);
+                a[j] = -gamma1[j];
+            }
 
-                // x = x + gamma''_j-1 * r_j
-                x->AddScale(*r[j], gamma2[j - 1]);
+            r[0]->MultiAXPY(l, a, r + 1);
 
-                // r_0 = r_0 - gamma'_j-1 * r_j
-                r[0]->AddScale(*r[j], -gamma1[j - 1]);
+            // u_0 = u_0 - sum(gamma_j-1 * u_j) (j=1,...,l)
+            for(int j = 0; j < l; ++j)
+            {
+                a[j] = -gamma0[j];
             }
 
+            u[0]->MultiAXPY(l, a, u + 1);
+
             res = this->Norm_(*r[0]);
 
             if(this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
@@ -516,6 +524,7 @@ namespace rocalution
         ValueType*  gamma2 = this->gamma2_;
         ValueType*  sigma  = this->sigma_;
         ValueType** tau    = this->tau_;
+        ValueType*  a      = this->a_;
 
         // inital residual z = b - Ax
         op->Apply(*x, z);
@@ -628,11 +637,12 @@ namespace rocalution
                     r[j + 1]->AddScale(*r[i + 1], -tau[i][j]);
                 }
 
-                // sigma_j = (r_j+1, r_j+1)
-                sigma[j] = r[j + 1]->Dot(*r[j + 1]);
+                // sigma_j = (r_j+1, r_j+1), gamma'_j = (r_0, r_j+1) / sigma_j
+                const VectorType* w[2] = {r[j + 1], r[0]};
+                r[j + 1]->MultiDot(2, w, a);
 
-                // gamma' = (r_0, r_j+1) / sigma_j
-                gamma1[j] = r[0]->Dot(*r[j + 1]) / sigma[j];
+                sigma[j]  = a[0];
+                gamma1[j] = a[1] / sigma[j];
             }
 
             // omega = gamma'_l-1; gamma_l-1 = gamma'_l-1
@@ -661,27 +671,31 @@ namespace rocalution
 
             // Update
 
-            // x = x + gamma_0 * r_0
-            x->AddScale(*r[0], gamma0[0]);
-
-            // r_0 = r_0 - gamma'_l-1 * r_l
-            r[0]->AddScale(*r[l], -gamma1[l - 1]);
+            // x = x + gamma_0 * r_0 + sum(gamma''_j-1 * r_j) (j=1,...,l-1)
+            a[0] = gamma0[0];
+            for(int j = 1; j < l; ++j)
+            {
+                a[j] = gamma2[j - 1];
+            }
 
-            // u_0 = u_0 - gamma_l-1 * u_l
-            u[0]->AddScale(*u[l], -gamma0[l - 1]);
+            x->MultiAXPY(l, a, r);
 
-            for(int j = 1; j < l; ++j)
+            // r_0 = r_0 - sum(gamma'_j-1 * r_j) (j=1,...,l)
+            for(int j = 0; j < l; ++j)
             {
-                // u_0 = u_0 - gamma_j-1 * u_j
-                u[0]->AddScale(*u[j], -gamma0[j - 1]);
+                a[j] = -gamma1[j];
+            }
 
-                // x = x + gamma''_j-1 * r_j
-                x->AddScale(*r[j], gamma2[j - 1]);
+            r[0]->MultiAXPY(l, a, r + 1);
 
-                // r_0 = r_0 - gamma'_j-1 * r_j
-                r[0]->AddScale(*r[j], -gamma1[j - 1]);
+            // u_0 = u_0 - sum(gamma_j-1 * u_j) (j=1,...,l)
+            for(int j = 0; j < l; ++j)
+            {
+                a[j] = -gamma0[j];
             }
 
+            u[0]->MultiAXPY(l, a, u + 1);
+
             res = this->Norm_(*r[0]);
 
             if(this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
@@ -84,6 +84,9 @@ namespace rocalution
         ValueType * gamma0_, *gamma1_, *gamma2_, *sigma_;
         ValueType** tau_;
 
+        // Coefficients of the fused vector updates
+        ValueType* a_;
+
         VectorType   r0_, z_;
         VectorType **r_, **u_;
     };
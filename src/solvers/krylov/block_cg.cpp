@@ -0,0 +1,625 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "block_cg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_multi_vector.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <complex>
+#include <algorithm>
+#include <limits>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    // Machine precision of the underlying real type
+    template <typename ValueType>
+    static double block_cg_eps(ValueType)
+    {
+        return std::numeric_limits<ValueType>::epsilon();
+    }
+
+    template <typename ValueType>
+    static double block_cg_eps(std::complex<ValueType>)
+    {
+        return std::numeric_limits<ValueType>::epsilon();
+    }
+
+    // Largest L2 norm of all vectors of a block, given the block Gram matrix G = R^H R
+    template <typename ValueType>
+    static double block_cg_max_norm(int k, const ValueType* G)
+    {
+        double nrm = 0.0;
+
+        for(int j = 0; j < k; ++j)
+        {
+            nrm = std::max(nrm, sqrt(static_cast<double>(std::abs(G[j + j * k]))));
+        }
+
+        return nrm;
+    }
+
+    // Solve the dense k x k system A X = B with nrhs right-hand sides in place, using
+    // Gaussian elimination with partial pivoting. A and B are stored column-major, B is
+    // overwritten with the solution. Returns false if A is (numerically) singular.
+    template <typename ValueType>
+    static bool block_cg_dense_solve(int k, int nrhs, ValueType* A, ValueType* B)
+    {
+        double amax = 0.0;
+
+        for(int i = 0; i < k * k; ++i)
+        {
+            amax = std::max(amax, static_cast<double>(std::abs(A[i])));
+        }
+
+        double tol = k * block_cg_eps(A[0]) * amax;
+
+        for(int j = 0; j < k; ++j)
+        {
+            // Pivot search
+            int    piv  = j;
+            double vmax = std::abs(A[j + j * k]);
+
+            for(int i = j + 1; i < k; ++i)
+            {
+                if(std::abs(A[i + j * k]) > vmax)
+                {
+                    vmax = std::abs(A[i + j * k]);
+                    piv  = i;
+                }
+            }
+
+            if(vmax <= tol)
+            {
+                return false;
+            }
+
+            if(piv != j)
+            {
+                for(int c = 0; c < k; ++c)
+                {
+                    std::swap(A[j + c * k], A[piv + c * k]);
+                }
+
+                for(int c = 0; c < nrhs; ++c)
+                {
+                    std::swap(B[j + c * k], B[piv + c * k]);
+                }
+            }
+
+            // Elimination
+            ValueType inv_diag = static_cast<ValueType>(1) / A[j + j * k];
+
+            for(int i = j + 1; i < k; ++i)
+            {
+                ValueType fac = A[i + j * k] * inv_diag;
+
+                for(int c = j + 1; c < k; ++c)
+                {
+                    A[i + c * k] -= fac * A[j + c * k];
+                }
+
+                for(int c = 0; c < nrhs; ++c)
+                {
+                    B[i + c * k] -= fac * B[j + c * k];
+                }
+            }
+        }
+
+        // Backward substitution
+        for(int c = 0; c < nrhs; ++c)
+        {
+            for(int i = k - 1; i >= 0; --i)
+            {
+                ValueType sum = B[i + c * k];
+
+                for(int j = i + 1; j < k; ++j)
+                {
+                    sum -= A[i + j * k] * B[j + c * k];
+                }
+
+                B[i + c * k] = sum / A[i + i * k];
+            }
+        }
+
+        return true;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    BlockCG<OperatorType, VectorType, ValueType>::BlockCG()
+    {
+        log_debug(this, "BlockCG::BlockCG()", "default constructor");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    BlockCG<OperatorType, VectorType, ValueType>::~BlockCG()
+    {
+        log_debug(this, "BlockCG::~BlockCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockCG solver");
+        }
+        else
+        {
+            LOG_INFO("BlockPCG solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockCG (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("BlockPCG solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockCG (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("BlockPCG ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "BlockCG::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->Build();
+
+            this->t_.CloneBackend(*this->op_);
+            this->t_.Allocate("t", this->op_->GetM());
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+        }
+
+        // The block vectors are allocated in Solve(), once the number of right-hand
+        // sides is known
+
+        log_debug(this, "BlockCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::AllocateBlock_(int num_vectors)
+    {
+        log_debug(this, "BlockCG::AllocateBlock_()", num_vectors);
+
+        assert(num_vectors > 0);
+
+        if(this->r_.GetNumVectors() == num_vectors)
+        {
+            return;
+        }
+
+        IndexType2 m = this->op_->GetM();
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", m, num_vectors);
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", m, num_vectors);
+
+        this->q_.CloneBackend(*this->op_);
+        this->q_.Allocate("q", m, num_vectors);
+
+        if(this->precond_ != NULL)
+        {
+            this->z_.CloneBackend(*this->op_);
+            this->z_.Allocate("z", m, num_vectors);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "BlockCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->r_.Clear();
+            this->z_.Clear();
+            this->p_.Clear();
+            this->q_.Clear();
+
+            this->t_.Clear();
+            this->u_.Clear();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "BlockCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.Zeros();
+            this->z_.Zeros();
+            this->p_.Zeros();
+            this->q_.Zeros();
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "BlockCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToHost();
+            this->p_.MoveToHost();
+            this->q_.MoveToHost();
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.MoveToHost();
+                this->t_.MoveToHost();
+                this->u_.MoveToHost();
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "BlockCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToAccelerator();
+            this->p_.MoveToAccelerator();
+            this->q_.MoveToAccelerator();
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.MoveToAccelerator();
+                this->t_.MoveToAccelerator();
+                this->u_.MoveToAccelerator();
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::Solve(const LocalMultiVector<ValueType>& rhs,
+                                                             LocalMultiVector<ValueType>*       x)
+    {
+        log_debug(this, "BlockCG::Solve()", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(rhs.GetNumVectors() == x->GetNumVectors());
+
+        if(this->verb_ > 0)
+        {
+            this->PrintStart_();
+            this->iter_ctrl_.PrintInit();
+        }
+
+        this->SolveBlock_(rhs, x);
+
+        if(this->verb_ > 0)
+        {
+            this->iter_ctrl_.PrintStatus();
+            this->PrintEnd_();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "BlockCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        // A single right-hand side is solved as a block of size one
+        LocalMultiVector<ValueType> B;
+        LocalMultiVector<ValueType> X;
+
+        B.CloneBackend(*this->op_);
+        X.CloneBackend(*this->op_);
+
+        B.Allocate("B", rhs.GetSize(), 1);
+        X.Allocate("X", x->GetSize(), 1);
+
+        B.CopyFromVector(0, rhs);
+        X.CopyFromVector(0, *x);
+
+        this->SolveBlock_(B, &X);
+
+        X.CopyToVector(0, x);
+
+        log_debug(this, "BlockCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                     VectorType*       x)
+    {
+        log_debug(this, "BlockCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        // A single right-hand side is solved as a block of size one
+        LocalMultiVector<ValueType> B;
+        LocalMultiVector<ValueType> X;
+
+        B.CloneBackend(*this->op_);
+        X.CloneBackend(*this->op_);
+
+        B.Allocate("B", rhs.GetSize(), 1);
+        X.Allocate("X", x->GetSize(), 1);
+
+        B.CopyFromVector(0, rhs);
+        X.CopyFromVector(0, *x);
+
+        this->SolveBlock_(B, &X);
+
+        X.CopyToVector(0, x);
+
+        log_debug(this, "BlockCG::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::ApplyPrecond_(
+        const LocalMultiVector<ValueType>& r, LocalMultiVector<ValueType>* z)
+    {
+        log_debug(this, "BlockCG::ApplyPrecond_()", (const void*&)r, z);
+
+        assert(z != NULL);
+        assert(this->precond_ != NULL);
+
+        for(int j = 0; j < r.GetNumVectors(); ++j)
+        {
+            r.CopyToVector(j, &this->t_);
+            this->precond_->SolveZeroSol(this->t_, &this->u_);
+            z->CopyFromVector(j, this->u_);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::SolveBlock_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "BlockCG::SolveBlock_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+
+        int k = rhs.GetNumVectors();
+
+        this->AllocateBlock_(k);
+
+        const OperatorType* op = this->op_;
+
+        LocalMultiVector<ValueType>* r = &this->r_;
+        LocalMultiVector<ValueType>* p = &this->p_;
+        LocalMultiVector<ValueType>* q = &this->q_;
+
+        // Without preconditioner, z = r
+        LocalMultiVector<ValueType>* z = (this->precond_ != NULL) ? &this->z_ : &this->r_;
+
+        // Small dense k x k matrices
+        std::vector<ValueType> rr(k * k);
+        std::vector<ValueType> pq(k * k);
+        std::vector<ValueType> lu(k * k);
+        std::vector<ValueType> alpha(k * k);
+        std::vector<ValueType> beta(k * k);
+        std::vector<ValueType> zeta(k * k);
+
+        ValueType one = static_cast<ValueType>(1);
+
+        // Seed for random vectors replacing linearly dependent search directions
+        unsigned long long seed = 1234ULL;
+
+        // Initial residual R = B - AX
+        r->CopyFrom(rhs);
+        op->ApplyAdd(*x, -one, r);
+
+        // Initial residual norm, the largest |b_j - Ax_j| of all right-hand sides
+        r->Dot(*r, &rr[0]);
+        double res_norm = block_cg_max_norm(k, &rr[0]);
+
+        if(this->iter_ctrl_.InitResidual(res_norm) == false)
+        {
+            log_debug(this, "BlockCG::SolveBlock_()", " #*# end");
+            return;
+        }
+
+        // Z = M^-1 R
+        if(this->precond_ != NULL)
+        {
+            this->ApplyPrecond_(*r, z);
+        }
+
+        // P zeta = Z
+        p->CopyFrom(*z);
+
+        if(p->Orthonormalize(&zeta[0], seed) < 0)
+        {
+            LOG_VERBOSE_INFO(2, "*** warning: BlockCG::SolveBlock_() breakdown, block search "
+                                "directions are linearly dependent");
+            log_debug(this, "BlockCG::SolveBlock_()", " #*# end");
+            return;
+        }
+
+        seed += k;
+
+        while(true)
+        {
+            // Q = AP
+            op->Apply(*p, q);
+
+            // alpha = (P^H Q)^-1 P^H R
+            p->Dot(*q, &pq[0]);
+            p->Dot(*r, &alpha[0]);
+
+            lu = pq;
+
+            if(block_cg_dense_solve(k, k, &lu[0], &alpha[0]) == false)
+            {
+                LOG_VERBOSE_INFO(2, "*** warning: BlockCG::SolveBlock_() breakdown, P^H A P is "
+                                    "singular");
+                break;
+            }
+
+            // X = X + P alpha
+            x->AddScale(*p, &alpha[0]);
+
+            // R = R - Q alpha
+            for(int i = 0; i < k * k; ++i)
+            {
+                alpha[i] = -alpha[i];
+            }
+
+            r->AddScale(*q, &alpha[0]);
+
+            // Check convergence
+            r->Dot(*r, &rr[0]);
+            res_norm = block_cg_max_norm(k, &rr[0]);
+
+            if(this->iter_ctrl_.CheckResidual(res_norm, this->index_))
+            {
+                break;
+            }
+
+            // Z = M^-1 R
+            if(this->precond_ != NULL)
+            {
+                this->ApplyPrecond_(*r, z);
+            }
+
+            // beta = -(P^H Q)^-1 Q^H Z, such that the new P is A-conjugate to the old one
+            q->Dot(*z, &beta[0]);
+
+            for(int i = 0; i < k * k; ++i)
+            {
+                beta[i] = -beta[i];
+            }
+
+            lu = pq;
+            block_cg_dense_solve(k, k, &lu[0], &beta[0]);
+
+            // P zeta = P beta + Z
+            p->ScaleAdd(&beta[0], *z);
+
+            if(p->Orthonormalize(&zeta[0], seed) < 0)
+            {
+                LOG_VERBOSE_INFO(2, "*** warning: BlockCG::SolveBlock_() breakdown, block "
+                                    "search directions are linearly dependent");
+                break;
+            }
+
+            seed += k;
+        }
+
+        log_debug(this, "BlockCG::SolveBlock_()", " #*# end");
+    }
+
+    template class BlockCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class BlockCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BlockCG<LocalMatrix<std::complex<double>>,
+                           LocalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class BlockCG<LocalMatrix<std::complex<float>>,
+                           LocalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_BLOCK_CG_HPP_
+#define ROCALUTION_KRYLOV_BLOCK_CG_HPP_
+
+#include "../../base/local_multi_vector.hpp"
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+#include <vector>
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class BlockCG
+  * \brief Block Conjugate Gradient Method
+  * \details
+  * The Block Conjugate Gradient method solves sparse symmetric positive definite (SPD)
+  * linear systems \f$AX=B\f$ with \f$k\f$ right-hand sides simultaneously. All
+  * right-hand sides share a single block Krylov subspace
+  * \f$\mathcal{K}_{m}(R_{0}, A)\f$, which typically reduces the number of iterations
+  * compared to \f$k\f$ independent CG solves. Each iteration reads the matrix only once
+  * for all right-hand sides (see LocalMatrix::Apply() for LocalMultiVector). The method
+  * can be preconditioned, where the approximation should also be SPD. The
+  * preconditioner is applied to each right-hand side separately.
+  * \cite SAAD
+  *
+  * The block search directions are orthonormalized in each iteration (see
+  * LocalMultiVector::Orthonormalize()), which avoids the breakdown of the classical block
+  * CG method when the search directions become linearly dependent, e.g. because some
+  * right-hand sides converge earlier than others. Convergence is checked on the largest
+  * residual norm of all right-hand sides. Only the \f$L_2\f$ norm is supported.
+  *
+  * \tparam OperatorType - can be LocalMatrix
+  * \tparam VectorType - can be LocalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class BlockCG : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        BlockCG();
+        ROCALUTION_EXPORT
+        virtual ~BlockCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        using IterativeLinearSolver<OperatorType, VectorType, ValueType>::Solve;
+
+        /** \brief Solve \f$AX=B\f$ for all right-hand sides of \p rhs
+      * \details
+      * @param[in]
+      * rhs     multi-vector with \p k right-hand sides
+      * @param[inout]
+      * x       multi-vector with \p k initial guesses, overwritten by the solutions
+      */
+        ROCALUTION_EXPORT
+        virtual void Solve(const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        /** \brief Block solve, with or without preconditioner */
+        virtual void SolveBlock_(const LocalMultiVector<ValueType>& rhs,
+                                 LocalMultiVector<ValueType>*       x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // Allocate the block work vectors for num_vectors right-hand sides
+        void AllocateBlock_(int num_vectors);
+        // Apply the preconditioner to each vector of r, z = M^-1 r
+        void ApplyPrecond_(const LocalMultiVector<ValueType>& r, LocalMultiVector<ValueType>* z);
+
+        LocalMultiVector<ValueType> r_, z_;
+        LocalMultiVector<ValueType> p_, q_;
+
+        // Single vector buffers for the preconditioner
+        VectorType t_, u_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_BLOCK_CG_HPP_
@@ -0,0 +1,791 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "block_gmres.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_multi_vector.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    // Generate the Givens rotation [c s; -conj(s) c] with real c, that eliminates dy
+    template <typename ValueType>
+    static void block_gmres_generate_givens(ValueType dx, ValueType dy, ValueType& c, ValueType& s)
+    {
+        double ax = std::abs(dx);
+        double ay = std::abs(dy);
+
+        if(ay == 0.0)
+        {
+            c = static_cast<ValueType>(1);
+            s = static_cast<ValueType>(0);
+        }
+        else if(ax == 0.0)
+        {
+            c = static_cast<ValueType>(0);
+            s = rocalution_conj(dy) / static_cast<ValueType>(ay);
+        }
+        else
+        {
+            double nrm = sqrt(ax * ax + ay * ay);
+
+            c = static_cast<ValueType>(ax / nrm);
+            s = (dx / static_cast<ValueType>(ax)) * rocalution_conj(dy)
+                / static_cast<ValueType>(nrm);
+        }
+    }
+
+    // Apply the Givens rotation [c s; -conj(s) c] to (dx, dy)
+    template <typename ValueType>
+    static void block_gmres_apply_givens(ValueType c, ValueType s, ValueType& dx, ValueType& dy)
+    {
+        ValueType temp = dx;
+        dx             = c * dx + s * dy;
+        dy             = -rocalution_conj(s) * temp + c * dy;
+    }
+
+    // Largest L2 norm of all vectors of a block, given the block Gram matrix G = R^H R
+    template <typename ValueType>
+    static double block_gmres_max_norm(int k, const ValueType* G)
+    {
+        double nrm = 0.0;
+
+        for(int j = 0; j < k; ++j)
+        {
+            nrm = std::max(nrm, sqrt(static_cast<double>(std::abs(G[j + j * k]))));
+        }
+
+        return nrm;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    BlockGMRES<OperatorType, VectorType, ValueType>::BlockGMRES()
+    {
+        log_debug(this, "BlockGMRES::BlockGMRES()", "default constructor");
+
+        this->size_basis_ = 30;
+
+        this->v_ = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    BlockGMRES<OperatorType, VectorType, ValueType>::~BlockGMRES()
+    {
+        log_debug(this, "BlockGMRES::~BlockGMRES()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockGMRES solver");
+        }
+        else
+        {
+            LOG_INFO("BlockGMRES solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockGMRES(" << this->size_basis_ << ") (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("BlockGMRES(" << this->size_basis_
+                                   << ") solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockGMRES(" << this->size_basis_ << ") (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("BlockGMRES(" << this->size_basis_ << ") ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "BlockGMRES::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() > 0);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->size_basis_ > 0);
+
+        if(this->res_norm_type_ != 2)
+        {
+            LOG_INFO("BlockGMRES solver supports only L2 residual norm. The solver is switching "
+                     "to L2 norm");
+            this->res_norm_type_ = 2;
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->t_.CloneBackend(*this->op_);
+            this->t_.Allocate("t", this->op_->GetM());
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+        }
+
+        // The block Krylov basis is allocated in Solve(), once the number of right-hand
+        // sides is known
+
+        this->build_ = true;
+
+        log_debug(this, "BlockGMRES::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::AllocateBlock_(int num_vectors)
+    {
+        log_debug(this, "BlockGMRES::AllocateBlock_()", num_vectors);
+
+        assert(num_vectors > 0);
+
+        if(this->v_ != NULL && this->v_[0]->GetNumVectors() == num_vectors)
+        {
+            return;
+        }
+
+        this->ClearBlock_();
+
+        IndexType2 m = this->op_->GetM();
+
+        this->v_ = new LocalMultiVector<ValueType>*[this->size_basis_ + 2];
+
+        for(int i = 0; i < this->size_basis_ + 2; ++i)
+        {
+            this->v_[i] = new LocalMultiVector<ValueType>;
+            this->v_[i]->CloneBackend(*this->op_);
+            this->v_[i]->Allocate("v", m, num_vectors);
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->z_.CloneBackend(*this->op_);
+            this->z_.Allocate("z", m, num_vectors);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::ClearBlock_(void)
+    {
+        log_debug(this, "BlockGMRES::ClearBlock_()");
+
+        if(this->v_ != NULL)
+        {
+            for(int i = 0; i < this->size_basis_ + 2; ++i)
+            {
+                this->v_[i]->Clear();
+                delete this->v_[i];
+            }
+            delete[] this->v_;
+            this->v_ = NULL;
+        }
+
+        this->z_.Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "BlockGMRES::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->t_.Clear();
+                this->u_.Clear();
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->ClearBlock_();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "BlockGMRES::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->v_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_ + 2; ++i)
+                {
+                    this->v_[i]->Zeros();
+                }
+            }
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.Zeros();
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "BlockGMRES::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->v_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_ + 2; ++i)
+                {
+                    this->v_[i]->MoveToHost();
+                }
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.MoveToHost();
+                this->t_.MoveToHost();
+                this->u_.MoveToHost();
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "BlockGMRES::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->v_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_ + 2; ++i)
+                {
+                    this->v_[i]->MoveToAccelerator();
+                }
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.MoveToAccelerator();
+                this->t_.MoveToAccelerator();
+                this->u_.MoveToAccelerator();
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::SetBasisSize(int size_basis)
+    {
+        log_debug(this, "BlockGMRES:SetBasisSize()", size_basis);
+
+        assert(size_basis > 0);
+        assert(this->build_ == false);
+
+        this->size_basis_ = size_basis;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void
+        BlockGMRES<OperatorType, VectorType, ValueType>::Solve(
+            const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "BlockGMRES::Solve()", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(rhs.GetNumVectors() == x->GetNumVectors());
+
+        if(this->verb_ > 0)
+        {
+            this->PrintStart_();
+            this->iter_ctrl_.PrintInit();
+        }
+
+        this->SolveBlock_(rhs, x);
+
+        if(this->verb_ > 0)
+        {
+            this->iter_ctrl_.PrintStatus();
+            this->PrintEnd_();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                           VectorType*       x)
+    {
+        log_debug(this, "BlockGMRES::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        // A single right-hand side is solved as a block of size one
+        LocalMultiVector<ValueType> B;
+        LocalMultiVector<ValueType> X;
+
+        B.CloneBackend(*this->op_);
+        X.CloneBackend(*this->op_);
+
+        B.Allocate("B", rhs.GetSize(), 1);
+        X.Allocate("X", x->GetSize(), 1);
+
+        B.CopyFromVector(0, rhs);
+        X.CopyFromVector(0, *x);
+
+        this->SolveBlock_(B, &X);
+
+        X.CopyToVector(0, x);
+
+        log_debug(this, "BlockGMRES::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "BlockGMRES::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        // A single right-hand side is solved as a block of size one
+        LocalMultiVector<ValueType> B;
+        LocalMultiVector<ValueType> X;
+
+        B.CloneBackend(*this->op_);
+        X.CloneBackend(*this->op_);
+
+        B.Allocate("B", rhs.GetSize(), 1);
+        X.Allocate("X", x->GetSize(), 1);
+
+        B.CopyFromVector(0, rhs);
+        X.CopyFromVector(0, *x);
+
+        this->SolveBlock_(B, &X);
+
+        X.CopyToVector(0, x);
+
+        log_debug(this, "BlockGMRES::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::ApplyPrecond_(
+        const LocalMultiVector<ValueType>& r, LocalMultiVector<ValueType>* z)
+    {
+        log_debug(this, "BlockGMRES::ApplyPrecond_()", (const void*&)r, z);
+
+        assert(z != NULL);
+        assert(this->precond_ != NULL);
+
+        for(int j = 0; j < r.GetNumVectors(); ++j)
+        {
+            r.CopyToVector(j, &this->t_);
+            this->precond_->SolveZeroSol(this->t_, &this->u_);
+            z->CopyFromVector(j, this->u_);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::SolveBlock_(
+        const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x)
+    {
+        log_debug(this, "BlockGMRES::SolveBlock_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(this->size_basis_ > 0);
+        assert(this->res_norm_type_ == 2);
+
+        int k    = rhs.GetNumVectors();
+        int size = this->size_basis_;
+
+        this->AllocateBlock_(k);
+
+        const OperatorType* op = this->op_;
+
+        LocalMultiVector<ValueType>** v = this->v_;
+
+        ValueType one  = static_cast<ValueType>(1);
+        ValueType zero = static_cast<ValueType>(0);
+
+        // Block Hessenberg matrix H and right-hand side of the least squares problem g
+        int nrow = (size + 1) * k;
+        int ncol = size * k;
+
+        std::vector<ValueType> H(nrow * ncol);
+        std::vector<ValueType> g(nrow * k);
+
+        // Givens rotations, at most 2k per column of H
+        std::vector<ValueType> c(ncol * 2 * k);
+        std::vector<ValueType> s(ncol * 2 * k);
+        std::vector<int>       row(ncol * 2 * k);
+
+        std::vector<ValueType> S(k * k);
+        std::vector<ValueType> T(k * k);
+        std::vector<ValueType> U(k * k);
+
+        // Initial residual v_0 = B - AX
+        v[0]->CopyFrom(rhs);
+        op->ApplyAdd(*x, -one, v[0]);
+
+        v[0]->Dot(*v[0], &S[0]);
+        double res_norm = block_gmres_max_norm(k, &S[0]);
+
+        if(this->iter_ctrl_.InitResidual(res_norm) == false)
+        {
+            log_debug(this, "BlockGMRES::SolveBlock_()", " #*# end");
+            return;
+        }
+
+        // Seed for random vectors replacing linearly dependent basis vectors
+        unsigned long long seed = 1234ULL;
+
+        while(true)
+        {
+            // v_0 S = v_0
+            if(v[0]->Orthonormalize(&S[0], seed) < 0)
+            {
+                LOG_VERBOSE_INFO(2, "*** warning: BlockGMRES::SolveBlock_() breakdown, "
+                                    "block Krylov basis is linearly dependent");
+                break;
+            }
+
+            seed += k;
+
+            // g = [S; 0]
+            std::fill(g.begin(), g.end(), zero);
+
+            for(int j = 0; j < k; ++j)
+            {
+                for(int i = 0; i < k; ++i)
+                {
+                    g[DENSE_IND(i, j, nrow, k)] = S[i + j * k];
+                }
+            }
+
+            std::fill(H.begin(), H.end(), zero);
+
+            int  nrot      = 0;
+            bool breakdown = false;
+
+            // Block Arnoldi iteration
+            int i = 0;
+            while(i < size)
+            {
+                // v_i+1 = AM^-1 v_i
+                if(this->precond_ != NULL)
+                {
+                    this->ApplyPrecond_(*v[i], &this->z_);
+                    op->Apply(this->z_, v[i + 1]);
+                }
+                else
+                {
+                    op->Apply(*v[i], v[i + 1]);
+                }
+
+                // Block modified Gram-Schmidt
+                for(int j = 0; j <= i; ++j)
+                {
+                    // H_ji = v_j^H v_i+1
+                    v[j]->Dot(*v[i + 1], &S[0]);
+
+                    for(int cc = 0; cc < k; ++cc)
+                    {
+                        for(int rr = 0; rr < k; ++rr)
+                        {
+                            H[DENSE_IND(j * k + rr, i * k + cc, nrow, ncol)] = S[rr + cc * k];
+                            S[rr + cc * k] = -S[rr + cc * k];
+                        }
+                    }
+
+                    // v_i+1 -= v_j H_ji
+                    v[i + 1]->AddScale(*v[j], &S[0]);
+                }
+
+                // v_i+1 H_i+1i = v_i+1
+                int rank = v[i + 1]->Orthonormalize(&S[0], seed);
+                seed += k;
+
+                if(rank >= 0 && rank < k)
+                {
+                    // Some vectors have been replaced by random vectors, which need to be
+                    // orthogonalized against the basis, too
+                    for(int j = 0; j <= i; ++j)
+                    {
+                        v[j]->Dot(*v[i + 1], &T[0]);
+
+                        for(int jj = 0; jj < k * k; ++jj)
+                        {
+                            T[jj] = -T[jj];
+                        }
+
+                        v[i + 1]->AddScale(*v[j], &T[0]);
+                    }
+
+                    // v_i+1 T = v_i+1, H_i+1i = T S
+                    if(v[i + 1]->Orthonormalize(&T[0], seed) == k)
+                    {
+                        for(int cc = k - 1; cc >= 0; --cc)
+                        {
+                            for(int rr = 0; rr < k; ++rr)
+                            {
+                                ValueType sum = zero;
+
+                                for(int jj = rr; jj < k; ++jj)
+                                {
+                                    sum += T[rr + jj * k] * S[jj + cc * k];
+                                }
+
+                                U[rr + cc * k] = sum;
+                            }
+                        }
+
+                        S = U;
+                    }
+                    else
+                    {
+                        rank = -1;
+                    }
+
+                    seed += k;
+                }
+
+                if(rank < 0)
+                {
+                    // The block Krylov subspace is (numerically) exhausted
+                    breakdown = true;
+                    std::fill(S.begin(), S.end(), zero);
+                }
+
+                for(int cc = 0; cc < k; ++cc)
+                {
+                    for(int rr = 0; rr < k; ++rr)
+                    {
+                        H[DENSE_IND((i + 1) * k + rr, i * k + cc, nrow, ncol)] = S[rr + cc * k];
+                    }
+                }
+
+                // Reduce the new block column of H to upper triangular form
+                for(int cc = i * k; cc < (i + 1) * k; ++cc)
+                {
+                    // Apply all previous rotations
+                    for(int r = 0; r < nrot; ++r)
+                    {
+                        block_gmres_apply_givens(c[r],
+                                                 s[r],
+                                                 H[DENSE_IND(row[r] - 1, cc, nrow, ncol)],
+                                                 H[DENSE_IND(row[r], cc, nrow, ncol)]);
+                    }
+
+                    // Eliminate the sub-diagonal entries of column cc, from bottom to top.
+                    // H_i+1i is upper triangular, unless basis vectors have been replaced
+                    for(int rr = (i + 2) * k - 1; rr > cc; --rr)
+                    {
+                        ValueType& hx = H[DENSE_IND(rr - 1, cc, nrow, ncol)];
+                        ValueType& hy = H[DENSE_IND(rr, cc, nrow, ncol)];
+
+                        block_gmres_generate_givens(hx, hy, c[nrot], s[nrot]);
+                        block_gmres_apply_givens(c[nrot], s[nrot], hx, hy);
+
+                        for(int j = 0; j < k; ++j)
+                        {
+                            block_gmres_apply_givens(c[nrot],
+                                                     s[nrot],
+                                                     g[DENSE_IND(rr - 1, j, nrow, k)],
+                                                     g[DENSE_IND(rr, j, nrow, k)]);
+                        }
+
+                        row[nrot++] = rr;
+                    }
+                }
+
+                ++i;
+
+                // Least squares residual norms are the norms of the rows i*k,...,(i+1)*k-1
+                // of g
+                res_norm = 0.0;
+
+                for(int j = 0; j < k; ++j)
+                {
+                    double nrm = 0.0;
+
+                    for(int rr = i * k; rr < (i + 1) * k; ++rr)
+                    {
+                        double val = std::abs(g[DENSE_IND(rr, j, nrow, k)]);
+                        nrm += val * val;
+                    }
+
+                    res_norm = std::max(res_norm, sqrt(nrm));
+                }
+
+                // Check convergence
+                if(this->iter_ctrl_.CheckResidual(res_norm, this->index_) || breakdown == true)
+                {
+                    break;
+                }
+            }
+
+            // Solve upper triangular system H Y = g, Y is stored in g
+            int n = i * k;
+
+            for(int j = 0; j < k; ++j)
+            {
+                for(int rr = n - 1; rr >= 0; --rr)
+                {
+                    ValueType sum = g[DENSE_IND(rr, j, nrow, k)];
+
+                    for(int cc = rr + 1; cc < n; ++cc)
+                    {
+                        sum -= H[DENSE_IND(rr, cc, nrow, ncol)] * g[DENSE_IND(cc, j, nrow, k)];
+                    }
+
+                    ValueType diag = H[DENSE_IND(rr, rr, nrow, ncol)];
+
+                    // Skip directions of a (numerically) exhausted block Krylov subspace
+                    g[DENSE_IND(rr, j, nrow, k)] = (diag != zero) ? sum / diag : zero;
+                }
+            }
+
+            // Update solution X = X + M^-1 V Y
+            LocalMultiVector<ValueType>* u = (this->precond_ != NULL) ? v[size + 1] : x;
+
+            if(this->precond_ != NULL)
+            {
+                u->Zeros();
+            }
+
+            for(int j = 0; j < i; ++j)
+            {
+                for(int cc = 0; cc < k; ++cc)
+                {
+                    for(int rr = 0; rr < k; ++rr)
+                    {
+                        S[rr + cc * k] = g[DENSE_IND(j * k + rr, cc, nrow, k)];
+                    }
+                }
+
+                u->AddScale(*v[j], &S[0]);
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->ApplyPrecond_(*u, &this->z_);
+                x->AddScale(this->z_, one);
+            }
+
+            // Compute residual v_0 = B - AX
+            v[0]->CopyFrom(rhs);
+            op->ApplyAdd(*x, -one, v[0]);
+
+            v[0]->Dot(*v[0], &S[0]);
+            res_norm = block_gmres_max_norm(k, &S[0]);
+
+            // Check convergence
+            if(this->iter_ctrl_.CheckResidualNoCount(res_norm))
+            {
+                break;
+            }
+
+            // The block Krylov basis became linearly dependent, e.g. because the subspace
+            // is exhausted for some right-hand sides. Restart from the current solution,
+            // unless the breakdown occurred in the first block of the cycle.
+            if(breakdown == true && i == 1)
+            {
+                LOG_VERBOSE_INFO(2, "*** warning: BlockGMRES::SolveBlock_() breakdown, block "
+                                    "Krylov basis is linearly dependent");
+                break;
+            }
+        }
+
+        log_debug(this, "BlockGMRES::SolveBlock_()", " #*# end");
+    }
+
+    template class BlockGMRES<LocalMatrix<double>, LocalVector<double>, double>;
+    template class BlockGMRES<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BlockGMRES<LocalMatrix<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class BlockGMRES<LocalMatrix<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+} // namespace rocalution
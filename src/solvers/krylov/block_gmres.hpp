@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_BLOCK_GMRES_HPP_
+#define ROCALUTION_KRYLOV_BLOCK_GMRES_HPP_
+
+#include "../../base/local_multi_vector.hpp"
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+#include <vector>
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class BlockGMRES
+  * \brief Block Generalized Minimum Residual Method
+  * \details
+  * The Block Generalized Minimum Residual method solves sparse (non) symmetric linear
+  * systems \f$AX=B\f$ with \f$k\f$ right-hand sides simultaneously. The solution is
+  * approximated in the block Krylov subspace \f$\mathcal{K}_{m}(R_{0}, A)\f$ spanned by
+  * all right-hand sides, with minimal residual for each right-hand side. The block
+  * Krylov basis is orthonormalized with block Gram-Schmidt, followed by
+  * LocalMultiVector::Orthonormalize() of each new block. Each iteration reads
+  * the matrix only once for all right-hand sides (see LocalMatrix::Apply() for
+  * LocalMultiVector). The method is right preconditioned, where the preconditioner is
+  * applied to each right-hand side separately.
+  * \cite SAAD
+  *
+  * The number of blocks in the Krylov subspace basis can be set using SetBasisSize().
+  * The default size is 30. Convergence is checked on the largest residual norm of all
+  * right-hand sides. Only the \f$L_2\f$ norm is supported. If the block Krylov basis
+  * becomes linearly dependent, e.g. because some right-hand sides converge earlier than
+  * others, the dependent basis vectors are replaced by random vectors.
+  *
+  * \tparam OperatorType - can be LocalMatrix
+  * \tparam VectorType - can be LocalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class BlockGMRES : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        BlockGMRES();
+        ROCALUTION_EXPORT
+        virtual ~BlockGMRES();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the number of blocks of the Krylov subspace basis */
+        ROCALUTION_EXPORT
+        virtual void SetBasisSize(int size_basis);
+
+        using IterativeLinearSolver<OperatorType, VectorType, ValueType>::Solve;
+
+        /** \brief Solve \f$AX=B\f$ for all right-hand sides of \p rhs
+      * \details
+      * @param[in]
+      * rhs     multi-vector with \p k right-hand sides
+      * @param[inout]
+      * x       multi-vector with \p k initial guesses, overwritten by the solutions
+      */
+        ROCALUTION_EXPORT
+        virtual void Solve(const LocalMultiVector<ValueType>& rhs, LocalMultiVector<ValueType>* x);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        /** \brief Block solve, with or without preconditioner */
+        virtual void SolveBlock_(const LocalMultiVector<ValueType>& rhs,
+                                 LocalMultiVector<ValueType>*       x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // Allocate the block Krylov basis for num_vectors right-hand sides
+        void AllocateBlock_(int num_vectors);
+        // Free the block Krylov basis
+        void ClearBlock_(void);
+        // Apply the preconditioner to each vector of r, z = M^-1 r
+        void ApplyPrecond_(const LocalMultiVector<ValueType>& r, LocalMultiVector<ValueType>* z);
+
+        // Block Krylov basis, the last entry is used as work space
+        LocalMultiVector<ValueType>** v_;
+        LocalMultiVector<ValueType>   z_;
+
+        // Single vector buffers for the preconditioner
+        VectorType t_, u_;
+
+        int size_basis_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_BLOCK_GMRES_HPP_
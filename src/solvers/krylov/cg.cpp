@@ -125,13 +125,13 @@ namespace rocalution
         }
 
         this->r_.CloneBackend(*this->op_);
-        this->r_.Allocate("r", this->op_->GetM());
+        this->r_.AllocateUninitialized("r", this->op_->GetM());
 
         this->p_.CloneBackend(*this->op_);
-        this->p_.Allocate("p", this->op_->GetM());
+        this->p_.AllocateUninitialized("p", this->op_->GetM());
 
         this->q_.CloneBackend(*this->op_);
-        this->q_.Allocate("q", this->op_->GetM());
+        this->q_.AllocateUninitialized("q", this->op_->GetM());
 
         log_debug(this, "CG::Build()", this->build_, " #*# end");
     }
@@ -166,15 +166,15 @@ namespace rocalution
         }
 
         this->r_.CloneBackend(*this->op_);
-        this->r_.Allocate("r", this->op_->GetM());
+        this->r_.AllocateUninitialized("r", this->op_->GetM());
         this->r_.MoveToAcceleratorAsync();
 
         this->p_.CloneBackend(*this->op_);
-        this->p_.Allocate("p", this->op_->GetM());
+        this->p_.AllocateUninitialized("p", this->op_->GetM());
         this->p_.MoveToAcceleratorAsync();
 
         this->q_.CloneBackend(*this->op_);
-        this->q_.Allocate("q", this->op_->GetM());
+        this->q_.AllocateUninitialized("q", this->op_->GetM());
         this->q_.MoveToAcceleratorAsync();
 
         log_debug(this, "CG::BuildMoveToAcceleratorAsync()", this->build_, " #*# end");
@@ -308,12 +308,8 @@ namespace rocalution
         ValueType alpha, beta;
         ValueType rho, rho_old;
 
-        // Initial residual = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
-
-        // Initial residual norm |b-Ax0|
-        ValueType res_norm = this->Norm_(*r);
+        // Initial residual = b - Ax and its norm |b-Ax0|
+        ValueType res_norm = this->ResidualNorm_(rhs, *x, r);
         // Initial residual norm |b|
         //    ValueType res_norm = this->Norm_(rhs);
 
@@ -331,11 +327,8 @@ namespace rocalution
 
         while(true)
         {
-            // q=Ap
-            op->Apply(*p, q);
-
-            // alpha = rho / (p,q)
-            alpha = rho / p->DotNonConj(*q);
+            // q=Ap and alpha = rho / (p,q)
+            alpha = rho / op->ApplyDotNonConj(*p, *p, q);
 
             // x = x + alpha*p
             x->AddScale(*p, alpha);
@@ -384,12 +377,8 @@ namespace rocalution
         ValueType alpha, beta;
         ValueType rho, rho_old;
 
-        // Initial residual = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
-
-        // Initial residual norm |b-Ax0|
-        ValueType res_norm = this->Norm_(*r);
+        // Initial residual = b - Ax and its norm |b-Ax0|
+        ValueType res_norm = this->ResidualNorm_(rhs, *x, r);
         // Initial residual norm |b|
         //    ValueType res_norm = this->Norm_(rhs);
 
@@ -411,11 +400,8 @@ namespace rocalution
 
         while(true)
         {
-            // q=Ap
-            op->Apply(*p, q);
-
-            // alpha = rho / (p,q)
-            alpha = rho / p->DotNonConj(*q);
+            // q=Ap and alpha = rho / (p,q)
+            alpha = rho / op->ApplyDotNonConj(*p, *p, q);
 
             // x = x + alpha*p
             x->AddScale(*p, alpha);
@@ -258,16 +258,12 @@ namespace rocalution
         ValueType alpha, beta;
         ValueType rho, rho_old;
 
-        // initial residual = b - Ax
-        op->Apply(*x, r);
-        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        // initial residual = b - Ax and |b-Ax0|
+        ValueType res_norm = this->ResidualNorm_(rhs, *x, r);
 
         // p = r
         p->CopyFrom(*r);
 
-        // use for |b-Ax0|
-        ValueType res_norm = this->Norm_(*r);
-
         if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
         {
             log_debug(this, "CR::SolveNonPrecond_()", " #*# end");
@@ -278,11 +274,8 @@ namespace rocalution
         // use for |b|
         //  this->iter_ctrl_.InitResidual(rhs.Norm_());
 
-        // v=Ar
-        op->Apply(*r, v);
-
-        // rho = (r,v)
-        rho = r->DotNonConj(*v);
+        // v=Ar and rho = (r,v)
+        rho = op->ApplyDotNonConj(*r, *r, v);
 
         // q=Ap
         op->Apply(*p, q);
@@ -302,11 +295,8 @@ namespace rocalution
         {
             rho_old = rho;
 
-            // v=Ar
-            op->Apply(*r, v);
-
-            // rho = (r,v)
-            rho = r->DotNonConj(*v);
+            // v=Ar and rho = (r,v)
+            rho = op->ApplyDotNonConj(*r, *r, v);
 
             beta = rho / rho_old;
 
@@ -355,9 +345,8 @@ namespace rocalution
         ValueType alpha, beta;
         ValueType rho, rho_old;
 
-        // initial residual = b - Ax
-        op->Apply(*x, z);
-        z->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        // initial residual = b - Ax and |b-Ax0|
+        ValueType res_norm = this->ResidualNorm_(rhs, *x, z);
 
         // Solve Mr=z
         this->precond_->SolveZeroSol(*z, r);
@@ -368,9 +357,6 @@ namespace rocalution
         // t = z
         t->CopyFrom(*z);
 
-        // use for |b-Ax0|
-        ValueType res_norm = this->Norm_(*t);
-
         if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
         {
             log_debug(this, "CR::SolvePrecond_()", " #*# end");
@@ -381,11 +367,8 @@ namespace rocalution
         // use for |b|
         //  this->iter_ctrl_.InitResidual(rhs.Norm_());
 
-        // v=Ar
-        op->Apply(*r, v);
-
-        // rho = (r,v)
-        rho = r->DotNonConj(*v);
+        // v=Ar and rho = (r,v)
+        rho = op->ApplyDotNonConj(*r, *r, v);
 
         // q=Ap
         op->Apply(*p, q);
@@ -411,11 +394,8 @@ namespace rocalution
         {
             rho_old = rho;
 
-            // v=Ar
-            op->Apply(*r, v);
-
-            // rho = (r,v)
-            rho = r->DotNonConj(*v);
+            // v=Ar and rho = (r,v)
+            rho = op->ApplyDotNonConj(*r, *r, v);
 
             beta = rho / rho_old;
 
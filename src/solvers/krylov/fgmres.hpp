@@ -47,6 +47,10 @@ namespace rocalution
   * The Krylov subspace basis
   * size can be set using SetBasisSize(). The default size is 30.
   *
+  * The Arnoldi process uses modified Gram-Schmidt (MGS) by default. With
+  * SetOrthogonalization(CGS2), classical Gram-Schmidt with one reorthogonalization is
+  * used instead, which computes all projections of a pass with a single reduction.
+  *
   * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
   * \tparam VectorType - can be LocalVector or GlobalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
@@ -74,6 +78,10 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void SetBasisSize(int size_basis);
 
+        /** \brief Set the orthogonalization scheme of the Arnoldi process (default: MGS) */
+        ROCALUTION_EXPORT
+        void SetOrthogonalization(unsigned int orth);
+
     protected:
         virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
         virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
@@ -89,6 +97,11 @@ namespace rocalution
         /** \brief Apply Givens rotation */
         static void ApplyGivensRotation_(ValueType c, ValueType s, ValueType& dx, ValueType& dy);
 
+        /** \brief Orthogonalize v_i+1 against v_0,...,v_i and store the coefficients in
+      * column i of H
+      */
+        void Orthogonalize_(int i);
+
     private:
         VectorType** v_;
         VectorType** z_;
@@ -97,8 +110,10 @@ namespace rocalution
         ValueType* s_;
         ValueType* r_;
         ValueType* H_;
+        ValueType* t_;
 
         int size_basis_;
+        int orth_;
     };
 
 } // namespace rocalution
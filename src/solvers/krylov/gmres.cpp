@@ -49,11 +49,13 @@ namespace rocalution
         log_debug(this, "GMRES::GMRES()", "default constructor");
 
         this->size_basis_ = 30;
+        this->orth_       = MGS;
 
         this->c_ = NULL;
         this->s_ = NULL;
         this->r_ = NULL;
         this->H_ = NULL;
+        this->t_ = NULL;
         this->v_ = NULL;
     }
 
@@ -134,6 +136,11 @@ namespace rocalution
         allocate_host(this->size_basis_ + 1, &this->r_);
         allocate_host((this->size_basis_ + 1) * this->size_basis_, &this->H_);
 
+        if(this->orth_ == CGS2)
+        {
+            allocate_host(this->size_basis_, &this->t_);
+        }
+
         this->v_ = new VectorType*[this->size_basis_ + 1];
 
         for(int i = 0; i < this->size_basis_ + 1; ++i)
@@ -176,6 +183,11 @@ namespace rocalution
             free_host(&this->r_);
             free_host(&this->H_);
 
+            if(this->t_ != NULL)
+            {
+                free_host(&this->t_);
+            }
+
             for(int i = 0; i < this->size_basis_ + 1; ++i)
             {
                 this->v_[i]->Clear();
@@ -267,6 +279,74 @@ namespace rocalution
         this->size_basis_ = size_basis;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GMRES<OperatorType, VectorType, ValueType>::SetOrthogonalization(unsigned int orth)
+    {
+        log_debug(this, "GMRES:SetOrthogonalization()", orth);
+
+        assert(orth == MGS || orth == CGS2);
+        assert(this->build_ == false);
+
+        this->orth_ = orth;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GMRES<OperatorType, VectorType, ValueType>::Orthogonalize_(int i)
+    {
+        VectorType** v = this->v_;
+
+        ValueType* H = this->H_;
+
+        int size = this->size_basis_;
+
+        if(this->orth_ == CGS2)
+        {
+            ValueType* t = this->t_;
+
+            // Classical Gram-Schmidt with one reorthogonalization, every pass requires a
+            // single reduction for all projections and a single multi-vector update. The
+            // projections are computed into t, since column i of H is only contiguous for
+            // the column-major DENSE_IND.
+
+            // H_ki = <v_k,v_i+1>
+            v[i + 1]->MultiDot(i + 1, v, t);
+
+            for(int k = 0; k <= i; ++k)
+            {
+                H[DENSE_IND(k, i, size + 1, size)] = t[k];
+                t[k]                               = -t[k];
+            }
+
+            // v_i+1 -= sum(H_ki * v_k)
+            v[i + 1]->MultiAXPY(i + 1, t, v);
+
+            // Reorthogonalization, t_k = <v_k,v_i+1>
+            v[i + 1]->MultiDot(i + 1, v, t);
+
+            for(int k = 0; k <= i; ++k)
+            {
+                H[DENSE_IND(k, i, size + 1, size)] += t[k];
+                t[k] = -t[k];
+            }
+
+            // v_i+1 -= sum(t_k * v_k)
+            v[i + 1]->MultiAXPY(i + 1, t, v);
+        }
+        else
+        {
+            // Modified Gram-Schmidt
+            for(int k = 0; k <= i; ++k)
+            {
+                int ki = DENSE_IND(k, i, size + 1, size);
+
+                // H_ki = <v_k,v_i+1>
+                H[ki] = v[k]->Dot(*v[i + 1]);
+                // v_i+1 -= H_ki * v_k
+                v[i + 1]->AddScale(*v[k], -H[ki]);
+            }
+        }
+    }
+
     // GMRES implementation is based on the algorithm described in the book
     // 'Templates for the Solution of Linear Systems: Building Blocks for Iterative Methods'
     // by SIAM on page 18 and modified to fit rocalution structures.
@@ -327,14 +407,7 @@ namespace rocalution
                 op->Apply(*v[i], v[i + 1]);
 
                 // Build Hessenberg matrix H
-                for(int k = 0; k <= i; ++k)
-                {
-                    int idx = DENSE_IND(k, i, size + 1, size);
-                    // H_ki = <v_k,v_i+1>
-                    H[idx] = v[k]->Dot(*v[i + 1]);
-                    // v_i+1 -= H_ki * v_k
-                    v[i + 1]->AddScale(*v[k], -H[idx]);
-                }
+                this->Orthogonalize_(i);
 
                 // Precompute some indices
                 int ii   = DENSE_IND(i, i, size + 1, size);
@@ -381,13 +454,8 @@ namespace rocalution
                 }
             }
 
-            // Update solution
-            x->AddScale(*v[0], r[0]);
-
-            for(int j = 1; j < i; ++j)
-            {
-                x->AddScale(*v[j], r[j]);
-            }
+            // Update solution x = x + sum(r_j * v_j), j=0,...,i-1
+            x->MultiAXPY(i, r, v);
 
             // Compute residual v_0 = b - Ax
             op->Apply(*x, v[0]);
@@ -476,14 +544,7 @@ namespace rocalution
                 this->precond_->SolveZeroSol(*z, v[i + 1]);
 
                 // Build Hessenberg matrix H
-                for(int k = 0; k <= i; ++k)
-                {
-                    int idx = DENSE_IND(k, i, size + 1, size);
-                    // H_ki = <v_k,v_i+1>
-                    H[idx] = v[k]->Dot(*v[i + 1]);
-                    // v_i+1 -= H_ki * v_k
-                    v[i + 1]->AddScale(*v[k], -H[idx]);
-                }
+                this->Orthogonalize_(i);
 
                 // Precompute some indices
                 int ii   = DENSE_IND(i, i, size + 1, size);
@@ -530,13 +591,8 @@ namespace rocalution
                 }
             }
 
-            // Update solution
-            x->AddScale(*v[0], r[0]);
-
-            for(int j = 1; j < i; ++j)
-            {
-                x->AddScale(*v[j], r[j]);
-            }
+            // Update solution x = x + sum(r_j * v_j), j=0,...,i-1
+            x->MultiAXPY(i, r, v);
 
             // Compute residual z = b - Ax
             op->Apply(*x, z);
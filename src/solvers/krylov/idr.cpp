@@ -58,6 +58,7 @@ namespace rocalution
         this->c_ = NULL;
         this->f_ = NULL;
         this->M_ = NULL;
+        this->a_ = NULL;
 
         this->G_ = NULL;
         this->U_ = NULL;
@@ -138,6 +139,7 @@ namespace rocalution
         allocate_host(this->s_, &this->c_);
         allocate_host(this->s_, &this->f_);
         allocate_host(this->s_ * this->s_, &this->M_);
+        allocate_host(this->s_, &this->a_);
 
         this->G_ = new VectorType*[this->s_];
         this->U_ = new VectorType*[this->s_];
@@ -214,6 +216,7 @@ namespace rocalution
             free_host(&this->c_);
             free_host(&this->f_);
             free_host(&this->M_);
+            free_host(&this->a_);
 
             if(this->precond_ != NULL)
             {
@@ -360,6 +363,7 @@ namespace rocalution
         ValueType* c = this->c_;
         ValueType* f = this->f_;
         ValueType* M = this->M_;
+        ValueType* a = this->a_;
 
         ValueType alpha;
         ValueType beta;
@@ -396,10 +400,7 @@ namespace rocalution
         {
             // Generate rhs for small system
             // f = P^T * r
-            for(int i = 0; i < s; ++i)
-            {
-                f[i] = P[i]->Dot(*r);
-            }
+            r->MultiDot(s, P, f);
 
             // Loop over shadow spaces
             for(int k = 0; k < s; ++k)
@@ -418,15 +419,18 @@ namespace rocalution
                     }
 
                     c[i] /= M[DENSE_IND(i, i, s, s)];
-                    v->AddScale(*G[i], -c[i]);
+                    a[i] = -c[i];
                 }
 
+                // v = v - sum(c_i * G_i), i=k,...,s-1
+                v->MultiAXPY(s - k, a + k, G + k);
+
                 // U_k = omega * v + sum(c_i * U_i), i=k,...,s-1
                 U[k]->ScaleAddScale(c[k], *v, omega);
 
-                for(int i = k + 1; i < s; ++i)
+                if(k + 1 < s)
                 {
-                    U[k]->AddScale(*U[i], c[i]);
+                    U[k]->MultiAXPY(s - k - 1, c + k + 1, U + k + 1);
                 }
 
                 // G_k = A U_k
@@ -441,17 +445,18 @@ namespace rocalution
                     // G_k = G_k - alpha * G_i
                     G[k]->AddScale(*G[i], -alpha);
 
-                    // U_k = U_k - alpha * U_i
-                    U[k]->AddScale(*U[i], -alpha);
+                    a[i] = -alpha;
                 }
 
-                // Update column k of M
-                for(int i = k; i < s; ++i)
+                // U_k = U_k - sum(alpha_i * U_i), i=0,...,k-1
+                if(k > 0)
                 {
-                    // M_ik = P^T_i * G_k
-                    M[DENSE_IND(i, k, s, s)] = P[i]->Dot(*G[k]);
+                    U[k]->MultiAXPY(k, a, U);
                 }
 
+                // Update column k of M, M_ik = P^T_i * G_k, i=k,...,s-1
+                G[k]->MultiDot(s - k, P + k, M + DENSE_IND(k, k, s, s));
+
                 // Check M_kk for zero
                 if(M[DENSE_IND(k, k, s, s)] == zero)
                 {
@@ -588,6 +593,7 @@ namespace rocalution
         ValueType* c = this->c_;
         ValueType* f = this->f_;
         ValueType* M = this->M_;
+        ValueType* a = this->a_;
 
         ValueType alpha;
         ValueType beta;
@@ -624,10 +630,7 @@ namespace rocalution
         {
             // Generate rhs for small system
             // f = P^T * r
-            for(int i = 0; i < s; ++i)
-            {
-                f[i] = P[i]->Dot(*r);
-            }
+            r->MultiDot(s, P, f);
 
             // Loop over shadow spaces
             for(int k = 0; k < s; ++k)
@@ -646,18 +649,21 @@ namespace rocalution
                     }
 
                     c[i] /= M[DENSE_IND(i, i, s, s)];
-                    v->AddScale(*G[i], -c[i]);
+                    a[i] = -c[i];
                 }
 
+                // v = v - sum(c_i * G_i), i=k,...,s-1
+                v->MultiAXPY(s - k, a + k, G + k);
+
                 // Apply preconditioner Mt = v
                 this->precond_->SolveZeroSol(*v, t);
 
                 // U_k = omega * t + sum(c_i * U_i), i=k,...,s-1
                 U[k]->ScaleAddScale(c[k], *t, omega);
 
-                for(int i = k + 1; i < s; ++i)
+                if(k + 1 < s)
                 {
-                    U[k]->AddScale(*U[i], c[i]);
+                    U[k]->MultiAXPY(s - k - 1, c + k + 1, U + k + 1);
                 }
 
                 // G_k = A U_k
@@ -672,17 +678,18 @@ namespace rocalution
                     // G_k = G_k - alpha * G_i
                     G[k]->AddScale(*G[i], -alpha);
 
-                    // U_k = U_k - alpha * U_i
-                    U[k]->AddScale(*U[i], -alpha);
+                    a[i] = -alpha;
                 }
 
-                // Update column k of M
-                for(int i = k; i < s; ++i)
+                // U_k = U_k - sum(alpha_i * U_i), i=0,...,k-1
+                if(k > 0)
                 {
-                    // M_ik = P^T_i * G_k
-                    M[DENSE_IND(i, k, s, s)] = P[i]->Dot(*G[k]);
+                    U[k]->MultiAXPY(k, a, U);
                 }
 
+                // Update column k of M, M_ik = P^T_i * G_k, i=k,...,s-1
+                G[k]->MultiDot(s - k, P + k, M + DENSE_IND(k, k, s, s));
+
                 // Check M_kk for zero
                 if(M[DENSE_IND(k, k, s, s)] == zero)
                 {
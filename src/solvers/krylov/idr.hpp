@@ -95,6 +95,9 @@ namespace rocalution
         ValueType* f_;
         ValueType* M_;
 
+        // Coefficients of the fused vector updates
+        ValueType* a_;
+
         VectorType r_;
         VectorType v_;
         VectorType t_;
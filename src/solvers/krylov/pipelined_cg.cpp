@@ -0,0 +1,614 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "pipelined_cg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <complex>
+#include <limits>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    static double pipelined_cg_eps(ValueType)
+    {
+        return std::numeric_limits<ValueType>::epsilon();
+    }
+
+    template <typename ValueType>
+    static double pipelined_cg_eps(std::complex<ValueType>)
+    {
+        return std::numeric_limits<ValueType>::epsilon();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    PipelinedCG<OperatorType, VectorType, ValueType>::PipelinedCG()
+    {
+        log_debug(this, "PipelinedCG::PipelinedCG()", "default constructor");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    PipelinedCG<OperatorType, VectorType, ValueType>::~PipelinedCG()
+    {
+        log_debug(this, "PipelinedCG::~PipelinedCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("Pipelined CG solver");
+        }
+        else
+        {
+            LOG_INFO("Pipelined PCG solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("Pipelined CG (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("Pipelined PCG solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("Pipelined CG (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("Pipelined PCG ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "PipelinedCG::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->Build();
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+
+            this->m_.CloneBackend(*this->op_);
+            this->m_.Allocate("m", this->op_->GetM());
+
+            this->q_.CloneBackend(*this->op_);
+            this->q_.Allocate("q", this->op_->GetM());
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+
+        this->w_.CloneBackend(*this->op_);
+        this->w_.Allocate("w", this->op_->GetM());
+
+        this->n_.CloneBackend(*this->op_);
+        this->n_.Allocate("n", this->op_->GetM());
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", this->op_->GetM());
+
+        this->s_.CloneBackend(*this->op_);
+        this->s_.Allocate("s", this->op_->GetM());
+
+        this->z_.CloneBackend(*this->op_);
+        this->z_.Allocate("z", this->op_->GetM());
+
+        log_debug(this, "PipelinedCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "PipelinedCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->r_.Clear();
+            this->u_.Clear();
+            this->w_.Clear();
+            this->m_.Clear();
+            this->n_.Clear();
+            this->p_.Clear();
+            this->s_.Clear();
+            this->q_.Clear();
+            this->z_.Clear();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "PipelinedCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.Zeros();
+            this->u_.Zeros();
+            this->w_.Zeros();
+            this->m_.Zeros();
+            this->n_.Zeros();
+            this->p_.Zeros();
+            this->s_.Zeros();
+            this->q_.Zeros();
+            this->z_.Zeros();
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "PipelinedCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToHost();
+            this->w_.MoveToHost();
+            this->n_.MoveToHost();
+            this->p_.MoveToHost();
+            this->s_.MoveToHost();
+            this->z_.MoveToHost();
+
+            if(this->precond_ != NULL)
+            {
+                this->u_.MoveToHost();
+                this->m_.MoveToHost();
+                this->q_.MoveToHost();
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "PipelinedCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToAccelerator();
+            this->w_.MoveToAccelerator();
+            this->n_.MoveToAccelerator();
+            this->p_.MoveToAccelerator();
+            this->s_.MoveToAccelerator();
+            this->z_.MoveToAccelerator();
+
+            if(this->precond_ != NULL)
+            {
+                this->u_.MoveToAccelerator();
+                this->m_.MoveToAccelerator();
+                this->q_.MoveToAccelerator();
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                            VectorType*       x)
+    {
+        log_debug(this, "PipelinedCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ == NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* w = &this->w_;
+        VectorType* n = &this->n_;
+        VectorType* p = &this->p_;
+        VectorType* s = &this->s_;
+        VectorType* z = &this->z_;
+
+        ValueType alpha, beta;
+        ValueType gamma, delta;
+
+        ValueType alpha_old = static_cast<ValueType>(0);
+        ValueType gamma_old = static_cast<ValueType>(0);
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*r);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "PipelinedCG::SolveNonPrecond_()", " #*# end");
+            return;
+        }
+
+        // w = Ar
+        op->Apply(*r, w);
+
+        // Dot products of the fused reduction
+        const VectorType* dot_x[2] = {r, w};
+        const VectorType* dot_y[2] = {r, r};
+        ValueType         dot[2];
+
+        bool first = true;
+
+        // Residual replacement, the additional recurrences of the pipelined method
+        // propagate rounding errors, such that the recursively updated residual drifts
+        // away from the true residual b - Ax. Each time the residual norm decreased by a
+        // factor of sqrt(eps), the recursively updated vectors are recomputed explicitly.
+        double sqrt_eps    = sqrt(pipelined_cg_eps(gamma_old));
+        double res_replace = sqrt_eps * std::abs(res_norm);
+        bool   replace     = false;
+
+        while(true)
+        {
+            // gamma = (r,r), delta = (w,r), single non-blocking reduction
+            r->FusedDotAsync(2, dot_x, dot_y, dot);
+
+            // n = Aw, independent of the reduction and overlapped with it
+            op->Apply(*w, n);
+
+            r->FusedDotSync();
+
+            gamma = dot[0];
+            delta = dot[1];
+
+            // Check convergence of the previous iteration
+            if(first == false)
+            {
+                if(this->res_norm_type_ == 2)
+                {
+                    res_norm = sqrt(std::abs(gamma));
+                }
+                else
+                {
+                    res_norm = this->Norm_(*r);
+                }
+
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    break;
+                }
+
+                if(std::abs(res_norm) < res_replace)
+                {
+                    replace     = true;
+                    res_replace = sqrt_eps * std::abs(res_norm);
+                }
+            }
+
+            if(first == true)
+            {
+                alpha = gamma / delta;
+
+                // z = n, s = w, p = r
+                z->CopyFrom(*n);
+                s->CopyFrom(*w);
+                p->CopyFrom(*r);
+
+                first = false;
+            }
+            else
+            {
+                beta  = gamma / gamma_old;
+                alpha = gamma / (delta - beta * gamma / alpha_old);
+
+                // z = beta*z + n, s = beta*s + w, p = beta*p + r
+                z->ScaleAdd(beta, *n);
+                s->ScaleAdd(beta, *w);
+                p->ScaleAdd(beta, *r);
+            }
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha*s
+            r->AddScale(*s, -alpha);
+
+            // w = w - alpha*z
+            w->AddScale(*z, -alpha);
+
+            if(replace == true)
+            {
+                // r = b - Ax
+                op->Apply(*x, r);
+                r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+                // w = Ar, s = Ap, z = As
+                op->Apply(*r, w);
+                op->Apply(*p, s);
+                op->Apply(*s, z);
+
+                replace = false;
+            }
+
+            gamma_old = gamma;
+            alpha_old = alpha;
+        }
+
+        log_debug(this, "PipelinedCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void PipelinedCG<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                         VectorType*       x)
+    {
+        log_debug(this, "PipelinedCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ != NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* u = &this->u_;
+        VectorType* w = &this->w_;
+        VectorType* m = &this->m_;
+        VectorType* n = &this->n_;
+        VectorType* p = &this->p_;
+        VectorType* s = &this->s_;
+        VectorType* q = &this->q_;
+        VectorType* z = &this->z_;
+
+        ValueType alpha, beta;
+        ValueType gamma, delta;
+
+        ValueType alpha_old = static_cast<ValueType>(0);
+        ValueType gamma_old = static_cast<ValueType>(0);
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*r);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "PipelinedCG::SolvePrecond_()", " #*# end");
+            return;
+        }
+
+        // Solve Mu=r
+        this->precond_->SolveZeroSol(*r, u);
+
+        // w = Au
+        op->Apply(*u, w);
+
+        // Dot products of the fused reduction
+        const VectorType* dot_x[3] = {r, w, r};
+        const VectorType* dot_y[3] = {u, u, r};
+        ValueType         dot[3];
+
+        bool first = true;
+
+        // Residual replacement (see SolveNonPrecond_())
+        double sqrt_eps    = sqrt(pipelined_cg_eps(gamma_old));
+        double res_replace = sqrt_eps * std::abs(res_norm);
+        bool   replace     = false;
+
+        while(true)
+        {
+            // gamma = (r,u), delta = (w,u) and (r,r), single non-blocking reduction
+            r->FusedDotAsync(3, dot_x, dot_y, dot);
+
+            // Solve Mm=w and n = Am, independent of the reduction and overlapped with it
+            this->precond_->SolveZeroSol(*w, m);
+            op->Apply(*m, n);
+
+            r->FusedDotSync();
+
+            gamma = dot[0];
+            delta = dot[1];
+
+            // Check convergence of the previous iteration
+            if(first == false)
+            {
+                if(this->res_norm_type_ == 2)
+                {
+                    res_norm = sqrt(std::abs(dot[2]));
+                }
+                else
+                {
+                    res_norm = this->Norm_(*r);
+                }
+
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    break;
+                }
+
+                if(std::abs(res_norm) < res_replace)
+                {
+                    replace     = true;
+                    res_replace = sqrt_eps * std::abs(res_norm);
+                }
+            }
+
+            if(first == true)
+            {
+                alpha = gamma / delta;
+
+                // z = n, q = m, s = w, p = u
+                z->CopyFrom(*n);
+                q->CopyFrom(*m);
+                s->CopyFrom(*w);
+                p->CopyFrom(*u);
+
+                first = false;
+            }
+            else
+            {
+                beta  = gamma / gamma_old;
+                alpha = gamma / (delta - beta * gamma / alpha_old);
+
+                // z = beta*z + n, q = beta*q + m, s = beta*s + w, p = beta*p + u
+                z->ScaleAdd(beta, *n);
+                q->ScaleAdd(beta, *m);
+                s->ScaleAdd(beta, *w);
+                p->ScaleAdd(beta, *u);
+            }
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha*s
+            r->AddScale(*s, -alpha);
+
+            // u = u - alpha*q
+            u->AddScale(*q, -alpha);
+
+            // w = w - alpha*z
+            w->AddScale(*z, -alpha);
+
+            if(replace == true)
+            {
+                // r = b - Ax
+                op->Apply(*x, r);
+                r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+                // Solve Mu=r and w = Au
+                this->precond_->SolveZeroSol(*r, u);
+                op->Apply(*u, w);
+
+                // s = Ap, solve Mq=s and z = Aq
+                op->Apply(*p, s);
+                this->precond_->SolveZeroSol(*s, q);
+                op->Apply(*q, z);
+
+                replace = false;
+            }
+
+            gamma_old = gamma;
+            alpha_old = alpha;
+        }
+
+        log_debug(this, "PipelinedCG::SolvePrecond_()", " #*# end");
+    }
+
+    template class PipelinedCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class PipelinedCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipelinedCG<LocalMatrix<std::complex<double>>,
+                               LocalVector<std::complex<double>>,
+                               std::complex<double>>;
+    template class PipelinedCG<LocalMatrix<std::complex<float>>,
+                               LocalVector<std::complex<float>>,
+                               std::complex<float>>;
+#endif
+
+    template class PipelinedCG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class PipelinedCG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipelinedCG<GlobalMatrix<std::complex<double>>,
+                               GlobalVector<std::complex<double>>,
+                               std::complex<double>>;
+    template class PipelinedCG<GlobalMatrix<std::complex<float>>,
+                               GlobalVector<std::complex<float>>,
+                               std::complex<float>>;
+#endif
+
+    template class PipelinedCG<LocalStencil<double>, LocalVector<double>, double>;
+    template class PipelinedCG<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class PipelinedCG<LocalStencil<std::complex<double>>,
+                               LocalVector<std::complex<double>>,
+                               std::complex<double>>;
+    template class PipelinedCG<LocalStencil<std::complex<float>>,
+                               LocalVector<std::complex<float>>,
+                               std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_PIPELINED_CG_HPP_
+#define ROCALUTION_KRYLOV_PIPELINED_CG_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class PipelinedCG
+  * \brief Pipelined Conjugate Gradient Method
+  * \details
+  * The Pipelined Conjugate Gradient method by Ghysels and Vanroose is a rearrangement
+  * of the (preconditioned) Conjugate Gradient method for sparse symmetric positive
+  * definite (SPD) linear systems \f$Ax=b\f$. Classical CG performs two to three separate
+  * global reductions per iteration. The pipelined variant computes all dot products of
+  * an iteration, including the residual norm, in a single fused reduction (see
+  * LocalVector::FusedDot() and GlobalVector::FusedDot()). The preconditioner and the
+  * matrix-vector product of the iteration do not depend on the result of this
+  * reduction. It is therefore started as a non-blocking reduction before them (see
+  * GlobalVector::FusedDotAsync()), such that its latency is hidden behind them. This
+  * comes at the cost of additional vector updates and memory for four auxiliary
+  * vectors, which makes the method attractive when the global reductions dominate the
+  * cost of an iteration, e.g. for small local problems on many processes.
+  *
+  * The additional recurrences of the pipelined method propagate rounding errors, which
+  * limits the attainable accuracy compared to CG, in particular in single precision.
+  * Therefore, the residual and all auxiliary vectors are recomputed explicitly each time
+  * the residual norm decreased by a factor of \f$\sqrt{\epsilon}\f$ (residual
+  * replacement). Convergence of the \f$L_2\f$ residual norm is checked without
+  * additional reductions, other norms require a separate reduction.
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class PipelinedCG : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        PipelinedCG();
+        ROCALUTION_EXPORT
+        virtual ~PipelinedCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        VectorType r_, u_, w_;
+        VectorType m_, n_;
+        VectorType p_, s_, q_, z_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_PIPELINED_CG_HPP_
@@ -0,0 +1,639 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "sstep_cg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    // Compute the quadratic form a^H G b of the n x n matrix G
+    template <typename ValueType>
+    static ValueType
+        sstep_cg_form(int n, const ValueType* a, const ValueType* G, const ValueType* b)
+    {
+        ValueType sum = static_cast<ValueType>(0);
+
+        for(int j = 0; j < n; ++j)
+        {
+            if(b[j] == static_cast<ValueType>(0))
+            {
+                continue;
+            }
+
+            ValueType col = static_cast<ValueType>(0);
+
+            for(int i = 0; i < n; ++i)
+            {
+                col += rocalution_conj(a[i]) * G[DENSE_IND(i, j, n, n)];
+            }
+
+            sum += col * b[j];
+        }
+
+        return sum;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SStepCG<OperatorType, VectorType, ValueType>::SStepCG()
+    {
+        log_debug(this, "SStepCG::SStepCG()", "default constructor");
+
+        this->step_ = 4;
+
+        this->y_ = NULL;
+        this->w_ = NULL;
+
+        this->G_  = NULL;
+        this->Gr_ = NULL;
+        this->cp_ = NULL;
+        this->cz_ = NULL;
+        this->cx_ = NULL;
+        this->bp_ = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SStepCG<OperatorType, VectorType, ValueType>::~SStepCG()
+    {
+        log_debug(this, "SStepCG::~SStepCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("s-step CG solver, s=" << this->step_);
+        }
+        else
+        {
+            LOG_INFO("s-step PCG solver, s=" << this->step_ << ", with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("s-step CG(" << this->step_ << ") (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("s-step PCG(" << this->step_ << ") solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("s-step CG(" << this->step_ << ") (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("s-step PCG(" << this->step_ << ") ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "SStepCG::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+        assert(this->step_ > 0);
+
+        if(this->res_norm_type_ != 2)
+        {
+            LOG_INFO("s-step CG solver supports only L2 residual norm. The solver is switching "
+                     "to L2 norm");
+            this->res_norm_type_ = 2;
+        }
+
+        // Size of the Krylov bases
+        int nb = 2 * this->step_ + 1;
+
+        this->y_ = new VectorType*[nb + 2];
+
+        for(int i = 0; i < nb + 2; ++i)
+        {
+            this->y_[i] = new VectorType;
+            this->y_[i]->CloneBackend(*this->op_);
+            this->y_[i]->Allocate("y", this->op_->GetM());
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+
+            this->w_ = new VectorType*[nb + 2];
+
+            for(int i = 0; i < nb + 2; ++i)
+            {
+                this->w_[i] = new VectorType;
+                this->w_[i]->CloneBackend(*this->op_);
+                this->w_[i]->Allocate("w", this->op_->GetM());
+            }
+
+            allocate_host(nb * nb, &this->Gr_);
+        }
+        else
+        {
+            this->w_ = this->y_;
+        }
+
+        allocate_host(nb * nb, &this->G_);
+        allocate_host(nb, &this->cp_);
+        allocate_host(nb, &this->cz_);
+        allocate_host(nb, &this->cx_);
+        allocate_host(nb, &this->bp_);
+
+        this->build_ = true;
+
+        log_debug(this, "SStepCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "SStepCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            int nb = 2 * this->step_ + 1;
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < nb + 2; ++i)
+                {
+                    this->w_[i]->Clear();
+                    delete this->w_[i];
+                }
+                delete[] this->w_;
+
+                free_host(&this->Gr_);
+
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->w_ = NULL;
+
+            for(int i = 0; i < nb + 2; ++i)
+            {
+                this->y_[i]->Clear();
+                delete this->y_[i];
+            }
+            delete[] this->y_;
+            this->y_ = NULL;
+
+            free_host(&this->G_);
+            free_host(&this->cp_);
+            free_host(&this->cz_);
+            free_host(&this->cx_);
+            free_host(&this->bp_);
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "SStepCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            int nb = 2 * this->step_ + 1;
+
+            for(int i = 0; i < nb + 2; ++i)
+            {
+                this->y_[i]->Zeros();
+            }
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < nb + 2; ++i)
+                {
+                    this->w_[i]->Zeros();
+                }
+
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "SStepCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            int nb = 2 * this->step_ + 1;
+
+            for(int i = 0; i < nb + 2; ++i)
+            {
+                this->y_[i]->MoveToHost();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < nb + 2; ++i)
+                {
+                    this->w_[i]->MoveToHost();
+                }
+
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "SStepCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            int nb = 2 * this->step_ + 1;
+
+            for(int i = 0; i < nb + 2; ++i)
+            {
+                this->y_[i]->MoveToAccelerator();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < nb + 2; ++i)
+                {
+                    this->w_[i]->MoveToAccelerator();
+                }
+
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::SetStepSize(int s)
+    {
+        log_debug(this, "SStepCG::SetStepSize()", s);
+
+        assert(s > 0);
+        assert(this->build_ == false);
+
+        this->step_ = s;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "SStepCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        this->SolveSStep_(rhs, x);
+
+        log_debug(this, "SStepCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                     VectorType*       x)
+    {
+        log_debug(this, "SStepCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        this->SolveSStep_(rhs, x);
+
+        log_debug(this, "SStepCG::SolvePrecond_()", " #*# end");
+    }
+
+    // The s-step CG implementation follows the communication-avoiding CG method described
+    // in E. Carson, 'Communication-Avoiding Krylov Subspace Methods in Theory and Practice',
+    // PhD thesis, UC Berkeley, 2015, with monomial bases. For preconditioning, the vector
+    // Mp is updated by the same recurrence as p, such that M itself is never needed.
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::SolveSStep_(const VectorType& rhs,
+                                                                   VectorType*       x)
+    {
+        log_debug(this, "SStepCG::SolveSStep_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(this->res_norm_type_ == 2);
+
+        const OperatorType* op = this->op_;
+
+        bool precond = (this->precond_ != NULL);
+
+        int s  = this->step_;
+        int nb = 2 * s + 1;
+
+        // y = [p, ..., (M^-1 A)^s p, z, ..., (M^-1 A)^(s-1) z, work]
+        // w = [Mp, ..., A (M^-1 A)^(s-1) p, r, ..., A (M^-1 A)^(s-2) z, work]
+        VectorType** y = this->y_;
+        VectorType** w = this->w_;
+
+        ValueType* G  = this->G_;
+        ValueType* Gr = precond ? this->Gr_ : this->G_;
+        ValueType* cp = this->cp_;
+        ValueType* cz = this->cz_;
+        ValueType* cx = this->cx_;
+        ValueType* bp = this->bp_;
+
+        ValueType one = static_cast<ValueType>(1);
+
+        // Initial residual r = b - Ax
+        op->Apply(*x, w[s + 1]);
+        w[s + 1]->ScaleAdd(-one, rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*w[s + 1]);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "SStepCG::SolveSStep_()", " #*# end");
+            return;
+        }
+
+        if(precond == true)
+        {
+            // Solve Mz=r, p = z, Mp = r
+            this->precond_->SolveZeroSol(*w[s + 1], y[s + 1]);
+            y[0]->CopyFrom(*y[s + 1]);
+            w[0]->CopyFrom(*w[s + 1]);
+        }
+        else
+        {
+            // p = r
+            y[0]->CopyFrom(*y[s + 1]);
+        }
+
+        // Pairs of the fused Gram matrix reduction, upper triangular parts only
+        int ndot = nb * (nb + 1) / 2;
+
+        std::vector<const VectorType*> dot_x(precond ? 2 * ndot : ndot);
+        std::vector<const VectorType*> dot_y(precond ? 2 * ndot : ndot);
+        std::vector<ValueType>         dot(precond ? 2 * ndot : ndot);
+
+        while(true)
+        {
+            // Krylov bases, no reductions required
+            if(precond == true)
+            {
+                for(int i = 0; i < s; ++i)
+                {
+                    // w_i+1 = A y_i, solve M y_i+1 = w_i+1
+                    op->Apply(*y[i], w[i + 1]);
+                    this->precond_->SolveZeroSol(*w[i + 1], y[i + 1]);
+                }
+
+                for(int i = s + 1; i < nb - 1; ++i)
+                {
+                    op->Apply(*y[i], w[i + 1]);
+                    this->precond_->SolveZeroSol(*w[i + 1], y[i + 1]);
+                }
+            }
+            else
+            {
+                // Monomial bases by the matrix powers kernel
+                op->MatrixPowers(*y[0], s, NULL, &y[1]);
+                op->MatrixPowers(*y[s + 1], s - 1, NULL, &y[s + 2]);
+            }
+
+            // Gram matrices G = y^H w = y^H M y and Gr = w^H w, single reduction
+            int idx = 0;
+
+            for(int j = 0; j < nb; ++j)
+            {
+                for(int i = 0; i <= j; ++i)
+                {
+                    dot_x[idx] = y[i];
+                    dot_y[idx] = w[j];
+
+                    if(precond == true)
+                    {
+                        dot_x[ndot + idx] = w[i];
+                        dot_y[ndot + idx] = w[j];
+                    }
+
+                    ++idx;
+                }
+            }
+
+            w[0]->FusedDot(static_cast<int>(dot.size()), &dot_x[0], &dot_y[0], &dot[0]);
+
+            idx = 0;
+
+            for(int j = 0; j < nb; ++j)
+            {
+                for(int i = 0; i <= j; ++i)
+                {
+                    G[DENSE_IND(i, j, nb, nb)] = dot[idx];
+                    G[DENSE_IND(j, i, nb, nb)] = rocalution_conj(dot[idx]);
+
+                    if(precond == true)
+                    {
+                        Gr[DENSE_IND(i, j, nb, nb)] = dot[ndot + idx];
+                        Gr[DENSE_IND(j, i, nb, nb)] = rocalution_conj(dot[ndot + idx]);
+                    }
+
+                    ++idx;
+                }
+            }
+
+            // Coefficients of p, z and the update of x with respect to y
+            set_to_zero_host(nb, cp);
+            set_to_zero_host(nb, cz);
+            set_to_zero_host(nb, cx);
+
+            cp[0]     = one;
+            cz[s + 1] = one;
+
+            // rho = (r,z)
+            ValueType rho = sstep_cg_form(nb, cz, G, cz);
+
+            bool converged = false;
+
+            // s CG iterations on the coefficient vectors
+            for(int k = 0; k < s; ++k)
+            {
+                // Coefficients of M^-1 A p, the bases are shifted by one
+                set_to_zero_host(nb, bp);
+
+                for(int i = 0; i < s; ++i)
+                {
+                    bp[i + 1] = cp[i];
+                }
+
+                for(int i = s + 1; i < nb - 1; ++i)
+                {
+                    bp[i + 1] = cp[i];
+                }
+
+                // alpha = (r,z) / (Ap,p)
+                ValueType alpha = rho / sstep_cg_form(nb, cp, G, bp);
+
+                // x = x + alpha * p, z = z - alpha * M^-1 A p
+                for(int i = 0; i < nb; ++i)
+                {
+                    cx[i] += alpha * cp[i];
+                    cz[i] -= alpha * bp[i];
+                }
+
+                ValueType rho_old = rho;
+
+                rho = sstep_cg_form(nb, cz, G, cz);
+
+                // Residual norm from the Gram matrix
+                res_norm = sqrt(std::abs(sstep_cg_form(nb, cz, Gr, cz)));
+
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    converged = true;
+                    break;
+                }
+
+                // p = z + beta * p
+                ValueType beta = rho / rho_old;
+
+                for(int i = 0; i < nb; ++i)
+                {
+                    cp[i] = cz[i] + beta * cp[i];
+                }
+            }
+
+            // x = x + y cx
+            x->MultiAXPY(nb, cx, y);
+
+            if(converged == true)
+            {
+                break;
+            }
+
+            // p = y cp and z = y cz, the bases are overwritten in the next iteration
+            y[nb]->Zeros();
+            y[nb]->MultiAXPY(nb, cp, y);
+            y[nb + 1]->Zeros();
+            y[nb + 1]->MultiAXPY(nb, cz, y);
+
+            if(precond == true)
+            {
+                // Mp = w cp and r = w cz
+                w[nb]->Zeros();
+                w[nb]->MultiAXPY(nb, cp, w);
+                w[nb + 1]->Zeros();
+                w[nb + 1]->MultiAXPY(nb, cz, w);
+
+                std::swap(w[0], w[nb]);
+                std::swap(w[s + 1], w[nb + 1]);
+            }
+
+            std::swap(y[0], y[nb]);
+            std::swap(y[s + 1], y[nb + 1]);
+        }
+
+        log_debug(this, "SStepCG::SolveSStep_()", " #*# end");
+    }
+
+    template class SStepCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class SStepCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepCG<LocalMatrix<std::complex<double>>,
+                           LocalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class SStepCG<LocalMatrix<std::complex<float>>,
+                           LocalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+    template class SStepCG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class SStepCG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepCG<GlobalMatrix<std::complex<double>>,
+                           GlobalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class SStepCG<GlobalMatrix<std::complex<float>>,
+                           GlobalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+    template class SStepCG<LocalStencil<double>, LocalVector<double>, double>;
+    template class SStepCG<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepCG<LocalStencil<std::complex<double>>,
+                           LocalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class SStepCG<LocalStencil<std::complex<float>>,
+                           LocalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_SSTEP_CG_HPP_
+#define ROCALUTION_KRYLOV_SSTEP_CG_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class SStepCG
+  * \brief s-step (Communication-Avoiding) Conjugate Gradient Method
+  * \details
+  * The s-step Conjugate Gradient method is a reformulation of the (preconditioned)
+  * Conjugate Gradient method for sparse symmetric positive definite (SPD) linear systems
+  * \f$Ax=b\f$, that performs \f$s\f$ iterations per global synchronization. At the
+  * beginning of each outer iteration, the Krylov bases
+  * \f$[p, (M^{-1}A)p, \dots, (M^{-1}A)^{s}p]\f$ and
+  * \f$[z, (M^{-1}A)z, \dots, (M^{-1}A)^{s-1}z]\f$ are generated by repeated matrix-vector
+  * products, without any reduction. Their Gram matrix is then computed with a single fused
+  * reduction (see LocalVector::FusedDot() and GlobalVector::FusedDot()), such that the
+  * next \f$s\f$ CG iterations, including the residual norms, are carried out on small
+  * coefficient vectors only.
+  *
+  * This reduces the number of global reductions by a factor of \f$s\f$ compared to CG, at
+  * the cost of about twice as many matrix-vector products and preconditioner
+  * applications. The monomial Krylov basis becomes ill-conditioned quickly, therefore
+  * \f$s\f$ should be kept small. It can be set using SetStepSize(), the default is 4.
+  * Only the \f$L_2\f$ residual norm is supported.
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class SStepCG : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        SStepCG();
+        ROCALUTION_EXPORT
+        virtual ~SStepCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the number of iterations s per global reduction */
+        ROCALUTION_EXPORT
+        void SetStepSize(int s);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        /** \brief s-step solve, with or without preconditioner */
+        void SolveSStep_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // Krylov bases [p, ..., (M^-1 A)^s p, z, ..., (M^-1 A)^(s-1) z] followed by two
+        // work vectors
+        VectorType** y_;
+        // M times the Krylov bases, i.e. [Mp, Ap, ..., r, Az, ...], aliases y_ if no
+        // preconditioner is used
+        VectorType** w_;
+
+        // Gram matrices y^H w and w^H w
+        ValueType* G_;
+        ValueType* Gr_;
+
+        // Coefficient vectors of p, z and x with respect to the Krylov bases
+        ValueType* cp_;
+        ValueType* cz_;
+        ValueType* cx_;
+        ValueType* bp_;
+
+        int step_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_SSTEP_CG_HPP_
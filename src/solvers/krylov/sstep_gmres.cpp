@@ -0,0 +1,808 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "sstep_gmres.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    // Machine precision of the underlying real type
+    template <typename ValueType>
+    static double sstep_gmres_eps(ValueType)
+    {
+        return std::numeric_limits<ValueType>::epsilon();
+    }
+
+    template <typename ValueType>
+    static double sstep_gmres_eps(std::complex<ValueType>)
+    {
+        return std::numeric_limits<ValueType>::epsilon();
+    }
+
+    // Generate the Givens rotation [c s; -conj(s) c] with real c, that eliminates dy
+    template <typename ValueType>
+    static void sstep_gmres_generate_givens(ValueType dx, ValueType dy, ValueType& c, ValueType& s)
+    {
+        double ax = std::abs(dx);
+        double ay = std::abs(dy);
+
+        if(ay == 0.0)
+        {
+            c = static_cast<ValueType>(1);
+            s = static_cast<ValueType>(0);
+        }
+        else if(ax == 0.0)
+        {
+            c = static_cast<ValueType>(0);
+            s = rocalution_conj(dy) / static_cast<ValueType>(ay);
+        }
+        else
+        {
+            double nrm = sqrt(ax * ax + ay * ay);
+
+            c = static_cast<ValueType>(ax / nrm);
+            s = (dx / static_cast<ValueType>(ax)) * rocalution_conj(dy)
+                / static_cast<ValueType>(nrm);
+        }
+    }
+
+    // Apply the Givens rotation [c s; -conj(s) c] to (dx, dy)
+    template <typename ValueType>
+    static void sstep_gmres_apply_givens(ValueType c, ValueType s, ValueType& dx, ValueType& dy)
+    {
+        ValueType temp = dx;
+        dx             = c * dx + s * dy;
+        dy             = -rocalution_conj(s) * temp + c * dy;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SStepGMRES<OperatorType, VectorType, ValueType>::SStepGMRES()
+    {
+        log_debug(this, "SStepGMRES::SStepGMRES()", "default constructor");
+
+        this->size_basis_ = 30;
+        this->step_       = 4;
+
+        this->c_  = NULL;
+        this->s_  = NULL;
+        this->r_  = NULL;
+        this->H_  = NULL;
+        this->Hu_ = NULL;
+        this->C_  = NULL;
+        this->R_  = NULL;
+        this->t_  = NULL;
+        this->v_  = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SStepGMRES<OperatorType, VectorType, ValueType>::~SStepGMRES()
+    {
+        log_debug(this, "SStepGMRES::~SStepGMRES()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("s-step GMRES solver, s=" << this->step_);
+        }
+        else
+        {
+            LOG_INFO("s-step GMRES solver, s=" << this->step_ << ", with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("s-step GMRES(" << this->size_basis_ << "," << this->step_
+                                     << ") (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("s-step GMRES(" << this->size_basis_ << "," << this->step_
+                                     << ") solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("s-step GMRES(" << this->size_basis_ << "," << this->step_
+                                     << ") (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("s-step GMRES(" << this->size_basis_ << "," << this->step_ << ") ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "SStepGMRES::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() > 0);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->size_basis_ > 0);
+        assert(this->step_ > 0);
+
+        if(this->res_norm_type_ != 2)
+        {
+            LOG_INFO("s-step GMRES solver supports only L2 residual norm. The solver is "
+                     "switching to L2 norm");
+            this->res_norm_type_ = 2;
+        }
+
+        int size = this->size_basis_;
+        int s    = std::min(this->step_, size);
+
+        allocate_host(size, &this->c_);
+        allocate_host(size, &this->s_);
+        allocate_host(size + 1, &this->r_);
+        allocate_host((size + 1) * size, &this->H_);
+        allocate_host((size + 1) * size, &this->Hu_);
+        allocate_host(2 * (size + 1) * s, &this->C_);
+        allocate_host(2 * s * s, &this->R_);
+        allocate_host(size + 1, &this->t_);
+
+        this->v_ = new VectorType*[size + 1];
+
+        for(int i = 0; i < size + 1; ++i)
+        {
+            this->v_[i] = new VectorType;
+            this->v_[i]->CloneBackend(*this->op_);
+            this->v_[i]->Allocate("v", this->op_->GetM());
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->z_.CloneBackend(*this->op_);
+            this->z_.Allocate("z", this->op_->GetM());
+
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+        }
+
+        this->build_ = true;
+
+        log_debug(this, "SStepGMRES::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "SStepGMRES::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->z_.Clear();
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            free_host(&this->c_);
+            free_host(&this->s_);
+            free_host(&this->r_);
+            free_host(&this->H_);
+            free_host(&this->Hu_);
+            free_host(&this->C_);
+            free_host(&this->R_);
+            free_host(&this->t_);
+
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->Clear();
+                delete this->v_[i];
+            }
+            delete[] this->v_;
+            this->v_ = NULL;
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "SStepGMRES::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->Zeros();
+            }
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.Zeros();
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "SStepGMRES::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->MoveToHost();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.MoveToHost();
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "SStepGMRES::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->MoveToAccelerator();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.MoveToAccelerator();
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SetBasisSize(int size_basis)
+    {
+        log_debug(this, "SStepGMRES::SetBasisSize()", size_basis);
+
+        assert(size_basis > 0);
+        assert(this->build_ == false);
+
+        this->size_basis_ = size_basis;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SetStepSize(int s)
+    {
+        log_debug(this, "SStepGMRES::SetStepSize()", s);
+
+        assert(s > 0);
+        assert(this->build_ == false);
+
+        this->step_ = s;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                           VectorType*       x)
+    {
+        log_debug(this, "SStepGMRES::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        this->SolveSStep_(rhs, x);
+
+        log_debug(this, "SStepGMRES::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "SStepGMRES::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        this->SolveSStep_(rhs, x);
+
+        log_debug(this, "SStepGMRES::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    int SStepGMRES<OperatorType, VectorType, ValueType>::OrthogonalizeBlock_(int        i,
+                                                                             int        nb,
+                                                                             ValueType* C,
+                                                                             ValueType* R)
+    {
+        VectorType** v = this->v_;
+
+        int ld = this->size_basis_ + 1;
+        int s  = std::min(this->step_, this->size_basis_);
+
+        // Projections C = V^H W and block Gram matrix W^H W (upper triangular part) in a
+        // single reduction
+        int nproj = (i + 1) * nb;
+        int ndot  = nproj + nb * (nb + 1) / 2;
+
+        std::vector<const VectorType*> dot_x(ndot);
+        std::vector<const VectorType*> dot_y(ndot);
+        std::vector<ValueType>         dot(ndot);
+
+        int idx = 0;
+
+        for(int c = 0; c < nb; ++c)
+        {
+            for(int k = 0; k <= i; ++k)
+            {
+                dot_x[idx] = v[k];
+                dot_y[idx] = v[i + 1 + c];
+                ++idx;
+            }
+        }
+
+        for(int c = 0; c < nb; ++c)
+        {
+            for(int l = 0; l <= c; ++l)
+            {
+                dot_x[idx] = v[i + 1 + l];
+                dot_y[idx] = v[i + 1 + c];
+                ++idx;
+            }
+        }
+
+        v[0]->FusedDot(ndot, &dot_x[0], &dot_y[0], &dot[0]);
+
+        for(int c = 0; c < nb; ++c)
+        {
+            for(int k = 0; k <= i; ++k)
+            {
+                C[k + c * ld] = dot[k + c * (i + 1)];
+            }
+        }
+
+        // Cholesky factorization R^H R = W^H W - C^H C of the projected block
+        for(int c = 0; c < s * s; ++c)
+        {
+            R[c] = static_cast<ValueType>(0);
+        }
+
+        double tol  = 10.0 * (i + 1 + nb) * sstep_gmres_eps(R[0]);
+        int    rank = nb;
+
+        idx = nproj;
+
+        for(int c = 0; c < nb; ++c)
+        {
+            for(int l = 0; l <= c; ++l)
+            {
+                ValueType val = dot[idx++];
+
+                for(int k = 0; k <= i; ++k)
+                {
+                    val -= rocalution_conj(C[k + l * ld]) * C[k + c * ld];
+                }
+
+                for(int m = 0; m < l; ++m)
+                {
+                    val -= rocalution_conj(R[m + l * s]) * R[m + c * s];
+                }
+
+                if(l < c)
+                {
+                    R[l + c * s] = val / R[l + l * s];
+                }
+                else
+                {
+                    // Numerically dependent column, truncate the block
+                    double nrm2 = std::abs(dot[idx - 1]);
+                    double diag = std::real(val);
+
+                    if(!(diag > tol * nrm2))
+                    {
+                        rank = c;
+                        break;
+                    }
+
+                    R[c + c * s] = static_cast<ValueType>(sqrt(diag));
+                }
+            }
+
+            if(rank < nb)
+            {
+                break;
+            }
+        }
+
+        // q_i+1+c = (w_c - V C(:,c) - [q_i+1,...,q_i+c] R(0:c-1,c)) / R(c,c)
+        ValueType* t = this->t_;
+
+        for(int c = 0; c < rank; ++c)
+        {
+            for(int k = 0; k <= i; ++k)
+            {
+                t[k] = -C[k + c * ld];
+            }
+
+            for(int l = 0; l < c; ++l)
+            {
+                t[i + 1 + l] = -R[l + c * s];
+            }
+
+            v[i + 1 + c]->MultiAXPY(i + 1 + c, t, v);
+            v[i + 1 + c]->Scale(static_cast<ValueType>(1) / R[c + c * s]);
+        }
+
+        return rank;
+    }
+
+    // The s-step GMRES implementation follows the communication-avoiding GMRES method
+    // described in M. Hoemmen, 'Communication-avoiding Krylov subspace methods', PhD
+    // thesis, UC Berkeley, 2010, with monomial bases and block classical Gram-Schmidt with
+    // reorthogonalization.
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SolveSStep_(const VectorType& rhs,
+                                                                      VectorType*       x)
+    {
+        log_debug(this, "SStepGMRES::SolveSStep_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(this->size_basis_ > 0);
+        assert(this->res_norm_type_ == 2);
+
+        const OperatorType* op = this->op_;
+
+        bool precond = (this->precond_ != NULL);
+
+        VectorType*  z = &this->z_;
+        VectorType** v = this->v_;
+
+        ValueType* c  = this->c_;
+        ValueType* s  = this->s_;
+        ValueType* r  = this->r_;
+        ValueType* H  = this->H_;
+        ValueType* Hu = this->Hu_;
+
+        ValueType zero = static_cast<ValueType>(0);
+        ValueType one  = static_cast<ValueType>(1);
+
+        int size = this->size_basis_;
+        int ld   = size + 1;
+        int step = std::min(this->step_, size);
+
+        // Coefficients of both orthogonalization passes
+        ValueType* C1 = this->C_;
+        ValueType* C2 = this->C_ + ld * step;
+        ValueType* R1 = this->R_;
+        ValueType* R2 = this->R_ + step * step;
+
+        // Initial residual
+        if(precond == true)
+        {
+            // Solve Mv_0 = b - Ax
+            op->Apply(*x, z);
+            z->ScaleAdd(-one, rhs);
+            this->precond_->SolveZeroSol(*z, v[0]);
+        }
+        else
+        {
+            op->Apply(*x, v[0]);
+            v[0]->ScaleAdd(-one, rhs);
+        }
+
+        // r = 0
+        set_to_zero_host(size + 1, r);
+
+        // r_0 = ||v_0||
+        r[0] = this->Norm_(*v[0]);
+
+        // Initial residual
+        if(this->iter_ctrl_.InitResidual(std::abs(r[0])) == false)
+        {
+            log_debug(this, "SStepGMRES::SolveSStep_()", " #*# end");
+            return;
+        }
+
+        while(true)
+        {
+            // Normalize v_0
+            v[0]->Scale(one / r[0]);
+
+            // Number of Arnoldi steps
+            int  i         = 0;
+            bool converged = false;
+
+            while(i < size)
+            {
+                int nb = std::min(step, size - i);
+
+                // v_i+k = (M^-1 A)^k v_i, k = 1,...,nb, no reductions required
+                if(precond == true)
+                {
+                    for(int k = 1; k <= nb; ++k)
+                    {
+                        op->Apply(*v[i + k - 1], z);
+                        this->precond_->SolveZeroSol(*z, v[i + k]);
+                    }
+                }
+                else
+                {
+                    op->MatrixPowers(*v[i], nb, NULL, &v[i + 1]);
+                }
+
+                // Block classical Gram-Schmidt with reorthogonalization
+                int rank = this->OrthogonalizeBlock_(i, nb, C1, R1);
+
+                if(rank > 0)
+                {
+                    rank = this->OrthogonalizeBlock_(i, rank, C2, R2);
+
+                    // Combine both passes, C1 = C1 + C2 R1 and R1 = R2 R1
+                    for(int col = 0; col < rank; ++col)
+                    {
+                        for(int l = 0; l <= col; ++l)
+                        {
+                            for(int k = 0; k <= i; ++k)
+                            {
+                                C1[k + col * ld] += C2[k + l * ld] * R1[l + col * step];
+                            }
+                        }
+
+                        for(int l = 0; l <= col; ++l)
+                        {
+                            ValueType sum = zero;
+
+                            for(int m = l; m <= col; ++m)
+                            {
+                                sum += R2[l + m * step] * R1[m + col * step];
+                            }
+
+                            R1[l + col * step] = sum;
+                        }
+                    }
+                }
+                else
+                {
+                    // A v_i lies in the span of v_0,...,v_i (lucky breakdown)
+                    R1[0] = zero;
+                }
+
+                // Hessenberg columns i,...,i+ncol-1 from the relation
+                // A v_i+col = (w_col+1 - V C1(:,col-1) - ...) / R1(col-1,col-1)
+                int ncol = std::max(rank, 1);
+
+                for(int col = 0; col < ncol; ++col)
+                {
+                    int j = i + col;
+
+                    ValueType* hu = &Hu[DENSE_IND(0, j, size + 1, size)];
+                    ValueType* h  = &H[DENSE_IND(0, j, size + 1, size)];
+
+                    set_to_zero_host(size + 1, hu);
+
+                    for(int k = 0; k <= i; ++k)
+                    {
+                        hu[k] = C1[k + col * ld];
+                    }
+
+                    for(int l = 0; l <= col; ++l)
+                    {
+                        hu[i + 1 + l] = R1[l + col * step];
+                    }
+
+                    if(col > 0)
+                    {
+                        for(int k = 0; k <= i; ++k)
+                        {
+                            ValueType fac = C1[k + (col - 1) * ld];
+                            ValueType* hk = &Hu[DENSE_IND(0, k, size + 1, size)];
+
+                            for(int m = 0; m <= k + 1; ++m)
+                            {
+                                hu[m] -= fac * hk[m];
+                            }
+                        }
+
+                        for(int l = 0; l < col - 1; ++l)
+                        {
+                            ValueType  fac = R1[l + (col - 1) * step];
+                            ValueType* hl  = &Hu[DENSE_IND(0, i + 1 + l, size + 1, size)];
+
+                            for(int m = 0; m <= i + l + 2; ++m)
+                            {
+                                hu[m] -= fac * hl[m];
+                            }
+                        }
+
+                        ValueType inv_diag = one / R1[(col - 1) + (col - 1) * step];
+
+                        for(int m = 0; m <= j + 1; ++m)
+                        {
+                            hu[m] *= inv_diag;
+                        }
+                    }
+
+                    for(int m = 0; m <= j + 1; ++m)
+                    {
+                        h[m] = hu[m];
+                    }
+
+                    // Apply Givens rotation J(0),...,J(j-1) on (H(0,j),...,H(j,j))
+                    for(int k = 0; k < j; ++k)
+                    {
+                        sstep_gmres_apply_givens(c[k], s[k], h[k], h[k + 1]);
+                    }
+
+                    // Construct J(j) and apply it to H(j,j) and H(j+1,j) such that
+                    // H(j+1,j) = 0
+                    sstep_gmres_generate_givens(h[j], h[j + 1], c[j], s[j]);
+                    sstep_gmres_apply_givens(c[j], s[j], h[j], h[j + 1]);
+
+                    // Apply J(j) to the norm of the residual
+                    sstep_gmres_apply_givens(c[j], s[j], r[j], r[j + 1]);
+
+                    // Check convergence
+                    if(this->iter_ctrl_.CheckResidual(std::abs(r[j + 1])))
+                    {
+                        converged = true;
+                        ncol      = col + 1;
+                        break;
+                    }
+                }
+
+                i += ncol;
+
+                // Restart if converged or the block has been truncated
+                if(converged == true || rank < nb)
+                {
+                    break;
+                }
+            }
+
+            // Solve upper triangular system
+            for(int j = i - 1; j >= 0; --j)
+            {
+                r[j] /= H[DENSE_IND(j, j, size + 1, size)];
+
+                for(int k = 0; k < j; ++k)
+                {
+                    r[k] -= H[DENSE_IND(k, j, size + 1, size)] * r[j];
+                }
+            }
+
+            // Update solution x = x + V r, single pass
+            x->MultiAXPY(i, r, v);
+
+            // Compute residual
+            if(precond == true)
+            {
+                op->Apply(*x, z);
+                z->ScaleAdd(-one, rhs);
+                this->precond_->SolveZeroSol(*z, v[0]);
+            }
+            else
+            {
+                op->Apply(*x, v[0]);
+                v[0]->ScaleAdd(-one, rhs);
+            }
+
+            // r = 0
+            set_to_zero_host(size + 1, r);
+
+            // r_0 = ||v_0||
+            r[0] = this->Norm_(*v[0]);
+
+            // Check convergence
+            if(this->iter_ctrl_.CheckResidualNoCount(std::abs(r[0])))
+            {
+                break;
+            }
+        }
+
+        log_debug(this, "SStepGMRES::SolveSStep_()", " #*# end");
+    }
+
+    template class SStepGMRES<LocalMatrix<double>, LocalVector<double>, double>;
+    template class SStepGMRES<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepGMRES<LocalMatrix<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class SStepGMRES<LocalMatrix<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+    template class SStepGMRES<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class SStepGMRES<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepGMRES<GlobalMatrix<std::complex<double>>,
+                              GlobalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class SStepGMRES<GlobalMatrix<std::complex<float>>,
+                              GlobalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+    template class SStepGMRES<LocalStencil<double>, LocalVector<double>, double>;
+    template class SStepGMRES<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepGMRES<LocalStencil<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class SStepGMRES<LocalStencil<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_SSTEP_GMRES_HPP_
+#define ROCALUTION_KRYLOV_SSTEP_GMRES_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class SStepGMRES
+  * \brief s-step (Communication-Avoiding) Generalized Minimum Residual Method
+  * \details
+  * The s-step GMRES method is a reformulation of the restarted GMRES method for sparse
+  * (non) symmetric linear systems \f$Ax=b\f$, that performs \f$s\f$ Arnoldi steps per
+  * block orthogonalization. Starting from the last orthonormal basis vector \f$v_{i}\f$,
+  * the block \f$[Av_{i}, A^{2}v_{i}, \dots, A^{s}v_{i}]\f$ is generated by repeated
+  * matrix-vector products, without any reduction. The block is then orthogonalized
+  * against the previous basis vectors and within itself by two passes of block classical
+  * Gram-Schmidt with Cholesky QR, each requiring a single fused reduction (see
+  * LocalVector::FusedDot() and GlobalVector::FusedDot()). The Hessenberg matrix is
+  * recovered from the orthogonalization coefficients, such that convergence is checked
+  * after every Arnoldi step, as in GMRES.
+  *
+  * This reduces the number of global reductions by a factor of about \f$s\f$ compared to
+  * GMRES. The monomial Krylov basis becomes ill-conditioned quickly, therefore \f$s\f$
+  * should be kept small. If a block is found to be numerically rank deficient, it is
+  * truncated and the method is restarted. The block size can be set using
+  * SetStepSize(), the default is 4. The Krylov subspace basis size can be set using
+  * SetBasisSize(), the default is 30.
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class SStepGMRES : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        SStepGMRES();
+        ROCALUTION_EXPORT
+        virtual ~SStepGMRES();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the size of the Krylov subspace basis */
+        ROCALUTION_EXPORT
+        virtual void SetBasisSize(int size_basis);
+
+        /** \brief Set the number of Arnoldi steps s per block orthogonalization */
+        ROCALUTION_EXPORT
+        void SetStepSize(int s);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        /** \brief s-step solve, with or without preconditioner */
+        void SolveSStep_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // Orthonormalize v_i+1,...,v_i+nb against v_0,...,v_i and within the block by
+        // one pass of block classical Gram-Schmidt with Cholesky QR, such that
+        // [v_i+1,...,v_i+nb] = [v_0,...,v_i] C + [q_i+1,...,q_i+nb] R. Returns the
+        // numerical rank of the block.
+        int OrthogonalizeBlock_(int i, int nb, ValueType* C, ValueType* R);
+
+        VectorType** v_;
+        VectorType   z_;
+
+        ValueType* c_;
+        ValueType* s_;
+        ValueType* r_;
+        ValueType* H_;
+
+        // Hessenberg matrix without Givens rotations applied
+        ValueType* Hu_;
+        // Block orthogonalization coefficients of two passes
+        ValueType* C_;
+        ValueType* R_;
+        // Coefficients of the multi-vector update
+        ValueType* t_;
+
+        int size_basis_;
+        int step_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_SSTEP_GMRES_HPP_
@@ -31,6 +31,7 @@
 #include "../../base/global_matrix.hpp"
 #include "../../base/global_vector.hpp"
 
+#include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
 
@@ -72,7 +73,11 @@ namespace rocalution
 
         this->kcycle_full_ = true;
 
-        this->pm_level_ = NULL;
+        this->pm_level_    = NULL;
+        this->trans_level_ = NULL;
+
+        this->smoother_memory_level_ = NULL;
+        this->solver_coarse_memory_  = 0;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -217,6 +222,14 @@ namespace rocalution
         LOG_INFO("MultiGrid ends");
     }
 
+    // Host memory that has been allocated (and not freed) since the usage was taken
+    static size_t host_memory_allocated_since(size_t usage)
+    {
+        size_t current = get_host_memory_usage_rocalution();
+
+        return current > usage ? current - usage : 0;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseMultiGrid<OperatorType, VectorType, ValueType>::Initialize(void)
     {
@@ -227,29 +240,43 @@ namespace rocalution
         // Initialize smoothers
         assert(this->smoother_level_ != NULL);
 
+        this->smoother_memory_level_ = new size_t[this->levels_ - 1];
+
         // Finest level 0
         assert(this->smoother_level_[0] != NULL);
 
+        size_t usage = get_host_memory_usage_rocalution();
+
         this->smoother_level_[0]->SetOperator(*this->op_);
         this->smoother_level_[0]->Build();
         this->smoother_level_[0]->FlagSmoother();
 
+        this->smoother_memory_level_[0] = host_memory_allocated_since(usage);
+
         // Coarse levels
         for(int i = 1; i < this->levels_ - 1; ++i)
         {
             assert(this->smoother_level_[i] != NULL);
 
+            usage = get_host_memory_usage_rocalution();
+
             this->smoother_level_[i]->SetOperator(*this->op_level_[i - 1]);
             this->smoother_level_[i]->Build();
             this->smoother_level_[i]->FlagSmoother();
+
+            this->smoother_memory_level_[i] = host_memory_allocated_since(usage);
         }
 
         // Initialize coarse grid solver
         assert(this->solver_coarse_ != NULL);
 
+        usage = get_host_memory_usage_rocalution();
+
         this->solver_coarse_->SetOperator(*op_level_[this->levels_ - 2]);
         this->solver_coarse_->Build();
 
+        this->solver_coarse_memory_ = host_memory_allocated_since(usage);
+
         // Setup all temporary vectors for the cycles - needed on all levels
         this->d_level_ = new VectorType*[this->levels_];
         this->r_level_ = new VectorType*[this->levels_];
@@ -427,6 +454,10 @@ namespace rocalution
             // Clear coarse grid solver
             this->solver_coarse_->Clear();
 
+            delete[] this->smoother_memory_level_;
+            this->smoother_memory_level_ = NULL;
+            this->solver_coarse_memory_  = 0;
+
             // Reset iteration control
             this->iter_ctrl_.Clear();
         }
@@ -611,6 +642,127 @@ namespace rocalution
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::LevelMemoryUsage_(
+        int     level,
+        size_t* op,
+        size_t* restrict_op,
+        size_t* prolong_op,
+        size_t* smoother,
+        size_t* vectors) const
+    {
+        assert(this->build_ == true);
+        assert(level >= 0 && level < this->levels_);
+
+        *op          = 0;
+        *restrict_op = 0;
+        *prolong_op  = 0;
+        *smoother    = 0;
+        *vectors     = 0;
+
+        // The operator of the finest level is owned by the user
+        if(level > 0)
+        {
+            *op = this->op_level_[level - 1]->GetMemoryUsage();
+            *vectors += this->d_level_[level]->GetMemoryUsage();
+        }
+
+        // Transfer to the next coarser level
+        if(level < this->levels_ - 1)
+        {
+            *restrict_op = this->restrict_op_level_[level]->GetMemoryUsage();
+            *prolong_op  = this->prolong_op_level_[level]->GetMemoryUsage();
+            *smoother    = this->smoother_memory_level_[level];
+
+            if(this->trans_level_ != NULL && this->trans_level_[level] != NULL)
+            {
+                *vectors += this->trans_level_[level]->GetMemoryUsage();
+            }
+        }
+
+        // Temporary vectors of the cycles
+        *vectors += this->r_level_[level]->GetMemoryUsage();
+        *vectors += this->t_level_[level]->GetMemoryUsage();
+
+        if(this->scaling_)
+        {
+            *vectors += this->s_level_[level]->GetMemoryUsage();
+        }
+
+        if(this->cycle_ == Kcycle && level < this->levels_ - 2)
+        {
+            *vectors += this->q_level_[level]->GetMemoryUsage();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    size_t BaseMultiGrid<OperatorType, VectorType, ValueType>::GetMemoryUsage(void) const
+    {
+        log_debug(this, "BaseMultiGrid::GetMemoryUsage()");
+
+        assert(this->build_ == true);
+
+        size_t bytes = this->solver_coarse_memory_;
+
+        for(int i = 0; i < this->levels_; ++i)
+        {
+            size_t op, restrict_op, prolong_op, smoother, vectors;
+
+            this->LevelMemoryUsage_(i, &op, &restrict_op, &prolong_op, &smoother, &vectors);
+
+            bytes += op + restrict_op + prolong_op + smoother + vectors;
+        }
+
+        return bytes;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::PrintMemoryUsage(void) const
+    {
+        log_debug(this, "BaseMultiGrid::PrintMemoryUsage()");
+
+        assert(this->build_ == true);
+
+        size_t total_op       = 0;
+        size_t total_restrict = 0;
+        size_t total_prolong  = 0;
+        size_t total_smoother = 0;
+        size_t total_vectors  = 0;
+
+        LOG_INFO("MultiGrid memory usage [bytes]");
+
+        for(int i = 0; i < this->levels_; ++i)
+        {
+            size_t op, restrict_op, prolong_op, smoother, vectors;
+
+            this->LevelMemoryUsage_(i, &op, &restrict_op, &prolong_op, &smoother, &vectors);
+
+            LOG_INFO("Level " << i << ": operator=" << op << " restriction=" << restrict_op
+                              << " prolongation=" << prolong_op << " smoother=" << smoother
+                              << " vectors=" << vectors);
+
+            total_op += op;
+            total_restrict += restrict_op;
+            total_prolong += prolong_op;
+            total_smoother += smoother;
+            total_vectors += vectors;
+        }
+
+        size_t total = total_op + total_restrict + total_prolong + total_smoother + total_vectors
+                       + this->solver_coarse_memory_;
+
+        double scale = total > 0 ? 100.0 / total : 0.0;
+
+        LOG_INFO("Operators: " << total_op << " (" << total_op * scale << "%)");
+        LOG_INFO("Restriction: " << total_restrict << " (" << total_restrict * scale << "%)");
+        LOG_INFO("Prolongation: " << total_prolong << " (" << total_prolong * scale << "%)");
+        LOG_INFO("Smoothers: " << total_smoother << " (" << total_smoother * scale << "%)");
+        LOG_INFO("Vectors: " << total_vectors << " (" << total_vectors * scale << "%)");
+        LOG_INFO("Coarse grid solver: " << this->solver_coarse_memory_ << " ("
+                                        << this->solver_coarse_memory_ * scale << "%)");
+        LOG_INFO("Total: " << total);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseMultiGrid<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs,
                                                                    VectorType*       x)
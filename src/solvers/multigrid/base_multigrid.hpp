@@ -110,6 +110,32 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Solve(const VectorType& rhs, VectorType* x);
 
+        /** \brief Return the memory usage of the multigrid hierarchy in bytes
+      * \details
+      * Sum of the coarse grid operators, the restriction and prolongation operators,
+      * the transfer mappings, the temporary vectors of the cycles, the smoothers and the
+      * coarse grid solver. The finest operator is not included, it is owned by the user.
+      * For the smoothers and the coarse grid solver, the host memory that has been
+      * allocated during their setup is taken (see get_host_memory_usage_rocalution()).
+      */
+        ROCALUTION_EXPORT
+        size_t GetMemoryUsage(void) const;
+
+        /** \brief Print the memory usage of the multigrid hierarchy per level and component
+      * \details
+      * \par Example
+      * \code{.cpp}
+      *   SAAMG<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType> amg;
+      *
+      *   amg.SetOperator(mat);
+      *   amg.Build();
+      *
+      *   amg.PrintMemoryUsage();
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void PrintMemoryUsage(void) const;
+
         virtual void Build(void);
         virtual void Initialize(void);
         virtual void Clear(void);
@@ -146,6 +172,14 @@ namespace rocalution
         /** \brief Move all level data to the host */
         void MoveHostLevels_(void);
 
+        /** \brief Memory usage of a level in bytes, split into its components */
+        void LevelMemoryUsage_(int     level,
+                               size_t* op,
+                               size_t* restrict_op,
+                               size_t* prolong_op,
+                               size_t* smoother,
+                               size_t* vectors) const;
+
         /** \brief Number of levels in the hierarchy */
         int levels_;
         /** \brief Host levels */
@@ -191,6 +225,11 @@ namespace rocalution
 
         /** \brief Parallel Manager for coarser levels */
         ParallelManager** pm_level_;
+
+        /** \brief Host memory allocated by the setup of the smoother of each level */
+        size_t* smoother_memory_level_;
+        /** \brief Host memory allocated by the setup of the coarse grid solver */
+        size_t solver_coarse_memory_;
     };
 
 } // namespace rocalution
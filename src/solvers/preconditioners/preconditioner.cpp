@@ -407,8 +407,10 @@ namespace rocalution
     {
         log_debug(this, "ILU::ILU()", "default constructor");
 
-        this->p_     = 0;
-        this->level_ = true;
+        this->p_           = 0;
+        this->level_       = true;
+        this->sweeps_      = 0;
+        this->fact_sweeps_ = 0;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -424,6 +426,16 @@ namespace rocalution
     {
         LOG_INFO("ILU(" << this->p_ << ") preconditioner");
 
+        if(this->fact_sweeps_ > 0 && this->p_ == 0)
+        {
+            LOG_INFO("ILU factorization with " << this->fact_sweeps_ << " fixed-point sweeps");
+        }
+
+        if(this->sweeps_ > 0)
+        {
+            LOG_INFO("ILU triangular solves with " << this->sweeps_ << " Jacobi sweeps");
+        }
+
         if(this->build_ == true)
         {
             LOG_INFO("ILU nnz = " << this->ILU_.GetNnz());
@@ -442,6 +454,28 @@ namespace rocalution
         this->level_ = level;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ILU<OperatorType, VectorType, ValueType>::SetJacobiSweeps(int sweeps)
+    {
+        log_debug(this, "ILU::SetJacobiSweeps()", sweeps);
+
+        assert(sweeps >= 0);
+        assert(this->build_ == false);
+
+        this->sweeps_ = sweeps;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ILU<OperatorType, VectorType, ValueType>::SetFactorizationSweeps(int sweeps)
+    {
+        log_debug(this, "ILU::SetFactorizationSweeps()", sweeps);
+
+        assert(sweeps >= 0);
+        assert(this->build_ == false);
+
+        this->fact_sweeps_ = sweeps;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void ILU<OperatorType, VectorType, ValueType>::Build(void)
     {
@@ -459,9 +493,23 @@ namespace rocalution
 
         this->ILU_.CloneFrom(*this->op_);
 
-        this->ILU_.ILUpFactorize(this->p_, this->level_);
+        if(this->fact_sweeps_ > 0 && this->p_ == 0)
+        {
+            this->ILU_.ItILU0Factorize(this->fact_sweeps_);
+        }
+        else
+        {
+            this->ILU_.ILUpFactorize(this->p_, this->level_);
+        }
 
-        this->ILU_.LUAnalyse();
+        if(this->sweeps_ > 0)
+        {
+            this->ILU_.ItLUAnalyse();
+        }
+        else
+        {
+            this->ILU_.LUAnalyse();
+        }
 
         log_debug(this, "ILU::Build()", this->build_, " #*# end");
     }
@@ -473,6 +521,7 @@ namespace rocalution
 
         this->ILU_.Clear();
         this->ILU_.LUAnalyseClear();
+        this->ILU_.ItLUAnalyseClear();
         this->build_ = false;
     }
 
@@ -482,7 +531,15 @@ namespace rocalution
         log_debug(this, "ILU::MoveToHostLocalData_()", this->build_);
 
         this->ILU_.MoveToHost();
-        this->ILU_.LUAnalyse();
+
+        if(this->sweeps_ > 0)
+        {
+            this->ILU_.ItLUAnalyse();
+        }
+        else
+        {
+            this->ILU_.LUAnalyse();
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -491,7 +548,15 @@ namespace rocalution
         log_debug(this, "ILU::MoveToAcceleratorLocalData_()", this->build_);
 
         this->ILU_.MoveToAccelerator();
-        this->ILU_.LUAnalyse();
+
+        if(this->sweeps_ > 0)
+        {
+            this->ILU_.ItLUAnalyse();
+        }
+        else
+        {
+            this->ILU_.LUAnalyse();
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -503,7 +568,14 @@ namespace rocalution
         assert(x != NULL);
         assert(x != &rhs);
 
-        this->ILU_.LUSolve(rhs, x);
+        if(this->sweeps_ > 0)
+        {
+            this->ILU_.ItLUSolve(this->sweeps_, rhs, x);
+        }
+        else
+        {
+            this->ILU_.LUSolve(rhs, x);
+        }
 
         log_debug(this, "ILU::Solve()", " #*# end");
     }
@@ -513,8 +585,10 @@ namespace rocalution
     {
         log_debug(this, "ILUT::ILUT()", "default constructor");
 
-        this->t_       = 0.05;
-        this->max_row_ = 100;
+        this->t_         = 0.05;
+        this->max_row_   = 100;
+        this->sweeps_    = 0;
+        this->num_parts_ = 0;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -530,6 +604,16 @@ namespace rocalution
     {
         LOG_INFO("ILUT(" << this->t_ << "," << this->max_row_ << ") preconditioner");
 
+        if(this->sweeps_ > 0)
+        {
+            LOG_INFO("ILUT triangular solves with " << this->sweeps_ << " Jacobi sweeps");
+        }
+
+        if(this->num_parts_ > 0)
+        {
+            LOG_INFO("ILUT factorization with " << this->num_parts_ << " partitions");
+        }
+
         if(this->build_ == true)
         {
             LOG_INFO("ILUT nnz = " << this->ILUT_.GetNnz());
@@ -559,6 +643,28 @@ namespace rocalution
         this->max_row_ = maxrow;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ILUT<OperatorType, VectorType, ValueType>::SetJacobiSweeps(int sweeps)
+    {
+        log_debug(this, "ILUT::SetJacobiSweeps()", sweeps);
+
+        assert(sweeps >= 0);
+        assert(this->build_ == false);
+
+        this->sweeps_ = sweeps;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ILUT<OperatorType, VectorType, ValueType>::SetPartitions(int num_parts)
+    {
+        log_debug(this, "ILUT::SetPartitions()", num_parts);
+
+        assert(num_parts >= 0);
+        assert(this->build_ == false);
+
+        this->num_parts_ = num_parts;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void ILUT<OperatorType, VectorType, ValueType>::Build(void)
     {
@@ -575,8 +681,29 @@ namespace rocalution
         assert(this->op_ != NULL);
 
         this->ILUT_.CloneFrom(*this->op_);
+
+        if(this->num_parts_ > 0)
+        {
+            int interior_size;
+
+            this->permutation_.CloneBackend(*this->op_);
+            this->ILUT_.PartitionPermutation(this->num_parts_, interior_size, &this->permutation_);
+            this->ILUT_.Permute(this->permutation_);
+
+            this->x_.CloneBackend(*this->op_);
+            this->x_.Allocate("ILUT permuted vector", this->op_->GetM());
+        }
+
         this->ILUT_.ILUTFactorize(this->t_, this->max_row_);
-        this->ILUT_.LUAnalyse();
+
+        if(this->sweeps_ > 0)
+        {
+            this->ILUT_.ItLUAnalyse();
+        }
+        else
+        {
+            this->ILUT_.LUAnalyse();
+        }
 
         log_debug(this, "ILUT::Build()", this->build_, " #*# end");
     }
@@ -588,6 +715,9 @@ namespace rocalution
 
         this->ILUT_.Clear();
         this->ILUT_.LUAnalyseClear();
+        this->ILUT_.ItLUAnalyseClear();
+        this->permutation_.Clear();
+        this->x_.Clear();
         this->build_ = false;
     }
 
@@ -597,6 +727,8 @@ namespace rocalution
         log_debug(this, "ILUT::MoveToHostLocalData_()", this->build_);
 
         this->ILUT_.MoveToHost();
+        this->permutation_.MoveToHost();
+        this->x_.MoveToHost();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -605,6 +737,8 @@ namespace rocalution
         log_debug(this, "ILUT::MoveToAcceleratorLocalData_()", this->build_);
 
         this->ILUT_.MoveToAccelerator();
+        this->permutation_.MoveToAccelerator();
+        this->x_.MoveToAccelerator();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -616,7 +750,29 @@ namespace rocalution
         assert(x != NULL);
         assert(x != &rhs);
 
-        this->ILUT_.LUSolve(rhs, x);
+        if(this->num_parts_ > 0)
+        {
+            x->CopyFromPermute(rhs, this->permutation_);
+
+            if(this->sweeps_ > 0)
+            {
+                this->ILUT_.ItLUSolve(this->sweeps_, *x, &this->x_);
+            }
+            else
+            {
+                this->ILUT_.LUSolve(*x, &this->x_);
+            }
+
+            x->CopyFromPermuteBackward(this->x_, this->permutation_);
+        }
+        else if(this->sweeps_ > 0)
+        {
+            this->ILUT_.ItLUSolve(this->sweeps_, rhs, x);
+        }
+        else
+        {
+            this->ILUT_.LUSolve(rhs, x);
+        }
 
         log_debug(this, "ILUT::Solve()", " #*# end");
     }
@@ -625,6 +781,9 @@ namespace rocalution
     IC<OperatorType, VectorType, ValueType>::IC()
     {
         log_debug(this, "IC::IC()", "default constructor");
+
+        this->sweeps_      = 0;
+        this->fact_sweeps_ = 0;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -640,12 +799,44 @@ namespace rocalution
     {
         LOG_INFO("IC preconditioner");
 
+        if(this->fact_sweeps_ > 0)
+        {
+            LOG_INFO("IC factorization with " << this->fact_sweeps_ << " fixed-point sweeps");
+        }
+
+        if(this->sweeps_ > 0)
+        {
+            LOG_INFO("IC triangular solves with " << this->sweeps_ << " Jacobi sweeps");
+        }
+
         if(this->build_ == true)
         {
             LOG_INFO("IC nnz = " << this->IC_.GetNnz());
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IC<OperatorType, VectorType, ValueType>::SetJacobiSweeps(int sweeps)
+    {
+        log_debug(this, "IC::SetJacobiSweeps()", sweeps);
+
+        assert(sweeps >= 0);
+        assert(this->build_ == false);
+
+        this->sweeps_ = sweeps;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IC<OperatorType, VectorType, ValueType>::SetFactorizationSweeps(int sweeps)
+    {
+        log_debug(this, "IC::SetFactorizationSweeps()", sweeps);
+
+        assert(sweeps >= 0);
+        assert(this->build_ == false);
+
+        this->fact_sweeps_ = sweeps;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IC<OperatorType, VectorType, ValueType>::Build(void)
     {
@@ -665,8 +856,24 @@ namespace rocalution
         this->inv_diag_entries_.CloneBackend(*this->op_);
 
         this->op_->ExtractL(&this->IC_, true);
-        this->IC_.ICFactorize(&this->inv_diag_entries_);
-        this->IC_.LLAnalyse();
+
+        if(this->fact_sweeps_ > 0)
+        {
+            this->IC_.ItICFactorize(this->fact_sweeps_, &this->inv_diag_entries_);
+        }
+        else
+        {
+            this->IC_.ICFactorize(&this->inv_diag_entries_);
+        }
+
+        if(this->sweeps_ > 0)
+        {
+            this->IC_.ItLLAnalyse();
+        }
+        else
+        {
+            this->IC_.LLAnalyse();
+        }
 
         log_debug(this, "IC::Build()", this->build_, " #*# end");
     }
@@ -679,6 +886,7 @@ namespace rocalution
         this->inv_diag_entries_.Clear();
         this->IC_.Clear();
         this->IC_.LLAnalyseClear();
+        this->IC_.ItLLAnalyseClear();
         this->build_ = false;
     }
 
@@ -709,7 +917,14 @@ namespace rocalution
         assert(x != NULL);
         assert(x != &rhs);
 
-        this->IC_.LLSolve(rhs, this->inv_diag_entries_, x);
+        if(this->sweeps_ > 0)
+        {
+            this->IC_.ItLLSolve(this->sweeps_, rhs, this->inv_diag_entries_, x);
+        }
+        else
+        {
+            this->IC_.LLSolve(rhs, this->inv_diag_entries_, x);
+        }
 
         log_debug(this, "IC::Solve()", " #*# end");
     }
@@ -24,6 +24,7 @@
 #ifndef ROCALUTION_PRECONDITIONER_HPP_
 #define ROCALUTION_PRECONDITIONER_HPP_
 
+#include "../../base/local_vector.hpp"
 #include "../solver.hpp"
 #include "rocalution/export.hpp"
 
@@ -228,6 +229,26 @@ namespace rocalution
       */
         ROCALUTION_EXPORT
         virtual void Set(int p, bool level = true);
+
+        /** \brief Set the number of Jacobi sweeps of the triangular solves
+      * \details
+      * Instead of exact forward and backward substitutions, each triangular factor is
+      * solved approximately by \p sweeps Jacobi iterations, which are fully parallel.
+      * For moderately conditioned problems, 2 to 3 sweeps typically yield a similar
+      * number of iterations of the outer solver. Default is 0 (exact solves).
+      */
+        ROCALUTION_EXPORT
+        virtual void SetJacobiSweeps(int sweeps);
+
+        /** \brief Set the number of fixed-point sweeps of the factorization
+      * \details
+      * Instead of the sequential row-by-row ILU(0) factorization, all entries of the
+      * factors are computed in parallel by \p sweeps fixed-point iterations, see
+      * \cite Chow2015. Only applies to ILU(0). Default is 0 (exact factorization).
+      */
+        ROCALUTION_EXPORT
+        virtual void SetFactorizationSweeps(int sweeps);
+
         ROCALUTION_EXPORT
         virtual void Build(void);
         ROCALUTION_EXPORT
@@ -241,6 +262,8 @@ namespace rocalution
         OperatorType ILU_;
         int          p_;
         bool         level_;
+        int          sweeps_;
+        int          fact_sweeps_;
     };
 
     /** \ingroup precond_module
@@ -278,6 +301,20 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void Set(double t, int maxrow);
 
+        /** \brief Set the number of triangular solve Jacobi sweeps, see ILU::SetJacobiSweeps() */
+        ROCALUTION_EXPORT
+        virtual void SetJacobiSweeps(int sweeps);
+
+        /** \brief Set the number of partitions for the parallel factorization
+      * \details
+      * The rows are split into \p num_parts nnz-balanced parts. Rows that couple to other
+      * parts are permuted to the end of the matrix, such that the remaining rows of each
+      * part can be factorized independently. This exposes parallelism to the host
+      * factorization at the cost of a different ordering. Default is 0 (no permutation).
+      */
+        ROCALUTION_EXPORT
+        virtual void SetPartitions(int num_parts);
+
         ROCALUTION_EXPORT
         virtual void Build(void);
         ROCALUTION_EXPORT
@@ -291,6 +328,11 @@ namespace rocalution
         OperatorType ILUT_;
         double       t_;
         int          max_row_;
+        int          sweeps_;
+        int          num_parts_;
+
+        LocalVector<int> permutation_;
+        VectorType       x_;
     };
 
     /** \ingroup precond_module
@@ -318,6 +360,20 @@ namespace rocalution
         virtual void Print(void) const;
         ROCALUTION_EXPORT
         virtual void Solve(const VectorType& rhs, VectorType* x);
+
+        /** \brief Set the number of triangular solve Jacobi sweeps, see ILU::SetJacobiSweeps() */
+        ROCALUTION_EXPORT
+        virtual void SetJacobiSweeps(int sweeps);
+
+        /** \brief Set the number of fixed-point sweeps of the factorization
+      * \details
+      * Instead of the sequential row-by-row IC(0) factorization, all entries of the
+      * factors are computed in parallel by \p sweeps fixed-point iterations, see
+      * \cite Chow2015. Default is 0 (exact factorization).
+      */
+        ROCALUTION_EXPORT
+        virtual void SetFactorizationSweeps(int sweeps);
+
         ROCALUTION_EXPORT
         virtual void Build(void);
         ROCALUTION_EXPORT
@@ -330,6 +386,8 @@ namespace rocalution
     private:
         OperatorType IC_;
         VectorType   inv_diag_entries_;
+        int          sweeps_;
+        int          fact_sweeps_;
     };
 
     /** \ingroup precond_module
@@ -43,10 +43,11 @@ namespace rocalution
     {
         log_debug(this, "MultiColoredILU::MultiColoredILU()", "default constructor");
 
-        this->q_     = 1;
-        this->p_     = 0;
-        this->level_ = true;
-        this->nnz_   = 0;
+        this->q_      = 1;
+        this->p_      = 0;
+        this->level_  = true;
+        this->nnz_    = 0;
+        this->sweeps_ = 0;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -95,6 +96,17 @@ namespace rocalution
         this->level_ = level;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredILU<OperatorType, VectorType, ValueType>::SetJacobiSweeps(int sweeps)
+    {
+        log_debug(this, "MultiColoredILU::SetJacobiSweeps()", sweeps);
+
+        assert(this->build_ == false);
+        assert(sweeps >= 0);
+
+        this->sweeps_ = sweeps;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void MultiColoredILU<OperatorType, VectorType, ValueType>::Build_Analyser_(void)
     {
@@ -126,7 +138,15 @@ namespace rocalution
         log_debug(this, "MultiColoredILU::PostAnalyse_()", this->build_);
 
         assert(this->build_ == true);
-        this->preconditioner_->LUAnalyse();
+
+        if(this->sweeps_ > 0)
+        {
+            this->preconditioner_->ItLUAnalyse();
+        }
+        else
+        {
+            this->preconditioner_->LUAnalyse();
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -155,7 +175,15 @@ namespace rocalution
             this->preconditioner_->Permute(this->permutation_);
 
             this->preconditioner_->ILU0Factorize();
-            this->preconditioner_->LUAnalyse();
+
+            if(this->sweeps_ > 0)
+            {
+                this->preconditioner_->ItLUAnalyse();
+            }
+            else
+            {
+                this->preconditioner_->LUAnalyse();
+            }
         }
         else
         {
@@ -248,7 +276,14 @@ namespace rocalution
 
         x->CopyFromPermute(rhs, this->permutation_);
 
-        this->preconditioner_->LUSolve(*x, &this->x_);
+        if(this->sweeps_ > 0)
+        {
+            this->preconditioner_->ItLUSolve(this->sweeps_, *x, &this->x_);
+        }
+        else
+        {
+            this->preconditioner_->LUSolve(*x, &this->x_);
+        }
 
         x->CopyFromPermuteBackward(this->x_, this->permutation_);
     }
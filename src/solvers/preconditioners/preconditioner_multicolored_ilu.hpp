@@ -74,6 +74,16 @@ namespace rocalution
         ROCALUTION_EXPORT
         void Set(int p, int q, bool level = true);
 
+        /** \brief Set the number of Jacobi sweeps of the triangular solves
+      * \details
+      * Only applies if the preconditioner is not decomposed into color blocks (see
+      * SetDecomposition()). Instead of exact forward and backward substitutions, each
+      * triangular factor is solved approximately by \p sweeps Jacobi iterations. Default
+      * is 0 (exact solves).
+      */
+        ROCALUTION_EXPORT
+        void SetJacobiSweeps(int sweeps);
+
     protected:
         virtual void Build_Analyser_(void);
         virtual void Factorize_(void);
@@ -92,6 +102,8 @@ namespace rocalution
         bool level_;
         /** \brief Number of non-zeros */
         int nnz_;
+        /** \brief Number of Jacobi sweeps of the triangular solves */
+        int sweeps_;
     };
 
 } // namespace rocalution
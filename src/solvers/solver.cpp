@@ -367,6 +367,32 @@ namespace rocalution
         return 0;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    ValueType IterativeLinearSolver<OperatorType, VectorType, ValueType>::ResidualNorm_(
+        const VectorType& rhs, const VectorType& x, VectorType* r)
+    {
+        log_debug(this,
+                  "IterativeLinearSolver::ResidualNorm_()",
+                  (const void*&)rhs,
+                  (const void*&)x,
+                  r,
+                  this->res_norm_type_);
+
+        assert(r != NULL);
+        assert(this->op_ != NULL);
+
+        // L2 norm, fused with the residual computation
+        if(this->res_norm_type_ == 2)
+        {
+            return this->op_->ResidualNorm(rhs, x, r);
+        }
+
+        this->op_->Apply(x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        return this->Norm_(*r);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IterativeLinearSolver<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs,
                                                                            VectorType*       x)
@@ -32,6 +32,13 @@
 namespace rocalution
 {
 
+    /** \brief Orthogonalization schemes for the Arnoldi process of GMRES type solvers */
+    enum _orthogonalization
+    {
+        MGS  = 0, /**< Modified Gram-Schmidt */
+        CGS2 = 1 /**< Classical Gram-Schmidt with reorthogonalization */
+    };
+
     /** \ingroup solver_module
   * \class Solver
   * \brief Base class for all solvers and preconditioners
@@ -318,6 +325,11 @@ namespace rocalution
 
         /** \brief Computes the vector norm */
         ValueType Norm_(const VectorType& vec);
+
+        /** \brief Computes the residual \f$r = b - Ax\f$ and its norm, fused into a
+      * single pass for the \f$L_2\f$ norm
+      */
+        ValueType ResidualNorm_(const VectorType& rhs, const VectorType& x, VectorType* r);
     };
 
     /** \ingroup solver_module
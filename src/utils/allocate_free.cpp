@@ -25,62 +25,386 @@
 #include "def.hpp"
 #include "log.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <cstddef>
+#include <mutex>
+#include <new>
 #include <stdlib.h>
 #include <string.h>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__gnu_linux__) || defined(linux) || defined(__linux) || defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) \
+    || defined(__WIN64) && !defined(__CYGWIN__)
+#include <malloc.h>
+#endif
 
 namespace rocalution
 {
 
-    //#define MEM_ALIGNMENT 64
-    //#define LONG_PTR size_t
-    //#define LONG_PTR long
+    // Default alignment of host buffers (cache line / AVX-512 register)
+    static const size_t HOST_ALIGNMENT = 64;
 
-    template <typename DataType>
-    void allocate_host(int size, DataType** ptr)
+    // Alignment of buffers that are backed by transparent huge pages
+    static const size_t HOST_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    // Host buffer that has been allocated by allocate_host()
+    struct host_allocation
     {
-        log_debug(0, "allocate_host()", "* begin", size, ptr);
+        // Pointer returned by the allocation function
+        void* base;
+        // Size of the buffer in bytes
+        size_t size;
+        // Function that releases base
+        void (*free_func)(void*);
+        // Buffer is returned to the memory pool when it is freed
+        bool pooled;
+    };
+
+    // All buffers allocated by allocate_host(), buffers that are not in the list have been
+    // allocated externally with new[] (e.g. by the user for SetDataPtr())
+    static std::unordered_map<void*, host_allocation> host_allocations;
+    static std::mutex                                  host_allocations_mutex;
+
+    // Allocation hooks of the application (NULL - default allocator), protected by
+    // host_allocations_mutex
+    static void* (*host_alloc_hook)(size_t, size_t) = NULL;
+    static void (*host_free_hook)(void*)            = NULL;
+
+    // Transparent huge pages (protected by host_allocations_mutex)
+    static bool   host_huge_pages          = false;
+    static size_t host_huge_pages_min_size = HOST_HUGE_PAGE_SIZE;
+
+    // Memory pool, freed buffers are cached per size class and handed out again by
+    // subsequent allocations of the same size class (protected by host_allocations_mutex)
+    static bool   host_pool            = false;
+    static size_t host_pool_max_cached = 0;
+
+    // Cached buffers per size class
+    static std::unordered_map<size_t, std::vector<host_allocation>> host_pool_cache;
+
+    // Statistics of the pool
+    static HostMemoryPoolStats host_pool_stats = {0, 0, 0, 0, 0};
+
+    // Bytes of buffers in use and their high-water mark (protected by host_allocations_mutex)
+    static size_t host_memory_usage = 0;
+    static size_t host_memory_peak  = 0;
+
+    // Account for a buffer that is handed out to or returned by the caller
+    static void host_memory_account(const host_allocation& alloc, bool handed_out)
+    {
+        if(handed_out == true)
+        {
+            host_memory_usage += alloc.size;
+            host_memory_peak = std::max(host_memory_peak, host_memory_usage);
+        }
+        else
+        {
+            host_memory_usage -= alloc.size;
+        }
+    }
 
-        if(size > 0)
+    // Round a size up to its size class, there are four size classes per power of two,
+    // thus at most 25% of a pooled buffer are unused
+    static size_t host_pool_size_class(size_t size)
+    {
+        size_t step = HOST_ALIGNMENT;
+
+        while(step * 4 < size)
         {
-            assert(*ptr == NULL);
+            step *= 2;
+        }
 
-            // *********************************************************
-            // C++ style
-            //    *ptr = new DataType[size];
-            // *********************************************************
+        return (size + step - 1) / step * step;
+    }
 
-            // *********************************************************
-            // C style
-            // *ptr =  (DataType *) malloc(size*sizeof(DataType));
-            // *********************************************************
+    static void* host_default_alloc(size_t size, size_t alignment)
+    {
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) \
+    || defined(__WIN64) && !defined(__CYGWIN__)
+        return _aligned_malloc(size, alignment);
+#else
+        void* ptr = NULL;
 
-            // *********************************************************
-            // C style (zero-set)
-            // *ptr = (DataType *) calloc(size, sizeof(DatatType));
-            // *********************************************************
+        if(posix_memalign(&ptr, alignment, size) != 0)
+        {
+            return NULL;
+        }
 
-            // *********************************************************
-            // Aligned allocation
-            // total size = (size*datatype) + (alignment-1) + (void ptr)
-            // void *non_aligned =  malloc(size*sizeof(DataType)+(MEM_ALIGNMENT-1)+sizeof(void*));
-            // assert(non_aligned != NULL);
+        return ptr;
+#endif
+    }
 
-            // void *aligned = (void*)( ((LONG_PTR)(non_aligned)+MEM_ALIGNMENT+sizeof(void*) ) &
-            // ~(MEM_ALIGNMENT-1) );
-            // *((void**)aligned-1) = non_aligned;
+    static void host_default_free(void* ptr)
+    {
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) \
+    || defined(__WIN64) && !defined(__CYGWIN__)
+        _aligned_free(ptr);
+#else
+        free(ptr);
+#endif
+    }
 
-            // *ptr = (DataType*) aligned;
+    // Allocate an aligned host buffer of the given size (in bytes) and register it
+    static void* host_alloc(size_t size)
+    {
+        host_allocation alloc;
 
-            // LOG_INFO("A " << *ptr << " " <<  aligned << " " << non_aligned << " "<<  sizeof(DataType)
-            // << " " << size);
-            // *********************************************************
+        // Allocator settings, taken under the lock such that a concurrent setter cannot
+        // pair an allocation function with a different free function
+        void* (*alloc_hook)(size_t, size_t);
+        void (*free_hook)(void*);
+        bool   huge_pages;
+        size_t huge_pages_min_size;
 
-            // *********************************************************
-            // C++ style and error handling
+        // Try to recycle a cached buffer first
+        {
+            std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+            alloc_hook          = host_alloc_hook;
+            free_hook           = host_free_hook;
+            huge_pages          = host_huge_pages;
+            huge_pages_min_size = host_huge_pages_min_size;
+
+            alloc.pooled = host_pool;
+
+            if(host_pool == true)
+            {
+                size = host_pool_size_class(size);
+
+                ++host_pool_stats.requests;
 
-            *ptr = new(std::nothrow) DataType[size];
+                std::unordered_map<size_t, std::vector<host_allocation>>::iterator it
+                    = host_pool_cache.find(size);
+
+                if(it != host_pool_cache.end() && it->second.empty() == false)
+                {
+                    alloc = it->second.back();
+                    it->second.pop_back();
+
+                    ++host_pool_stats.hits;
+                    host_pool_stats.cached_size -= size;
+
+                    host_allocations[alloc.base] = alloc;
+                    host_memory_account(alloc, true);
+
+                    return alloc.base;
+                }
+            }
+        }
+
+        alloc.size = size;
+
+        if(alloc_hook != NULL)
+        {
+            alloc.base      = alloc_hook(size, HOST_ALIGNMENT);
+            alloc.free_func = free_hook;
+
+            // The hook has to respect the alignment
+            assert(reinterpret_cast<size_t>(alloc.base) % HOST_ALIGNMENT == 0);
+        }
+        else
+        {
+            bool huge = huge_pages == true && size >= huge_pages_min_size;
+
+            alloc.base      = host_default_alloc(size, huge ? HOST_HUGE_PAGE_SIZE : HOST_ALIGNMENT);
+            alloc.free_func = host_default_free;
+
+#ifdef MADV_HUGEPAGE
+            // Request transparent huge pages, this is only a hint to the kernel
+            if(huge == true && alloc.base != NULL)
+            {
+                madvise(alloc.base, size, MADV_HUGEPAGE);
+            }
+#endif
+        }
+
+        if(alloc.base == NULL)
+        {
+            return NULL;
+        }
+
+        std::lock_guard<std::mutex> lock(host_allocations_mutex);
+        host_allocations[alloc.base] = alloc;
+        host_memory_account(alloc, true);
+
+        if(alloc.pooled == true)
+        {
+            host_pool_stats.size += alloc.size;
+            host_pool_stats.peak_size = std::max(host_pool_stats.peak_size, host_pool_stats.size);
+        }
+
+        return alloc.base;
+    }
+
+    // Release a host buffer, returns false if it has not been allocated by host_alloc()
+    static bool host_free(void* ptr)
+    {
+        host_allocation alloc;
+
+        {
+            std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+            std::unordered_map<void*, host_allocation>::iterator it = host_allocations.find(ptr);
+
+            if(it == host_allocations.end())
+            {
+                return false;
+            }
+
+            alloc = it->second;
+            host_allocations.erase(it);
+            host_memory_account(alloc, false);
+
+            if(alloc.pooled == true)
+            {
+                // Keep the buffer for subsequent allocations
+                if(host_pool == true
+                   && (host_pool_max_cached == 0
+                       || host_pool_stats.cached_size + alloc.size <= host_pool_max_cached))
+                {
+                    host_pool_cache[alloc.size].push_back(alloc);
+                    host_pool_stats.cached_size += alloc.size;
+
+                    return true;
+                }
+
+                host_pool_stats.size -= alloc.size;
+            }
+        }
+
+        alloc.free_func(alloc.base);
+
+        return true;
+    }
+
+    void _release_host_memory_pool(void)
+    {
+        std::vector<host_allocation> release;
+
+        {
+            std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+            std::unordered_map<size_t, std::vector<host_allocation>>::iterator it;
+
+            for(it = host_pool_cache.begin(); it != host_pool_cache.end(); ++it)
+            {
+                release.insert(release.end(), it->second.begin(), it->second.end());
+            }
+
+            host_pool_cache.clear();
+
+            host_pool_stats.size -= host_pool_stats.cached_size;
+            host_pool_stats.cached_size = 0;
+        }
+
+        for(size_t i = 0; i < release.size(); ++i)
+        {
+            release[i].free_func(release[i].base);
+        }
+    }
+
+    void set_host_memory_pool_rocalution(bool pool, size_t max_cached_size)
+    {
+        log_debug(0, "set_host_memory_pool_rocalution()", pool, max_cached_size);
+
+        {
+            std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+            host_pool            = pool;
+            host_pool_max_cached = max_cached_size;
+        }
+
+        if(pool == false)
+        {
+            _release_host_memory_pool();
+        }
+    }
+
+    HostMemoryPoolStats get_host_memory_pool_stats_rocalution(void)
+    {
+        std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+        return host_pool_stats;
+    }
+
+    size_t get_host_memory_usage_rocalution(void)
+    {
+        std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+        return host_memory_usage;
+    }
+
+    size_t get_host_memory_peak_rocalution(void)
+    {
+        std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+        return host_memory_peak;
+    }
+
+    void reset_host_memory_peak_rocalution(void)
+    {
+        log_debug(0, "reset_host_memory_peak_rocalution()");
+
+        std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+        host_memory_peak = host_memory_usage;
+    }
+
+    void info_host_memory_pool_rocalution(void)
+    {
+        HostMemoryPoolStats stats = get_host_memory_pool_stats_rocalution();
+
+        double hit_rate
+            = stats.requests > 0 ? 100.0 * stats.hits / static_cast<double>(stats.requests) : 0.0;
+
+        LOG_INFO("Host memory pool: " << (host_pool == true ? "on" : "off"));
+        LOG_INFO("Requests: " << stats.requests << ", hits: " << stats.hits << " (" << hit_rate
+                              << "%)");
+        LOG_INFO("Size: " << stats.size << " bytes, peak: " << stats.peak_size
+                          << " bytes, cached: " << stats.cached_size << " bytes");
+    }
+
+    void set_host_allocator_rocalution(void* (*alloc_func)(size_t size, size_t alignment),
+                                       void (*free_func)(void* ptr))
+    {
+        log_debug(0, "set_host_allocator_rocalution()", alloc_func, free_func);
+
+        // Either both or none of the hooks have to be given
+        assert((alloc_func == NULL) == (free_func == NULL));
+
+        std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+        host_alloc_hook = alloc_func;
+        host_free_hook  = free_func;
+    }
+
+    void set_host_huge_pages_rocalution(bool huge_pages, size_t min_size)
+    {
+        log_debug(0, "set_host_huge_pages_rocalution()", huge_pages, min_size);
+
+        std::lock_guard<std::mutex> lock(host_allocations_mutex);
+
+        host_huge_pages          = huge_pages;
+        host_huge_pages_min_size = min_size;
+    }
+
+    template <typename DataType>
+    void allocate_host(int size, DataType** ptr)
+    {
+        log_debug(0, "allocate_host()", "* begin", size, ptr);
+
+        if(size > 0)
+        {
+            assert(*ptr == NULL);
+
+            *ptr = static_cast<DataType*>(host_alloc(static_cast<size_t>(size) * sizeof(DataType)));
 
             if(!(*ptr))
             { // nullptr
@@ -88,7 +412,15 @@ namespace rocalution
                 LOG_VERBOSE_INFO(2, "Size of the requested buffer = " << size * sizeof(DataType));
                 FATAL_ERROR(__FILE__, __LINE__);
             }
-            // *********************************************************
+
+            // Construct the elements like new[] (e.g. std::complex is zero-initialized)
+            if(std::is_trivially_default_constructible<DataType>::value == false)
+            {
+                for(int i = 0; i < size; ++i)
+                {
+                    new(*ptr + i) DataType;
+                }
+            }
 
             assert(*ptr != NULL);
         }
@@ -103,20 +435,12 @@ namespace rocalution
 
         assert(*ptr != NULL);
 
-        // *********************************************************
-        // C++ style
-        delete[] * ptr;
-        // *********************************************************
-
-        // *********************************************************
-        // C style
-        // free(*ptr);
-        // *********************************************************
-
-        // *********************************************************
-        // Aligned allocation
-        //  free(*((void **)*ptr-1));
-        // *********************************************************
+        // The element types are trivially destructible, thus only the memory is released.
+        // Buffers that have been allocated externally with new[] are released by delete[].
+        if(host_free(*ptr) == false)
+        {
+            delete[] * ptr;
+        }
 
         *ptr = NULL;
     }
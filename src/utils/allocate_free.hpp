@@ -26,13 +26,17 @@
 
 #include "rocalution/export.hpp"
 
+#include <cstddef>
+
 namespace rocalution
 {
 
     /** \ingroup backend_module
   * \brief Allocate buffer on the host
   * \details
-  * \p allocate_host allocates a buffer on the host.
+  * \p allocate_host allocates a buffer on the host. The buffer is aligned to (at least)
+  * 64 bytes. It is allocated by the allocation function that has been installed with
+  * set_host_allocator_rocalution(), if any.
   *
   * @param[in]
   * size    number of elements the buffer need to be allocated for
@@ -50,7 +54,10 @@ namespace rocalution
   * \brief Free buffer on the host
   * \details
   * \p free_host deallocates a buffer on the host. \p *ptr will be set to NULL after
-  * successful deallocation.
+  * successful deallocation. Buffers that have been allocated by allocate_host() are
+  * released by the free function of the allocator they have been allocated with. Any
+  * other buffer (e.g. passed to SetDataPtr() by the user) is expected to be allocated
+  * with \p new[] and is released by \p delete[].
   *
   * @param[inout]
   * ptr     pointer to the position in memory where the buffer should be deallocated,
@@ -78,6 +85,146 @@ namespace rocalution
     template <typename DataType>
     ROCALUTION_EXPORT void set_to_zero_host(int size, DataType* ptr);
 
+    /** \ingroup backend_module
+  * \brief Install host allocation functions
+  * \details
+  * \p set_host_allocator_rocalution lets the application provide its own functions for
+  * all host buffers that are allocated by rocALUTION (e.g. from a memory pool or a
+  * NUMA aware allocator). \p alloc_func has to return a buffer of \p size bytes that is
+  * aligned to \p alignment bytes, or NULL on failure. \p free_func releases a buffer
+  * that has been returned by \p alloc_func. Buffers are always released by the free
+  * function of the allocator they have been allocated with, thus the functions can be
+  * changed at any time. Passing NULL for both functions restores the default allocator.
+  *
+  * @param[in]
+  * alloc_func  host allocation function
+  * @param[in]
+  * free_func   host deallocation function
+  *
+  * \par Example
+  * \code{.cpp}
+  *   void* my_alloc(size_t size, size_t alignment)
+  *   {
+  *       void* ptr = NULL;
+  *       return posix_memalign(&ptr, alignment, size) == 0 ? ptr : NULL;
+  *   }
+  *
+  *   void my_free(void* ptr)
+  *   {
+  *       free(ptr);
+  *   }
+  *
+  *   set_host_allocator_rocalution(my_alloc, my_free);
+  * \endcode
+  */
+    ROCALUTION_EXPORT
+    void set_host_allocator_rocalution(void* (*alloc_func)(size_t size, size_t alignment),
+                                       void (*free_func)(void* ptr));
+
+    /** \ingroup backend_module
+  * \brief Enable/disable transparent huge pages for large host buffers
+  * \details
+  * Large sparse matrix-vector products suffer from TLB misses, when the gathered vector
+  * entries are spread over many 4 KiB pages. With \p set_host_huge_pages_rocalution,
+  * the default allocator aligns host buffers of at least \p min_size bytes to 2 MiB and
+  * requests transparent huge pages for them (\p madvise, Linux only). This is a hint to
+  * the operating system and has no effect, if a custom allocator has been installed with
+  * set_host_allocator_rocalution().
+  *
+  * @param[in]
+  * huge_pages  boolean to turn on/off transparent huge pages
+  * @param[in]
+  * min_size    minimum buffer size in bytes
+  */
+    ROCALUTION_EXPORT
+    void set_host_huge_pages_rocalution(bool huge_pages, size_t min_size = 2 * 1024 * 1024);
+
+    /** \ingroup backend_module
+  * \brief Statistics of the host memory pool
+  * \details
+  * The statistics are accumulated over all allocations, that have been performed while
+  * the host memory pool was enabled, see set_host_memory_pool_rocalution().
+  */
+    struct HostMemoryPoolStats
+    {
+        /** \brief Number of allocations */
+        size_t requests;
+        /** \brief Number of allocations that have been served by a cached buffer */
+        size_t hits;
+        /** \brief Bytes held by the pool (buffers in use and cached buffers) */
+        size_t size;
+        /** \brief Maximum number of bytes held by the pool */
+        size_t peak_size;
+        /** \brief Bytes of cached buffers */
+        size_t cached_size;
+    };
+
+    /** \ingroup backend_module
+  * \brief Enable/disable the host memory pool
+  * \details
+  * Solvers and preconditioners allocate and free many temporary vectors and matrices,
+  * e.g. during the setup of the AMG hierarchy. If the setup is repeated (e.g. in each
+  * time step), the allocation and page faulting of these buffers can take a
+  * significant part of the setup time. With \p set_host_memory_pool_rocalution, host
+  * buffers are rounded up to size classes (four per power of two). Freed buffers are
+  * cached and handed out again by subsequent allocations of the same size class,
+  * instead of being returned to the system. Disabling the pool releases all cached
+  * buffers. Buffers that are in use while the pool is disabled are released when they
+  * are freed.
+  *
+  * \note
+  * Recycled buffers keep their NUMA placement, see set_omp_first_touch_rocalution().
+  *
+  * @param[in]
+  * pool            boolean to turn on/off the host memory pool
+  * @param[in]
+  * max_cached_size maximum number of bytes of cached buffers (0 - unlimited)
+  */
+    ROCALUTION_EXPORT
+    void set_host_memory_pool_rocalution(bool pool, size_t max_cached_size = 0);
+
+    /** \ingroup backend_module
+  * \brief Return the statistics of the host memory pool
+  */
+    ROCALUTION_EXPORT
+    HostMemoryPoolStats get_host_memory_pool_stats_rocalution(void);
+
+    /** \ingroup backend_module
+  * \brief Print the statistics of the host memory pool
+  */
+    ROCALUTION_EXPORT
+    void info_host_memory_pool_rocalution(void);
+
+    /** \ingroup backend_module
+  * \brief Return the number of bytes of host memory in use
+  * \details
+  * Sum of the sizes of all host buffers that have been allocated by allocate_host()
+  * (i.e. by all vectors, matrices and solvers) and have not been freed yet. Cached
+  * buffers of the host memory pool are not included. Buffers that have been passed to
+  * rocALUTION by \p SetDataPtr functions are not counted, unless they have been
+  * allocated with allocate_host().
+  */
+    ROCALUTION_EXPORT
+    size_t get_host_memory_usage_rocalution(void);
+
+    /** \ingroup backend_module
+  * \brief Return the maximum number of bytes of host memory in use
+  * \details
+  * High-water mark of get_host_memory_usage_rocalution() since the start of the program
+  * or the last call to reset_host_memory_peak_rocalution().
+  */
+    ROCALUTION_EXPORT
+    size_t get_host_memory_peak_rocalution(void);
+
+    /** \ingroup backend_module
+  * \brief Reset the high-water mark of the host memory usage to the current usage
+  */
+    ROCALUTION_EXPORT
+    void reset_host_memory_peak_rocalution(void);
+
+    // Release all cached buffers of the host memory pool
+    void _release_host_memory_pool(void);
+
 } // namespace rocalution
 
 #endif // ROCALUTION_UTILS_ALLOCATE_FREE_HPP_
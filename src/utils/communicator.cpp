@@ -116,6 +116,98 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    // Allreduce SUM - SYNC
+    template <>
+    void communication_sync_allreduce_sum(const double* local,
+                                          double*       global,
+                                          int           count,
+                                          const void*   comm)
+    {
+        int status = MPI_Allreduce(local, global, count, MPI_DOUBLE, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_sync_allreduce_sum(const float* local,
+                                          float*       global,
+                                          int          count,
+                                          const void*  comm)
+    {
+        int status = MPI_Allreduce(local, global, count, MPI_FLOAT, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+#ifdef SUPPORT_COMPLEX
+    template <>
+    void communication_sync_allreduce_sum(const std::complex<double>* local,
+                                          std::complex<double>*       global,
+                                          int                         count,
+                                          const void*                 comm)
+    {
+        int status = MPI_Allreduce(
+            local, global, count, MPI_DOUBLE_COMPLEX, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_sync_allreduce_sum(const std::complex<float>* local,
+                                          std::complex<float>*       global,
+                                          int                        count,
+                                          const void*                comm)
+    {
+        int status
+            = MPI_Allreduce(local, global, count, MPI_COMPLEX, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+#endif
+
+    // Allreduce SUM in place - ASYNC
+    template <>
+    void communication_async_allreduce_sum(double*     buf,
+                                           int         count,
+                                           MRequest*   request,
+                                           const void* comm)
+    {
+        int status = MPI_Iallreduce(
+            MPI_IN_PLACE, buf, count, MPI_DOUBLE, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(float*      buf,
+                                           int         count,
+                                           MRequest*   request,
+                                           const void* comm)
+    {
+        int status = MPI_Iallreduce(
+            MPI_IN_PLACE, buf, count, MPI_FLOAT, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+#ifdef SUPPORT_COMPLEX
+    template <>
+    void communication_async_allreduce_sum(std::complex<double>* buf,
+                                           int                   count,
+                                           MRequest*             request,
+                                           const void*           comm)
+    {
+        int status = MPI_Iallreduce(
+            MPI_IN_PLACE, buf, count, MPI_DOUBLE_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(std::complex<float>* buf,
+                                           int                  count,
+                                           MRequest*            request,
+                                           const void*          comm)
+    {
+        int status = MPI_Iallreduce(
+            MPI_IN_PLACE, buf, count, MPI_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+#endif
+
     // Allreduce single MAX - SYNC
     template <>
     void communication_sync_allreduce_single_max(double local, double* global, const void* comm)
@@ -39,6 +39,18 @@ namespace rocalution
                                                  ValueType*  global,
                                                  const void* comm);
 
+    template <typename ValueType>
+    void communication_sync_allreduce_sum(const ValueType* local,
+                                          ValueType*       global,
+                                          int              count,
+                                          const void*      comm);
+
+    template <typename ValueType>
+    void communication_async_allreduce_sum(ValueType*  buf,
+                                           int         count,
+                                           MRequest*   request,
+                                           const void* comm);
+
     template <typename ValueType>
     void communication_sync_allreduce_single_max(ValueType   local,
                                                  ValueType*  global,